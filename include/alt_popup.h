@@ -0,0 +1,23 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Popup of alternate characters (other case, related punctuation) shown on a long
+// press of a key letter; the keymap lists them (keymap_alternates). A single
+// overlay on the top layer is created at boot and reused: opening it only moves
+// it and copies the characters into its cells, so nothing is allocated and the
+// keyboard is not laid out again.
+#define ALT_POPUP_MAX_CELLS 6
+
+// Create the hidden overlay on the display's top layer
+void alt_popup_init(lv_coord_t cell_width, lv_coord_t cell_height, const lv_font_t *font,
+                    lv_color_t color, lv_color_t selected_color);
+// Show character and then a cell per character of alternates (UTF-8) above anchor
+// (screen coordinates), centered on anchor_x. Returns false when alternates is NULL
+bool alt_popup_open(const char *character, const char *alternates, const lv_area_t *anchor, lv_coord_t anchor_x);
+// Select the cell under the x coordinate of point (clamped to the first / last cell)
+void alt_popup_select(const lv_point_t *point);
+// Hide the popup; returns the selected character (valid until it opens again), NULL when it was not open
+const char *alt_popup_close();
+bool alt_popup_is_open();
+lv_obj_t *alt_popup_get_obj();
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Timestamps of the boot phases (microseconds since reset, so the ROM bootloader and
+// the Arduino startup count too), logged as one report with the duration of each
+// phase. The first frame on the panel and the first keystroke the UI accepted are
+// phases too, marked by themselves.
+#define BOOT_TRACE_MAX_PHASES 24
+
+// With USB CDC on boot, the longest wait for the host to open the serial port
+#define BOOT_SERIAL_WAIT_MS 2000
+
+// Build the keyboard in stages after the first frame, which shows the key outlines
+// only. Disable with '-D LAZY_UI=0' to build everything before the first frame
+#ifndef LAZY_UI
+#define LAZY_UI 1
+#endif
+
+// Record the end of a phase; name must be static
+void boot_trace_mark(const char *name);
+// Mark "first frame" when the next refresh of disp has flushed pixels to the panel
+void boot_trace_watch_first_frame(lv_display_t *disp);
+// Mark "first key" (once) and log the report
+void boot_trace_first_key();
+void boot_trace_report();
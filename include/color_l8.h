@@ -0,0 +1,35 @@
+#pragma once
+
+#include <lvgl.h>
+
+// 8 bit rendering for low-bandwidth panels, enabled with '-D LV_COLOR_DEPTH=8'.
+// LVGL renders gray levels (L8), half the bytes of RGB565 per pixel. The flush path
+// expands them to RGB565 through 256 entry lookup tables, one per screen region:
+// in a region, COLOR_L8_INK is shown as the region's ink colour and the levels between
+// black, ink and white as the blends between those colours. Outside of all regions
+// the levels stay gray.
+//
+// The UI only needs black, white and one accent colour per region (orange keys,
+// green pressed key), so anti-aliased edges come out the same as at 16 bit.
+
+// The gray level UI elements use for the accent colour in 8 bit mode
+#define COLOR_L8_INK lv_color_hex(0x808080)
+#define COLOR_L8_INK_LEVEL 0x80
+
+#define COLOR_L8_MAX_REGIONS 4
+
+// Rows of RGB565 in each of the two staging buffers the flush converts into
+#ifndef COLOR_L8_STAGING_ROWS
+#define COLOR_L8_STAGING_ROWS 2
+#endif
+
+// Replace the display's draw buffers by L8 buffers of as many pixels (half the bytes)
+// and the RGB565 staging buffers, and install the converter in the flush path.
+// Call after flush_hooks_init, before the first refresh
+bool color_l8_init(lv_display_t *disp);
+// A region following obj's coordinates (shrunk by inset), obj can be NULL (inactive).
+// Regions added later are on top. Returns the region id
+int color_l8_add_region(lv_obj_t *obj, lv_color_t ink, int32_t inset);
+// Move a region to another object (or NULL); both areas are redrawn
+void color_l8_set_region_obj(int id, lv_obj_t *obj);
+lv_obj_t *color_l8_get_region_obj(int id);
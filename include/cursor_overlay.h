@@ -0,0 +1,20 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Blinking cursors composited into the flushed pixels instead of LVGL objects.
+// Each cursor keeps a copy of the background pixels under it (captured at flush
+// time), so a blink writes only the cursor rectangle to the panel and never
+// makes LVGL render the text underneath.
+#define CURSOR_OVERLAY_MAX_CURSORS 2
+#define CURSOR_OVERLAY_MAX_PX (4 * 32) // Largest cursor rectangle in pixels
+
+// Register the flush filter; flush_hooks_init() must have been called
+void cursor_overlay_init();
+// Returns the cursor id, or -1 when out of slots
+int cursor_overlay_add(lv_color_t color, lv_coord_t width, lv_coord_t height);
+// Move a cursor; (x, y) is the top left corner in screen coordinates, clip limits
+// the visible part (e.g. the parent object's area)
+void cursor_overlay_move(int id, lv_coord_t x, lv_coord_t y, const lv_area_t *clip);
+// Toggle all cursors; returns the number of pixels written to the panel
+uint32_t cursor_overlay_blink();
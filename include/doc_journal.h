@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Accepted text persisted in an append-only journal on flash (LittleFS).
+// A segment holds a snapshot of the document, compressed in blocks like the
+// document in RAM (doc_store.h), a commit marker and then one CRC checked record
+// per accept_input. Records are padded not to straddle a DOC_JOURNAL_PAGE_SIZE
+// boundary of the segment file; how the file reaches flash is up to LittleFS
+// (an append can rewrite the file's last block), so only the bytes written to
+// the files are counted. When a segment has grown past its snapshot, a
+// new one is written to the other segment file in small steps from a timer;
+// it only replaces the old one once its commit marker is on flash, so a power
+// cut at any point restores either segment intact. Restoring reads one segment:
+// the snapshot plus the records since.
+// Disable with '-D DOC_JOURNAL=0'
+#ifndef DOC_JOURNAL
+#define DOC_JOURNAL 1
+#endif
+
+#define DOC_JOURNAL_PAGE_SIZE 256 // A record fits in one
+// Start compacting when the records after the snapshot exceed this, and the snapshot
+#define DOC_JOURNAL_COMPACT_BYTES 4096
+// Snapshot bytes written per compaction step
+#define DOC_JOURNAL_STEP_BYTES 256
+#define DOC_JOURNAL_STEP_MS 20
+
+// Two segments (0 and 1), each an append-only byte stream
+typedef struct
+{
+    int32_t (*size)(int seg); // < 0 when missing
+    int32_t (*read)(int seg, uint32_t offset, void *buf, uint32_t len);
+    int32_t (*append)(int seg, const void *buf, uint32_t len); // Bytes written, short when power was lost
+    bool (*remove)(int seg);
+} doc_journal_store_t;
+
+typedef struct
+{
+    uint32_t accepts;
+    uint32_t text_bytes;       // Accepted text
+    uint32_t record_bytes;     // Written for the accepts, headers and padding included
+    uint32_t compaction_bytes; // Written by compactions
+    uint32_t compactions;
+} doc_journal_stats_t;
+
+// The current document; it only grows by appending, so a prefix never changes
+typedef struct
+{
+    uint32_t (*len)(void);
+    bool (*read)(uint32_t offset, char *buf, uint32_t len);
+} doc_journal_text_t;
+
+typedef struct
+{
+    const doc_journal_store_t *store;
+    const doc_journal_text_t *text;
+    bool ok;
+    int seg;           // Active segment
+    uint32_t seq;      // Of the active segment
+    uint32_t seg_bytes;
+    uint32_t snapshot_bytes;
+    bool compacting;
+    uint32_t compact_len;  // Document bytes in the new snapshot
+    uint32_t compact_done; // Of those, compressed
+    uint32_t compact_crc;
+    doc_journal_stats_t stats;
+} doc_journal_t;
+
+// Restore from store: *text is the document (malloc'ed, caller frees; NULL when
+// nothing was restored). document must read it once it has been set.
+bool doc_journal_open(doc_journal_t *j, const doc_journal_store_t *store, const doc_journal_text_t *document,
+                      char **text, uint32_t *len);
+// Persist appended text; false when it is not on flash
+bool doc_journal_append(doc_journal_t *j, const char *text, uint32_t len);
+// One step of a pending compaction (from a timer)
+void doc_journal_poll(doc_journal_t *j);
+void doc_journal_report(const doc_journal_t *j);
+
+// The store on LittleFS
+const doc_journal_store_t *doc_journal_littlefs_store();
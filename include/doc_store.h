@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The document held as blocks of DOC_STORE_BLOCK_SIZE bytes, each compressed on its
+// own (LZ4 block format) as soon as it is full. Only the end of the document, where
+// the cursor is, stays decompressed: the last full block and the text after it. The
+// text area label shows that view in place, without a copy of its own. Reading
+// further back decompresses one block at a time (the journal snapshots, which are
+// compressed the same way on flash).
+// Disable with '-D DOC_STORE=0' (the document is then the label's text)
+#ifndef DOC_STORE
+#define DOC_STORE 1
+#endif
+
+// At boot, compress a generated text and the document, and time the decompression
+// of each block against a frame
+#ifndef DOC_STORE_BENCH
+#define DOC_STORE_BENCH 0
+#endif
+
+#define DOC_STORE_BLOCK_SIZE 2048 // Text bytes per block; positions in a block fit 16 bits
+#define DOC_STORE_FRAME_MS 33     // LV_DEF_REFR_PERIOD
+#define DOC_STORE_BENCH_BLOCKS 16
+
+// --- Codec ---
+// LZ4 blocks without frame headers, of at most DOC_STORE_BLOCK_SIZE text bytes.
+// Returns the compressed size, 0 when it does not fit in cap
+uint32_t doc_store_compress(const char *src, uint32_t len, uint8_t *dst, uint32_t cap);
+// Returns the text size, -1 when src is damaged or its text does not fit in cap
+int32_t doc_store_decompress(const uint8_t *src, uint32_t len, char *dst, uint32_t cap);
+
+// --- Document ---
+bool doc_store_init();
+// False when out of memory for a block: then nothing is appended
+bool doc_store_append(const char *text, uint32_t len);
+void doc_store_clear();
+uint32_t doc_store_length();
+// The decompressed end of the document, NUL terminated and starting on a character;
+// changed in place by the next append or clear
+const char *doc_store_view();
+// The whole document when the view holds all of it, else NULL
+const char *doc_store_text();
+// Copy len bytes at offset; false when past the end or a block is damaged
+bool doc_store_read(uint32_t offset, char *buf, uint32_t len);
+void doc_store_report();
+#if DOC_STORE_BENCH
+void doc_store_bench();
+#endif
@@ -0,0 +1,54 @@
+#ifndef DRAW_SW_ASM_CUSTOM_H
+#define DRAW_SW_ASM_CUSTOM_H
+
+// Vectorized RGB565 kernels plugged into LVGL's software renderer through
+// LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM. This header is included by LVGL's
+// blend code: a macro returning LV_RESULT_INVALID makes LVGL run its own scalar loop.
+//
+// - ESP32-S3: PIE 128 bit stores/loads (8 pixels per instruction)
+// - x86 (host builds of LVGL): SSE2
+// - Everything else: 32 bit scalar (2 pixels per store)
+//
+// Left to LVGL's scalar loops on purpose:
+// - A8 masks (font glyphs, the A8 images of the glyph atlas and the emoji, rounded
+//   corners) and opacity < 100%: per pixel mixes, whose rounding a vector version
+//   would have to match bit for bit; LVGL already skips the fully covered and empty
+//   words of a mask
+// - ARGB8888 / RGB888 / L8 images: the UI draws none in RGB565 mode
+// - Blend modes other than normal: unused
+// - AVX2: SSE2 is the x86-64 baseline, needing no build flags, and the host only
+//   builds these for the tests
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bit-exactness check against reference scalar kernels plus per-kernel throughput, logged at boot
+#ifndef DRAW_ASM_SELFTEST
+#define DRAW_ASM_SELFTEST 0
+#endif
+
+// Use the 32 bit scalar path on x86 too (the host tests build both)
+#ifndef DRAW_ASM_SCALAR
+#define DRAW_ASM_SCALAR 0
+#endif
+
+int draw_asm_fill_rgb565(void *dest_buf, int32_t w, int32_t h, int32_t dest_stride, uint16_t color);
+int draw_asm_copy_rgb565(void *dest_buf, int32_t w, int32_t h, int32_t dest_stride, const void *src_buf, int32_t src_stride);
+void draw_asm_selftest(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+// Strides are in bytes. Only the unmasked, opaque cases are replaced: masked and
+// semi-transparent blends already skip fully covered/empty words in LVGL's scalar code.
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+    draw_asm_fill_rgb565((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, lv_color_to_u16((dsc)->color))
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc) \
+    draw_asm_copy_rgb565((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, (dsc)->src_buf, (dsc)->src_stride)
+
+#endif // DRAW_SW_ASM_CUSTOM_H
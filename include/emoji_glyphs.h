@@ -0,0 +1,107 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Emoji and other symbols beyond the UI fonts, read from a pack file on flash
+// (EMOJI_PACK_PATH, written by tools/emoji_pack.py and uploaded with
+// 'pio run -t uploadfs'). A glyph is decoded on demand into one of
+// EMOJI_CACHE_SLOTS A8 bitmaps, the least recently used one is replaced, so a
+// pack of thousands of glyphs costs the slots in RAM and a sparse index of the
+// pack. The keyboard shows them on the picker layer (long press on 123), with
+// the same image_recolor as the atlas glyphs; in the text they come from
+// emoji_font, the fallback of the UI fonts (ui_fonts.h).
+// Hits, misses and the time a miss takes (file read and decode) are logged
+// every EMOJI_REPORT_MS.
+// Enable with '-D EMOJI_LAYER=1' (the default is set in lv_conf.h, which enables the image font)
+
+#ifndef EMOJI_PACK_PATH
+#define EMOJI_PACK_PATH "/littlefs/emoji.pak" // Through the VFS: plain stdio, as on a host
+#endif
+#define EMOJI_SIZE 16 // Pixels, width and height of every glyph
+#define EMOJI_CACHE_SLOTS 48 // A picker page (36) plus what the text shows
+#define EMOJI_REPORT_MS 10000
+
+// At boot, page through the whole picker and back, then type a skewed stream of
+// glyphs into a line of text; log the hit rate and the miss latency of each
+#ifndef EMOJI_BENCH
+#define EMOJI_BENCH 0
+#endif
+#define EMOJI_BENCH_TYPED 2000
+
+// --- Pack File ---
+// Header, the sparse index (the first code point of every stride entries), the
+// index (entries sorted by code point) and the glyph data, little endian.
+// A glyph is run-length coded A8: a control byte c < 0x80 is followed by c + 1
+// literal pixels, c >= 0x80 by one pixel repeated c - 0x80 + 2 times.
+#define EMOJI_PACK_MAGIC 0x314a4d45 // "EMJ1"
+#define EMOJI_PACK_MAX_BLOCKS 128   // Sparse index entries held in RAM
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t count;  // Glyphs
+    uint16_t width;  // EMOJI_SIZE
+    uint16_t height; // EMOJI_SIZE
+    uint16_t stride; // Index entries per sparse index entry
+    uint16_t reserved;
+} emoji_pack_header_t;
+
+typedef struct
+{
+    uint32_t codepoint;
+    uint32_t offset; // Of the glyph data, from the start of the file
+    uint16_t length; // Coded bytes
+    uint16_t reserved;
+} emoji_pack_entry_t;
+
+// Random access to the pack
+typedef struct
+{
+    bool (*open)(void);
+    int32_t (*read)(uint32_t offset, void *buf, uint32_t len); // Bytes read
+} emoji_store_t;
+
+typedef struct
+{
+    uint32_t lookups;
+    uint32_t hits;
+    uint32_t misses;    // Glyphs read and decoded
+    uint32_t not_found; // Code points the pack doesn't have
+    uint32_t evictions;
+    uint32_t failures; // Read or decode errors, and no free slot
+    uint32_t miss_us;  // Total time of the misses
+    uint32_t read_us;  // Of that, reading the file
+    uint32_t miss_max_us;
+} emoji_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Copy of the image font, so the constant UI fonts can name it as their fallback
+extern lv_font_t emoji_font;
+#ifdef __cplusplus
+}
+#endif
+
+#if EMOJI_LAYER
+// The pack on LittleFS
+const emoji_store_t *emoji_glyphs_file_store();
+// Read the pack's header and sparse index, set up emoji_font
+bool emoji_glyphs_init(const emoji_store_t *store);
+uint32_t emoji_glyphs_count();
+// Code points of the glyphs first.. (in pack order) into codepoints[]; returns how many there are
+uint32_t emoji_glyphs_codepoints(uint32_t first, uint32_t *codepoints, uint32_t count);
+// The glyph of codepoint, NULL when the pack doesn't have it. The bitmap stays
+// valid until the next lookup, unless it is pinned: a pinned glyph (e.g. on a key)
+// is not replaced until it is unpinned as often
+const lv_image_dsc_t *emoji_glyphs_get(uint32_t codepoint);
+const lv_image_dsc_t *emoji_glyphs_pin(uint32_t codepoint);
+void emoji_glyphs_unpin(const lv_image_dsc_t *glyph);
+// UTF-8 of codepoint into out (5 bytes), terminated; returns the length
+size_t emoji_glyphs_utf8(uint32_t codepoint, char *out);
+const emoji_stats_t *emoji_glyphs_stats();
+void emoji_glyphs_report();
+#if EMOJI_BENCH
+void emoji_glyphs_bench();
+#endif
+#endif
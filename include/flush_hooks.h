@@ -0,0 +1,34 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Interposes on the panel flush callback installed by esp32-smartdisplay.
+// Filters see every block of RGB565 pixels right before it is sent to the panel
+// and may read or modify it in place.
+#define FLUSH_HOOKS_MAX_FILTERS 4
+
+typedef void (*flush_filter_cb_t)(const lv_area_t *area, uint16_t *px_map, void *user_data);
+
+// Everything sent to the panel since boot, LVGL flushes and direct writes
+typedef struct
+{
+    uint32_t transactions;
+    uint32_t bytes; // Wraps, use differences
+} flush_hooks_stats_t;
+
+// Converts the rows of area from the rendered format (src, rows of area width) to RGB565
+typedef void (*flush_convert_cb_t)(const lv_area_t *area, const uint8_t *src, uint16_t *dest);
+
+void flush_hooks_init(lv_display_t *disp);
+void flush_hooks_add_filter(flush_filter_cb_t cb, void *user_data);
+// For displays not rendering RGB565: blocks are converted and sent in chunks of whole
+// rows, alternating between two staging buffers of staging_px pixels each (at least one row).
+// Filters run on the converted chunks.
+void flush_hooks_set_converter(flush_convert_cb_t cb, uint16_t *staging, uint32_t staging_px);
+
+// Send pixels straight to the panel, outside of LVGL's refresh cycle.
+// Blocks until the transfer is done. The panel driver may modify px_map (byte swap),
+// so pass a scratch copy.
+void flush_hooks_write(const lv_area_t *area, uint16_t *px_map);
+
+const flush_hooks_stats_t *flush_hooks_get_stats();
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Reworks the invalidated areas of each frame before LVGL renders them: areas are
+// merged whenever one transaction for the bounding box is cheaper than two
+// separate ones or when they overlap, and sent top to bottom. Every flush is counted in bytes and
+// panel transactions and reported on the serial log, per frame and per keystroke.
+// '-D FLUSH_SCHEDULER=0' keeps LVGL's own area joining (the report is still logged)
+#ifndef FLUSH_SCHEDULER
+#define FLUSH_SCHEDULER 1
+#endif
+
+// Cost of one panel transaction (window commands, CS / DC toggling, DMA setup),
+// expressed in pixel bytes that could have been sent in the same time
+#ifndef FLUSH_SCHEDULER_TX_OVERHEAD_BYTES
+#define FLUSH_SCHEDULER_TX_OVERHEAD_BYTES 256
+#endif
+
+// Panel bus model: SPI clock and time per transaction
+#ifndef FLUSH_SCHEDULER_BUS_HZ
+#define FLUSH_SCHEDULER_BUS_HZ 40000000
+#endif
+#ifndef FLUSH_SCHEDULER_TX_OVERHEAD_US
+#define FLUSH_SCHEDULER_TX_OVERHEAD_US 50
+#endif
+
+// Interval of the flush report on the serial log
+#define FLUSH_SCHEDULER_REPORT_MS 5000
+
+// Hook the display refresh; call after flush_hooks_init
+void flush_scheduler_init(lv_display_t *disp);
+// Count a keystroke for the bytes per keystroke figure
+void flush_scheduler_mark_input();
+// Modeled bus time of sending the given bytes in the given number of transactions
+uint32_t flush_scheduler_model_us(uint32_t bytes, uint32_t transactions);
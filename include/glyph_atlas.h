@@ -0,0 +1,24 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Keyboard glyphs pre-rendered at boot (and for another keymap) into A8 bitmaps.
+// Keys show them with lv_image objects: the sw renderer blends an A8 image with
+// the style's image_recolor, so the same bitmap serves the normal and the active
+// colour and a key redraw never goes through the font engine.
+// '-D GLYPH_ATLAS=0' falls back to plain labels, e.g. to compare key redraw times
+#ifndef GLYPH_ATLAS
+#define GLYPH_ATLAS 1
+#endif
+
+#define GLYPH_ATLAS_MAX_ENTRIES 127 // The characters and labels of a keymap (tools/keymap_compile.py checks it)
+#define GLYPH_ATLAS_MAX_TEXT 8 // Longest label incl. terminator
+
+// Render every single character (UTF-8) of chars[] and every string of labels[].
+// Building again replaces the atlas: point the images at the new entries
+bool glyph_atlas_build(const lv_font_t *font, const char *const *chars, int chars_count, const char *const *labels, int labels_count);
+// NULL when the character / label is not in the atlas
+const lv_image_dsc_t *glyph_atlas_get_char(char c);
+const lv_image_dsc_t *glyph_atlas_get_label(const char *text);
+// Bytes used by the bitmaps and descriptors
+size_t glyph_atlas_footprint();
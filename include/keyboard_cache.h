@@ -0,0 +1,32 @@
+#pragma once
+
+#include <lvgl.h>
+
+// The idle keyboard rendered once into a PSRAM bitmap per layer. The keyboard area draws
+// invalidated regions by copying from the bitmap; idle keys are skipped by the
+// renderer and only a key that looks different from its idle state (pressed, or
+// showing the selected letter) is drawn live on top.
+// Enable with '-D KEYBOARD_CACHE=1' (needs about 200 kB of PSRAM per layer at 320x320, half in 8 bit mode)
+#ifndef KEYBOARD_CACHE
+#define KEYBOARD_CACHE 0
+#endif
+
+// Keys in this state (or LV_STATE_PRESSED) are drawn live instead of from the cache
+#define KEYBOARD_CACHE_STATE_LIVE LV_STATE_USER_3
+
+// Bitmaps, one per look of the keyboard: a keymap layer each and the emoji picker
+#define KEYBOARD_CACHE_MAX_IMAGES 9
+
+// Allocate the first bitmap for the keyboard area and take over its drawing
+bool keyboard_cache_init(lv_obj_t *kb_area);
+// A key that is part of the cached image
+void keyboard_cache_add_key(lv_obj_t *key);
+// Render the idle keyboard as it looks now into bitmap image and draw from it
+void keyboard_cache_render(uint8_t image);
+// Draw from bitmap image as rendered before: false when it wasn't, or since the
+// last keyboard_cache_invalidate
+bool keyboard_cache_show(uint8_t image);
+// Every bitmap is out of date, e.g. after the keymap changed
+void keyboard_cache_invalidate();
+// Switch between cached and live drawing of the idle keys (for comparisons)
+void keyboard_cache_set_enabled(bool enabled);
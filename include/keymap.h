@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The keyboard layout as a compact binary keymap: layers of 12 blob keys with 3
+// characters each, the label of every action key in every layer, what the action
+// keys do and the alternates of the characters. tools/keymap_compile.py compiles
+// the text definitions in keymaps/: keymaps/en.txt into the firmware (flash, used
+// where it is mapped), the others into data/keymaps/*.kmp for LittleFS. A keymap
+// is checked once when it is selected and then used in place: the keys point at
+// its strings. A long press on space switches to the next keymap without
+// rebuilding the key objects; the choice is kept in KEYMAP_SELECTION_PATH.
+
+#define KEYMAP_MAGIC 0x31504d4b // "KMP1"
+#define KEYMAP_KEYS 12          // Blob keys
+#define KEYMAP_SLOTS 3          // Characters per blob key: left, center, right
+#define KEYMAP_ACTION_KEYS 5    // In the order of action_keys: clear, accept, space, shift, 123
+#define KEYMAP_MAX_LAYERS 8
+#define KEYMAP_MAX_SIZE 4096
+#define KEYMAP_DIR "/keymaps"                  // On LittleFS, *.kmp
+#define KEYMAP_SELECTION_PATH "/keymap.sel"    // Path of the selected keymap, missing: built in
+#define KEYMAP_MAX_FILES 8
+
+// What an action key does
+typedef enum
+{
+    KEYMAP_ACTION_NONE,
+    KEYMAP_ACTION_CLEAR,
+    KEYMAP_ACTION_ACCEPT,
+    KEYMAP_ACTION_SPACE,
+    KEYMAP_ACTION_LAYER, // To the key's target in the shown layer
+} keymap_action_t;
+
+// --- Binary Format ---
+// Header, layers, alternates and the strings (UTF-8, terminated), little endian.
+// Strings are referred to by their offset in the keymap; the CRC covers
+// everything after the crc field.
+typedef struct
+{
+    uint32_t magic;
+    uint32_t crc;
+    uint16_t size; // Bytes, header included
+    uint16_t name; // String
+    uint16_t layers;
+    uint16_t alternates;
+    uint8_t layer_count; // The first one is shown when the keymap is selected
+    uint8_t alternate_count;
+    uint8_t actions[KEYMAP_ACTION_KEYS]; // keymap_action_t
+    uint8_t reserved;
+} keymap_header_t;
+
+typedef struct
+{
+    uint16_t slots[KEYMAP_KEYS][KEYMAP_SLOTS]; // Strings of one character
+    uint16_t labels[KEYMAP_ACTION_KEYS];       // Strings
+    uint8_t targets[KEYMAP_ACTION_KEYS];       // Layer of a KEYMAP_ACTION_LAYER key
+    uint8_t reserved;
+} keymap_layer_t;
+
+typedef struct
+{
+    uint16_t character;  // String of one character
+    uint16_t alternates; // String, a popup cell per character (other case first for letters)
+} keymap_alternate_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// keymaps/en.txt, generated into src/generated/keymap_builtin.c
+extern const uint8_t keymap_builtin[];
+extern const uint32_t keymap_builtin_size;
+#ifdef __cplusplus
+}
+#endif
+
+// Select the keymap of KEYMAP_SELECTION_PATH, the built-in one when it is missing or damaged
+void keymap_init();
+// Select the next keymap: the built-in one, then those in KEYMAP_DIR by name.
+// False when there is no other one. The strings of the previous keymap are gone:
+// show a layer of the new one before LVGL draws again
+bool keymap_select_next();
+const char *keymap_name();
+
+// The selected keymap
+uint8_t keymap_layer_count();
+const char *keymap_slot(uint8_t layer, int key, int slot);
+const char *keymap_label(uint8_t layer, int action_key);
+keymap_action_t keymap_action(int action_key);
+uint8_t keymap_target(uint8_t layer, int action_key);
+// Popup cells after character, NULL when it has none
+const char *keymap_alternates(const char *character);
@@ -26,8 +26,11 @@
    COLOR SETTINGS
  *====================*/
 
-/*Color depth: 8 (A8), 16 (RGB565), 24 (RGB888), 32 (XRGB8888)*/
+/*Color depth: 8 (L8), 16 (RGB565), 24 (RGB888), 32 (XRGB8888)
+ *8 bit is expanded to the panel's RGB565 in the flush path, see color_l8.h*/
+#ifndef LV_COLOR_DEPTH
 #define LV_COLOR_DEPTH 16
+#endif
 
 /*=========================
    STDLIB WRAPPER SETTINGS
@@ -40,7 +43,16 @@
  * - LV_STDLIB_RTTHREAD:    RT-Thread implementation
  * - LV_STDLIB_CUSTOM:      Implement the functions externally
  */
+/*1: allocate from the UI, scratch and text arenas of lvgl_arenas.cpp*/
+#ifndef LVGL_ARENAS
+#define LVGL_ARENAS 0
+#endif
+
+#if LVGL_ARENAS
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_CUSTOM
+#else
 #define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#endif
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 
@@ -137,10 +149,11 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
-    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_CUSTOM
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
-        #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
+        /*Vectorized RGB565 fill / image copy (src/draw_sw_asm_custom.c)*/
+        #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE "draw_sw_asm_custom.h"
     #endif
 #endif
 
@@ -385,15 +398,21 @@
  *   FONT USAGE
  *===================*/
 
+/*1: the UI uses subsets of Montserrat 14, 18 and 20 with only the characters it draws,
+ *generated at build time by tools/ui_fonts.py (see ui_fonts.h), instead of the full fonts*/
+#ifndef UI_FONTS
+#define UI_FONTS 1
+#endif
+
 /*Montserrat fonts with ASCII range and some symbols using bpp = 4
  *https://fonts.google.com/specimen/Montserrat*/
 #define LV_FONT_MONTSERRAT_8  0
 #define LV_FONT_MONTSERRAT_10 0
 #define LV_FONT_MONTSERRAT_12 0
-#define LV_FONT_MONTSERRAT_14 1
-#define LV_FONT_MONTSERRAT_16 1
-#define LV_FONT_MONTSERRAT_18 1
-#define LV_FONT_MONTSERRAT_20 1
+#define LV_FONT_MONTSERRAT_14 !UI_FONTS
+#define LV_FONT_MONTSERRAT_16 0
+#define LV_FONT_MONTSERRAT_18 !UI_FONTS
+#define LV_FONT_MONTSERRAT_20 !UI_FONTS
 #define LV_FONT_MONTSERRAT_22 0
 #define LV_FONT_MONTSERRAT_22 0
 #define LV_FONT_MONTSERRAT_24 0
@@ -422,10 +441,18 @@
 /*Optionally declare custom fonts here.
  *You can use these fonts as default font too and they will be available globally.
  *E.g. #define LV_FONT_CUSTOM_DECLARE   LV_FONT_DECLARE(my_font_1) LV_FONT_DECLARE(my_font_2)*/
+#if UI_FONTS
+#define LV_FONT_CUSTOM_DECLARE LV_FONT_DECLARE(ui_font_14) LV_FONT_DECLARE(ui_font_18) LV_FONT_DECLARE(ui_font_20)
+#else
 #define LV_FONT_CUSTOM_DECLARE
+#endif
 
 /*Always set a default font*/
+#if UI_FONTS
+#define LV_FONT_DEFAULT &ui_font_14
+#else
 #define LV_FONT_DEFAULT &lv_font_montserrat_14
+#endif
 
 /*Enable handling large font and/or fonts with a lot of characters.
  *The limit depends on the font size, font face and bpp.
@@ -744,8 +771,8 @@
  * OTHERS
  *==================*/
 
-/*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+/*1: Enable API to take snapshot for object (keyboard cache)*/
+#define LV_USE_SNAPSHOT 1
 
 /*1: Enable system monitor component*/
 #define LV_USE_SYSMON   0
@@ -812,8 +839,14 @@
 /*1: Enable lv_obj fragment*/
 #define LV_USE_FRAGMENT 0
 
+/*1: emoji and extended symbols from a pack on flash, on a keyboard layer and in the text
+ *through an image font, the fallback of the UI fonts (see emoji_glyphs.h)*/
+#ifndef EMOJI_LAYER
+#define EMOJI_LAYER 0
+#endif
+
 /*1: Support using images as font in label or span widgets */
-#define LV_USE_IMGFONT 0
+#define LV_USE_IMGFONT EMOJI_LAYER
 
 /*1: Enable an observer pattern implementation*/
 #define LV_USE_OBSERVER 1
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <lvgl.h>
+
+// LVGL's allocator (LV_STDLIB_CUSTOM) split into arenas instead of one 96 kB pool:
+//   ui       long-lived objects and styles, internal RAM
+//   scratch  allocations made while a frame renders (layers, draw tasks), internal RAM;
+//            most are freed by the end of the frame, but what LVGL caches while drawing
+//            (decoded images, glyphs) stays and only holds its own bytes
+//   text     the document label's text, in PSRAM when the board has it
+// Each arena is a TLSF heap of ESP-IDF's multi_heap in a region of its own.
+// The arena of an allocation is the one selected (lvgl_arena_select, scratch during
+// rendering); when it is exhausted the others are tried, then the system heap. A block is
+// freed and resized by the arena that owns its address. High watermark, fragmentation,
+// fallbacks and failures of each arena are logged every LVGL_ARENAS_REPORT_MS.
+// Enable with '-D LVGL_ARENAS=1' (the default is set in lv_conf.h, which selects the allocator)
+
+#define LVGL_ARENA_UI_SIZE (80 * 1024U)
+#define LVGL_ARENA_SCRATCH_SIZE (16 * 1024U) // Together the size of the former LV_MEM_SIZE
+#define LVGL_ARENA_TEXT_SIZE (256 * 1024U)   // PSRAM only
+#define LVGL_ARENAS_REPORT_MS 10000
+
+// At boot, churn private arenas with an allocation pattern like the UI's (objects,
+// transient strings, a growing text, per-frame scratch) and check that fragmentation
+// stays bounded
+#ifndef LVGL_ARENAS_SELFTEST
+#define LVGL_ARENAS_SELFTEST 0
+#endif
+
+typedef enum
+{
+    LVGL_ARENA_UI,
+    LVGL_ARENA_SCRATCH,
+    LVGL_ARENA_TEXT,
+    LVGL_ARENA_COUNT
+} lvgl_arena_id_t;
+
+#if LVGL_ARENAS
+// Select the arena of the following allocations; returns the previous one. Resizing a
+// block moves it to the selected arena (except for scratch, which never takes a block over)
+lvgl_arena_id_t lvgl_arena_select(lvgl_arena_id_t arena);
+// Use the scratch arena while disp renders, and start the report timer
+void lvgl_arenas_init(lv_display_t *disp);
+void lvgl_arenas_report();
+#if LVGL_ARENAS_SELFTEST
+void lvgl_arenas_selftest();
+#endif
+#endif
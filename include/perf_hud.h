@@ -0,0 +1,22 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Live performance HUD drawn in the status bar: FPS, CPU load, LVGL heap used /
+// fragmentation and the last keystroke's touch-to-flush latency.
+// Enable with '-D PERF_HUD=1' in platformio.ini
+#ifndef PERF_HUD
+#define PERF_HUD 0
+#endif
+
+// Minimum interval between two updates of a HUD field
+#define PERF_HUD_UPDATE_MS 250
+// Interval of the HUD overhead report on the serial log
+#define PERF_HUD_REPORT_MS 5000
+
+// Create the HUD fields inside the status bar and hook the display events
+void perf_hud_create(lv_obj_t *bar);
+// Timestamp a keystroke; the latency is taken at the next completed flush
+void perf_hud_mark_input();
+// Synchronously redraw an object; returns the time of the refresh (render + flush)
+uint32_t perf_measure_redraw_us(lv_obj_t *obj);
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Render cost of a scripted typing session, logged as one row of a markdown table
+// so the rows of several boards can be pasted into one matrix: frame time, pixels
+// rendered, draw buffer and LVGL heap. Runs at boot with '-D RENDER_BENCH=1'.
+// The session is driven by a virtual pointer and a virtual clock, so every board
+// renders exactly the same frames.
+#ifndef RENDER_BENCH
+#define RENDER_BENCH 0
+#endif
+
+// Virtual time per frame, frames a key is held and frames between two taps
+#define RENDER_BENCH_FRAME_MS 16
+#define RENDER_BENCH_HOLD_FRAMES 3
+#define RENDER_BENCH_IDLE_FRAMES 8
+
+// Tap every point in turn (screen coordinates)
+void render_bench_run(lv_display_t *disp, const lv_point_t *taps, int tap_count);
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Long-running check for slow degradation: once the UI is complete, randomized
+// taps (letters, long presses on them, space, shift, 123, clear, accept) go through
+// a virtual pointer into the real event path (blob_key_event_cb,
+// action_button_event_cb, accept_input, clear_input) on a virtual clock, as fast
+// as the board renders. Every SOAK_TEST_SAMPLE_KEYS keystrokes lv_mem_monitor, the
+// system heap and the throughput are sampled and logged. At the end, the first and
+// the last third of the samples (after a warm-up) are compared: the test fails when
+// the LVGL heap's floor grew, the system heap's ceiling dropped, fragmentation rose
+// or throughput fell.
+// Enable with '-D SOAK_TEST=1'; the document journal is not written meanwhile (it
+// would wear the flash, and the soak trims the document)
+#ifndef SOAK_TEST
+#define SOAK_TEST 0
+#endif
+
+#ifndef SOAK_TEST_KEYSTROKES
+#define SOAK_TEST_KEYSTROKES 1000000
+#endif
+#define SOAK_TEST_SAMPLES 100
+#define SOAK_TEST_SAMPLE_KEYS (SOAK_TEST_KEYSTROKES / SOAK_TEST_SAMPLES)
+#define SOAK_TEST_WARMUP_SAMPLES (SOAK_TEST_SAMPLES / 10)
+#define SOAK_TEST_BATCH 64 // Keystrokes per soak_test_poll
+
+// Virtual time per frame, frames a key is held (and held for a long press) and frames between two taps
+#define SOAK_TEST_FRAME_MS 16
+#define SOAK_TEST_HOLD_FRAMES 3
+#define SOAK_TEST_LONG_PRESS_FRAMES 32
+#define SOAK_TEST_LONG_PRESS_EVERY 64
+#define SOAK_TEST_IDLE_FRAMES 3
+
+// The document is cleared past this size, so its text doesn't count as growth
+#define SOAK_TEST_DOCUMENT_MAX 2048
+// Tolerances of the verdict
+#define SOAK_TEST_HEAP_SLACK 1024     // Bytes
+#define SOAK_TEST_FRAG_SLACK_PCT 10   // Percentage points
+#define SOAK_TEST_RATE_SLACK_PCT 10   // Percent of the throughput
+
+// Where the next keystroke taps (screen coordinates), chosen from random
+typedef void (*soak_test_tap_cb_t)(uint32_t random, lv_point_t *point);
+
+void soak_test_start(lv_display_t *disp, soak_test_tap_cb_t tap_cb);
+// Run a batch of keystrokes (from loop, it runs LVGL itself); false when no soak is running
+bool soak_test_poll();
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+// Touch pre-processing for the resistive boards (XPT2046): an esp_timer samples the
+// panel every TOUCH_FILTER_SAMPLE_MS, whatever LVGL is doing, into a lock-free ring.
+// At each input read, LVGL runs the samples since the last one through plausibility
+// rejection, a median of 3, an IIR low pass and a press / release debounce, all in
+// integer arithmetic, and reads the filtered point.
+// Enable with '-D TOUCH_FILTER=1'
+#ifndef TOUCH_FILTER
+#define TOUCH_FILTER 0
+#endif
+
+#define TOUCH_FILTER_SAMPLE_MS 5
+// Raw samples waiting for LVGL's next read; a power of 2 (160 ms at 5 ms)
+#define TOUCH_FILTER_RING_SIZE 32
+// IIR weight of a new sample, in 1/256 (higher follows faster, lower is smoother)
+#define TOUCH_FILTER_IIR_ALPHA 96
+// Consecutive samples before a press / a release is reported
+#define TOUCH_FILTER_PRESS_SAMPLES 2
+#define TOUCH_FILTER_RELEASE_SAMPLES 3
+// Largest plausible move between two samples; farther samples are dropped as noise,
+// unless TOUCH_FILTER_JUMP_SAMPLES of them come in a row (the finger did move)
+#define TOUCH_FILTER_MAX_JUMP 24
+#define TOUCH_FILTER_JUMP_SAMPLES 3
+// Interval of the filter statistics report on the serial log
+#define TOUCH_FILTER_REPORT_MS 5000
+
+// State of one filter, no hardware or LVGL dependencies (can be run on recorded traces)
+typedef struct
+{
+    int32_t width, height; // Panel bounds, samples outside are rejected
+    int32_t med_x[3], med_y[3];
+    int med_count;
+    int32_t iir_x, iir_y; // Q4
+    int32_t last_x, last_y; // Last accepted sample
+    int press_count;
+    int release_count;
+    int jump_count;
+    bool pressed; // Debounced state
+    uint32_t samples;
+    uint32_t rejected;
+} touch_filter_t;
+
+void touch_filter_reset(touch_filter_t *f, int32_t width, int32_t height);
+// Feed one raw sample; returns the debounced state, the filtered point in (x, y)
+bool touch_filter_process(touch_filter_t *f, bool pressed, int32_t raw_x, int32_t raw_y, int32_t *x, int32_t *y);
+
+// Sample indev's read callback (esp32-smartdisplay's, including its calibration)
+// from an esp_timer and make indev read the filtered result
+void touch_filter_init(lv_indev_t *indev);
+// Observer of the raw samples, called from LVGL's read in sampling order with the
+// time each was taken (the touch trace records them)
+typedef void (*touch_filter_sample_cb_t)(uint32_t t_ms, bool pressed, int32_t x, int32_t y);
+void touch_filter_set_sample_cb(touch_filter_sample_cb_t cb);
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Multi-touch rollover for the capacitive boards: every touch point the controller
+// reports is tracked as its own contact. LVGL's pointer follows the first contact
+// (the primary) as before; further contacts that land on a registered key are
+// reported to a callback, each with its own position, so overlapping presses on
+// different keys are typed in the order the fingers lift.
+// Enable with '-D TOUCH_ROLLOVER=1' (the touch driver must keep more than one point,
+// CONFIG_ESP_LCD_TOUCH_MAX_POINTS of platformio.ini)
+#ifndef TOUCH_ROLLOVER
+#define TOUCH_ROLLOVER 0
+#endif
+
+// Both take over the read callback of the touch input device (and the filter is for
+// the resistive panels, which report a single point)
+#if TOUCH_ROLLOVER && TOUCH_FILTER
+#error "TOUCH_ROLLOVER and TOUCH_FILTER cannot be enabled together"
+#endif
+
+#define TOUCH_ROLLOVER_MAX_CONTACTS 5
+#define TOUCH_ROLLOVER_MAX_KEYS 16
+// Farthest a contact moves between two reads; a point farther from every contact is a new finger
+#define TOUCH_ROLLOVER_MATCH_RADIUS 48
+
+typedef enum
+{
+    TOUCH_ROLLOVER_PRESSED,
+    TOUCH_ROLLOVER_MOVED,
+    TOUCH_ROLLOVER_RELEASED, // point is the last position of the contact
+} touch_rollover_phase_t;
+
+// A non-primary contact on key (screen coordinates)
+typedef void (*touch_rollover_cb_t)(lv_obj_t *key, const lv_point_t *point, touch_rollover_phase_t phase);
+
+// Take over the read callback of the touch input device of esp32-smartdisplay
+bool touch_rollover_init(lv_indev_t *indev, touch_rollover_cb_t cb);
+void touch_rollover_add_key(lv_obj_t *key);
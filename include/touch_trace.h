@@ -0,0 +1,42 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Recorder of the raw touch samples, with their timestamps, for replaying a field
+// report or a regression as a benchmark. With TOUCH_FILTER the samples are taken
+// before the filter and filtered again in a replay, so a change to the filter can
+// be tried on the same trace. Samples are delta encoded (a flag byte, the
+// milliseconds since the previous sample and the zigzag movement as varints, about
+// 4 bytes per sample) into a RAM ring of fixed size slots; each slot
+// starts with an absolute keyframe, so the oldest slot can be dropped when full.
+// The ring can be saved to / loaded from flash (LittleFS) and dumped as hex on the
+// serial port. A replay feeds the samples through an event driven pointer, on a
+// virtual clock taken from the timestamps, so the same keys see the same events
+// (blob_key_event_cb etc.) as fast as the board can render them.
+// Enable with '-D TOUCH_TRACE=1'; commands are read from the serial port:
+//   r replay the ring, s save it to flash, l load from flash and replay, d dump, c clear
+#ifndef TOUCH_TRACE
+#define TOUCH_TRACE 0
+#endif
+
+#define TOUCH_TRACE_SLOT_SIZE 128 // Bytes per slot, the first one holds the used length
+#define TOUCH_TRACE_SLOTS 64
+#define TOUCH_TRACE_PATH "/touch.trc"
+
+// Record the raw samples of indev: those of TOUCH_FILTER, else what indev delivers to
+// LVGL (the primary contact of TOUCH_ROLLOVER: call after those stages took over the
+// read callback)
+void touch_trace_init(lv_indev_t *indev);
+// Each sample of the ring as a replay delivers it to LVGL, in order: through a fresh
+// touch filter of width x height first (TOUCH_FILTER, unless the trace was recorded
+// after the filter). False on a malformed record
+typedef void (*touch_trace_sample_cb_t)(uint32_t t_ms, const lv_indev_data_t *data, void *user_data);
+bool touch_trace_decode(int32_t width, int32_t height, touch_trace_sample_cb_t cb, void *user_data);
+// Replay the ring on disp; returns the number of samples
+uint32_t touch_trace_replay(lv_display_t *disp);
+bool touch_trace_save(const char *path);
+bool touch_trace_load(const char *path);
+void touch_trace_dump();
+void touch_trace_clear();
+// Handle a pending command from the serial port (call from loop)
+void touch_trace_poll_serial(lv_display_t *disp);
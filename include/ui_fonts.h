@@ -0,0 +1,20 @@
+#pragma once
+
+#include <lvgl.h>
+
+// The fonts of the UI. With UI_FONTS (on by default, see lv_conf.h) they are
+// subsets of Montserrat holding only the characters the UI can draw: the keymaps,
+// the alternates, the labels and the LV_SYMBOL_* in use. tools/ui_fonts.py
+// generates them into src/generated/ui_fonts.c before every build, and fails the
+// build when a character is missing. Their ASCII glyphs are indexed directly by
+// the code point. With EMOJI_LAYER, characters they lack come from emoji_font.
+// Disable with '-D UI_FONTS=0' for the full built-in fonts
+#if UI_FONTS
+#define UI_FONT_14 (&ui_font_14)
+#define UI_FONT_18 (&ui_font_18)
+#define UI_FONT_20 (&ui_font_20)
+#else
+#define UI_FONT_14 (&lv_font_montserrat_14)
+#define UI_FONT_18 (&lv_font_montserrat_18)
+#define UI_FONT_20 (&lv_font_montserrat_20)
+#endif
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdint.h>
+
+// Screen geometry computed at compile time from the board's resolution.
+// The design is tuned for 320x480 portrait: horizontal sizes scale with the
+// width, vertical sizes with the height, radii and padding with the smaller
+// of the two. Keyboard rows are positions inside the keyboard area's content
+// box (inside its padding). Font-bound sizes (cursors, letters) don't scale.
+
+// From the board definition of esp32-smartdisplay
+#ifndef DISPLAY_WIDTH
+#define DISPLAY_WIDTH 320
+#endif
+#ifndef DISPLAY_HEIGHT
+#define DISPLAY_HEIGHT 480
+#endif
+
+#define UI_LAYOUT_REF_WIDTH 320
+#define UI_LAYOUT_REF_HEIGHT 480
+
+constexpr int32_t ui_scale(int32_t v, int32_t size, int32_t ref) { return v * size / ref; }
+constexpr int32_t ui_scale_min(int32_t v, int32_t w, int32_t h)
+{
+    return w * UI_LAYOUT_REF_HEIGHT < h * UI_LAYOUT_REF_WIDTH ? ui_scale(v, w, UI_LAYOUT_REF_WIDTH) : ui_scale(v, h, UI_LAYOUT_REF_HEIGHT);
+}
+
+template <int32_t W, int32_t H>
+struct ui_layout
+{
+    static constexpr int32_t width = W;
+    static constexpr int32_t height = H;
+
+    static constexpr int32_t status_bar_height = ui_scale(20, H, UI_LAYOUT_REF_HEIGHT);
+    static constexpr int32_t text_area_height = ui_scale(140, H, UI_LAYOUT_REF_HEIGHT); // 150 in web simulator but 140 in the diagram.
+    static constexpr int32_t keyboard_y = status_bar_height + text_area_height;
+    static constexpr int32_t keyboard_height = H - keyboard_y;
+
+    static constexpr int32_t keyboard_padding = ui_scale_min(9, W, H);
+    static constexpr int32_t inner_width = W - 2 * keyboard_padding;
+    static constexpr int32_t inner_height = keyboard_height - 2 * keyboard_padding;
+
+    static constexpr int32_t top_row_height = ui_scale(45, H, UI_LAYOUT_REF_HEIGHT);
+    static constexpr int32_t bottom_row_height = ui_scale(40, H, UI_LAYOUT_REF_HEIGHT);
+    static constexpr int32_t key_row_v_gap = ui_scale(12, H, UI_LAYOUT_REF_HEIGHT);
+    static constexpr int32_t top_row_h_gap = ui_scale(20, W, UI_LAYOUT_REF_WIDTH);
+    static constexpr int32_t bottom_row_h_gap = ui_scale(18, W, UI_LAYOUT_REF_WIDTH);
+    static constexpr int32_t action_btn_width = ui_scale(60, W, UI_LAYOUT_REF_WIDTH);
+    static constexpr int32_t key_radius = ui_scale_min(10, W, H);
+    static constexpr int32_t input_radius = ui_scale_min(5, W, H);
+
+    static constexpr int32_t blob_key_width = ui_scale(62, W, UI_LAYOUT_REF_WIDTH);
+    static constexpr int32_t blob_key_height = ui_scale(50, H, UI_LAYOUT_REF_HEIGHT);
+    static constexpr int32_t blob_key_h_gap = (inner_width - 4 * blob_key_width) / 3;
+
+    // Row positions
+    static constexpr int32_t top_row_y = 0;
+    static constexpr int32_t blob_row_y = top_row_y + top_row_height + key_row_v_gap; // First of 3 rows
+    static constexpr int32_t blob_row_pitch = blob_key_height + key_row_v_gap;
+    static constexpr int32_t blob_rows_end = blob_row_y + 2 * blob_row_pitch + blob_key_height;
+    static constexpr int32_t bottom_row_y = inner_height - bottom_row_height; // Anchored to the bottom
+
+    static constexpr int32_t input_width = inner_width - 2 * action_btn_width - 2 * top_row_h_gap;
+    static constexpr int32_t space_width = inner_width - 2 * action_btn_width - 2 * bottom_row_h_gap;
+
+    // Every key inside the keyboard's content box and no two keys touching
+    static constexpr bool valid =
+        status_bar_height > 0 && text_area_height > 0 && inner_width > 0 && inner_height > 0 &&
+        // Top and bottom rows: action key, gap, middle key, gap, action key
+        input_width > 0 && space_width > 0 && top_row_h_gap > 0 && bottom_row_h_gap > 0 &&
+        // Blob keys: 4 per row with equal gaps
+        blob_key_width > 0 && blob_key_height > 0 && blob_key_h_gap > 0 &&
+        4 * blob_key_width + 3 * blob_key_h_gap <= inner_width &&
+        // Rows stacked without overlap, the bottom row inside the padding
+        key_row_v_gap > 0 && blob_rows_end + key_row_v_gap <= bottom_row_y && bottom_row_y + bottom_row_height <= inner_height &&
+        // Rounded corners fit the keys
+        2 * key_radius <= blob_key_height && 2 * key_radius <= bottom_row_height && 2 * key_radius <= action_btn_width;
+};
+
+// Every resolution of the environments in platformio.ini
+static_assert(ui_layout<170, 320>::valid, "Invalid layout for 170x320 (esp32-1732S019*)");
+static_assert(ui_layout<240, 240>::valid, "Invalid layout for 240x240 (esp32-2424S012*)");
+static_assert(ui_layout<240, 320>::valid, "Invalid layout for 240x320 (esp32-2432S0*)");
+static_assert(ui_layout<320, 480>::valid, "Invalid layout for 320x480 (esp32-3248S035*)");
+static_assert(ui_layout<480, 272>::valid, "Invalid layout for 480x272 (esp32-4827S043*)");
+static_assert(ui_layout<480, 480>::valid, "Invalid layout for 480x480 (esp32-4848S040*)");
+static_assert(ui_layout<800, 480>::valid, "Invalid layout for 800x480 (esp32-8048S0*, esp32-s3touchlcd7)");
+
+typedef ui_layout<DISPLAY_WIDTH, DISPLAY_HEIGHT> board_layout;
+static_assert(board_layout::valid, "Invalid layout for this board's resolution");
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// After WARM_RESUME_IDLE_MS without a touch, the UI state (layer, input field and
+// document) is saved to RTC memory, which keeps its contents in deep sleep, and the
+// board goes to deep sleep until the BOOT button is pressed. On that wake, setup()
+// builds the keys and applies the saved state before the first frame, so the screen
+// comes back as it was; everything else (the journal, the touch stages) follows.
+// The cursors are not saved: they always follow the end of their text. The backlight
+// is off while asleep and a touch does not wake the board: only the BOOT button does.
+// Enable with '-D WARM_RESUME=1'
+#ifndef WARM_RESUME
+#define WARM_RESUME 0
+#endif
+
+#define WARM_RESUME_IDLE_MS (5 * 60 * 1000)
+#define WARM_RESUME_WAKE_GPIO GPIO_NUM_0 // BOOT button, on every board
+// RTC slow memory is 8 kB; a longer document is restored from the journal instead
+#define WARM_RESUME_SNAPSHOT_SIZE 4096
+
+typedef struct
+{
+    uint8_t layer;
+    const char *input;
+    const char *document; // NULL: not in the snapshot
+} ui_state_t;
+
+// Serialize state into buf; returns the snapshot size, 0 when even without the
+// document it doesn't fit. The document is left out when it doesn't fit.
+uint32_t ui_snapshot_encode(const ui_state_t *state, uint8_t *buf, uint32_t size);
+// Check and parse a snapshot; the strings of state point into buf
+bool ui_snapshot_decode(const uint8_t *buf, uint32_t size, ui_state_t *state);
+
+// The state saved before the deep sleep this boot woke from (false on any other boot)
+bool warm_resume_get(ui_state_t *state);
+// Save state and enter deep sleep, does not return
+void warm_resume_sleep(const ui_state_t *state);
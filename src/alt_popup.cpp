@@ -0,0 +1,170 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include <string.h>
+#include "flush_hooks.h"
+#include "alt_popup.h"
+
+static lv_obj_t *popup;
+static lv_obj_t *cells[ALT_POPUP_MAX_CELLS];
+static char cell_text[ALT_POPUP_MAX_CELLS][5]; // UTF-8, the cells show these (lv_label_set_text_static)
+static int cell_count = 0;
+static int selected = -1;
+static lv_coord_t cell_w;
+static lv_coord_t cell_h;
+static lv_coord_t popup_x; // Screen x of the open popup
+
+static lv_style_t style_popup;
+static lv_style_t style_cell;
+static lv_style_t style_cell_selected;
+
+// Long press to first flushed pixel of the popup
+static uint32_t open_us = 0; // 0: nothing pending
+static lv_area_t open_area;
+
+// Adds the first character of text, returns the rest
+static const char *add_cell(const char *text)
+{
+    uint8_t lead = (uint8_t)*text;
+    size_t len = lead < 0x80 ? 1 : lead < 0xe0 ? 2 : lead < 0xf0 ? 3 : 4;
+    if (strnlen(text, len) < len)
+        return "";
+    if (cell_count < ALT_POPUP_MAX_CELLS)
+    {
+        memcpy(cell_text[cell_count], text, len);
+        cell_text[cell_count][len] = '\0';
+        lv_label_set_text_static(cells[cell_count], cell_text[cell_count]);
+        lv_obj_remove_flag(cells[cell_count], LV_OBJ_FLAG_HIDDEN);
+        cell_count++;
+    }
+    return text + len;
+}
+
+static void set_selected(int index)
+{
+    if (index == selected)
+        return;
+    if (selected >= 0)
+        lv_obj_remove_state(cells[selected], LV_STATE_CHECKED);
+    lv_obj_add_state(cells[index], LV_STATE_CHECKED);
+    selected = index;
+}
+
+static void popup_flush_filter(const lv_area_t *area, uint16_t *px_map, void *user_data)
+{
+    lv_area_t common;
+    if (!open_us || !lv_area_intersect(&common, &open_area, area))
+        return;
+
+    log_i("Alternates popup: first pixel %lu us after the long press", (unsigned long)(micros() - open_us));
+    open_us = 0;
+}
+
+void alt_popup_init(lv_coord_t cell_width, lv_coord_t cell_height, const lv_font_t *font,
+                    lv_color_t color, lv_color_t selected_color)
+{
+    cell_w = cell_width;
+    cell_h = cell_height;
+
+    lv_style_init(&style_popup);
+    lv_style_set_bg_color(&style_popup, lv_color_hex(0x000000));
+    lv_style_set_bg_opa(&style_popup, LV_OPA_COVER);
+    lv_style_set_border_color(&style_popup, color);
+    lv_style_set_border_width(&style_popup, 2);
+    lv_style_set_radius(&style_popup, 6);
+    lv_style_set_pad_all(&style_popup, 0);
+
+    // Fixed size cells, text centered by padding: a new character never resizes them
+    lv_style_init(&style_cell);
+    lv_style_set_text_font(&style_cell, font);
+    lv_style_set_text_color(&style_cell, color);
+    lv_style_set_text_align(&style_cell, LV_TEXT_ALIGN_CENTER);
+    lv_style_set_pad_top(&style_cell, (cell_h - lv_font_get_line_height(font)) / 2);
+    lv_style_set_radius(&style_cell, 4);
+
+    lv_style_init(&style_cell_selected);
+    lv_style_set_bg_color(&style_cell_selected, selected_color);
+    lv_style_set_bg_opa(&style_cell_selected, LV_OPA_COVER);
+    lv_style_set_text_color(&style_cell_selected, lv_color_hex(0x000000));
+
+    popup = lv_obj_create(lv_layer_top());
+    lv_obj_remove_style_all(popup);
+    lv_obj_add_style(popup, &style_popup, 0);
+    lv_obj_remove_flag(popup, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_remove_flag(popup, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(popup, LV_OBJ_FLAG_HIDDEN);
+
+    for (int i = 0; i < ALT_POPUP_MAX_CELLS; i++)
+    {
+        cells[i] = lv_label_create(popup);
+        lv_obj_remove_style_all(cells[i]);
+        lv_obj_add_style(cells[i], &style_cell, 0);
+        lv_obj_add_style(cells[i], &style_cell_selected, LV_STATE_CHECKED);
+        lv_obj_set_size(cells[i], cell_w, cell_h);
+        lv_obj_set_pos(cells[i], i * cell_w, 0);
+        lv_label_set_text_static(cells[i], "");
+    }
+
+    flush_hooks_add_filter(popup_flush_filter, NULL);
+}
+
+bool alt_popup_open(const char *character, const char *alternates, const lv_area_t *anchor, lv_coord_t anchor_x)
+{
+    if (!popup || !alternates || !*character)
+        return false;
+
+    uint32_t start = micros();
+
+    cell_count = 0;
+    add_cell(character);
+    while (*alternates)
+        alternates = add_cell(alternates);
+    for (int i = cell_count; i < ALT_POPUP_MAX_CELLS; i++)
+        lv_obj_add_flag(cells[i], LV_OBJ_FLAG_HIDDEN);
+    selected = -1;
+    set_selected(0);
+
+    // Above the anchor, kept on the screen
+    lv_coord_t border = lv_obj_get_style_border_width(popup, 0);
+    lv_coord_t w = cell_count * cell_w + 2 * border;
+    lv_coord_t h = cell_h + 2 * border;
+    lv_display_t *disp = lv_obj_get_display(popup);
+    lv_coord_t x = LV_CLAMP(0, anchor_x - w / 2, lv_display_get_horizontal_resolution(disp) - w);
+    lv_coord_t y = LV_MAX(0, anchor->y1 - h);
+    lv_obj_set_pos(popup, x, y);
+    popup_x = x;
+    lv_obj_set_size(popup, w, h);
+    lv_obj_remove_flag(popup, LV_OBJ_FLAG_HIDDEN);
+
+    lv_area_set(&open_area, x, y, x + w - 1, y + h - 1);
+    open_us = start | 1; // Never 0
+    return true;
+}
+
+void alt_popup_select(const lv_point_t *point)
+{
+    if (!alt_popup_is_open())
+        return;
+
+    lv_coord_t x = point->x - popup_x - lv_obj_get_style_border_width(popup, 0);
+    set_selected(LV_CLAMP(0, x / cell_w, cell_count - 1));
+}
+
+const char *alt_popup_close()
+{
+    if (!alt_popup_is_open())
+        return NULL;
+
+    lv_obj_add_flag(popup, LV_OBJ_FLAG_HIDDEN);
+    open_us = 0;
+    return cell_text[selected];
+}
+
+bool alt_popup_is_open()
+{
+    return popup && !lv_obj_has_flag(popup, LV_OBJ_FLAG_HIDDEN);
+}
+
+lv_obj_t *alt_popup_get_obj()
+{
+    return popup;
+}
@@ -0,0 +1,60 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include "boot_trace.h"
+#include "flush_hooks.h"
+
+typedef struct
+{
+    const char *name;
+    uint32_t us;
+} boot_phase_t;
+
+static boot_phase_t phases[BOOT_TRACE_MAX_PHASES];
+static int phase_count;
+static uint32_t watch_transactions; // Panel transactions when the watch started
+static bool first_frame_done;
+static bool first_key_done;
+
+void boot_trace_mark(const char *name)
+{
+    if (phase_count == BOOT_TRACE_MAX_PHASES)
+        return;
+    phases[phase_count].name = name;
+    phases[phase_count].us = micros();
+    phase_count++;
+}
+
+static void first_frame_event_cb(lv_event_t *e)
+{
+    // Refreshes without anything to draw finish too, wait for pixels
+    if (first_frame_done || flush_hooks_get_stats()->transactions == watch_transactions)
+        return;
+    first_frame_done = true;
+    boot_trace_mark("first frame");
+}
+
+void boot_trace_watch_first_frame(lv_display_t *disp)
+{
+    watch_transactions = flush_hooks_get_stats()->transactions;
+    lv_display_add_event_cb(disp, first_frame_event_cb, LV_EVENT_REFR_READY, NULL);
+}
+
+void boot_trace_first_key()
+{
+    if (first_key_done)
+        return;
+    first_key_done = true;
+    boot_trace_mark("first key");
+    boot_trace_report();
+}
+
+void boot_trace_report()
+{
+    uint32_t last_us = 0;
+    for (int i = 0; i < phase_count; i++)
+    {
+        log_i("Boot: %-16s at %6lu ms (+%lu.%03lu ms)", phases[i].name, (unsigned long)(phases[i].us / 1000),
+              (unsigned long)((phases[i].us - last_us) / 1000), (unsigned long)((phases[i].us - last_us) % 1000));
+        last_us = phases[i].us;
+    }
+}
@@ -0,0 +1,184 @@
+#include <Arduino.h>
+#include <lvgl.h>
+// The draw buffer set up by esp32-smartdisplay is not reachable through the public API
+#include "src/display/lv_display_private.h"
+#include "flush_hooks.h"
+#include "color_l8.h"
+
+typedef struct
+{
+    lv_obj_t *obj;
+    int32_t inset;
+    lv_area_t area; // Updated at each converted chunk
+    uint16_t lut[256];
+} region_t;
+
+static region_t regions[COLOR_L8_MAX_REGIONS];
+static int region_count = 0;
+static uint16_t lut_gray[256];
+
+static uint8_t lerp(uint8_t a, uint8_t b, uint32_t num, uint32_t den)
+{
+    return a + ((int32_t)b - a) * (int32_t)num / (int32_t)den;
+}
+
+static void build_lut(uint16_t *lut, lv_color_t ink)
+{
+    // Piecewise linear: black -> ink -> white, with the ink at COLOR_L8_INK_LEVEL
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        lv_color_t c;
+        if (i <= COLOR_L8_INK_LEVEL)
+            c = lv_color_make(lerp(0, ink.red, i, COLOR_L8_INK_LEVEL), lerp(0, ink.green, i, COLOR_L8_INK_LEVEL),
+                              lerp(0, ink.blue, i, COLOR_L8_INK_LEVEL));
+        else
+        {
+            uint32_t n = i - COLOR_L8_INK_LEVEL, d = 255 - COLOR_L8_INK_LEVEL;
+            c = lv_color_make(lerp(ink.red, 255, n, d), lerp(ink.green, 255, n, d), lerp(ink.blue, 255, n, d));
+        }
+        lut[i] = lv_color_to_u16(c);
+    }
+}
+
+static void update_region_areas()
+{
+    for (int i = 0; i < region_count; i++)
+    {
+        region_t *r = &regions[i];
+        if (!r->obj)
+            continue;
+
+        lv_obj_get_coords(r->obj, &r->area);
+        lv_area_increase(&r->area, -r->inset, -r->inset);
+    }
+}
+
+static void expand_row(const uint8_t *src, uint16_t *dest, int32_t x1, int32_t x2, int32_t y)
+{
+    // Regions crossing this row, topmost first
+    const region_t *hits[COLOR_L8_MAX_REGIONS];
+    int n = 0;
+    for (int i = region_count - 1; i >= 0; i--)
+    {
+        const region_t *r = &regions[i];
+        if (r->obj && y >= r->area.y1 && y <= r->area.y2 && r->area.x1 <= x2 && r->area.x2 >= x1)
+            hits[n++] = r;
+    }
+
+    // Runs of pixels with the same table
+    int32_t x = x1;
+    while (x <= x2)
+    {
+        const uint16_t *lut = lut_gray;
+        int32_t end = x2;
+        for (int k = 0; k < n; k++)
+        {
+            const lv_area_t *a = &hits[k]->area;
+            if (x >= a->x1 && x <= a->x2)
+            {
+                lut = hits[k]->lut;
+                end = LV_MIN(end, a->x2);
+                break;
+            }
+            if (a->x1 > x)
+                end = LV_MIN(end, a->x1 - 1);
+        }
+
+        for (; x <= end; x++)
+            *dest++ = lut[*src++];
+    }
+}
+
+static void convert_cb(const lv_area_t *area, const uint8_t *src, uint16_t *dest)
+{
+    update_region_areas();
+
+    lv_coord_t w = lv_area_get_width(area);
+    for (lv_coord_t y = area->y1; y <= area->y2; y++, src += w, dest += w)
+        expand_row(src, dest, area->x1, area->x2, y);
+}
+
+// The size of a draw buffer set by esp32-smartdisplay, which then frees it
+static uint32_t release_buf(lv_draw_buf_t *draw_buf)
+{
+    if (!draw_buf)
+        return 0;
+    heap_caps_free(draw_buf->unaligned_data);
+    return draw_buf->data_size;
+}
+
+bool color_l8_init(lv_display_t *disp)
+{
+    build_lut(lut_gray, COLOR_L8_INK);
+
+    if (disp->render_mode != LV_DISPLAY_RENDER_MODE_PARTIAL || !disp->buf_1)
+    {
+        log_e("8 bit mode needs a partial render buffer");
+        return false;
+    }
+
+    // The same pixels as the RGB565 buffers in half their bytes, as many buffers, and
+    // a few rows of RGB565 to convert into for the panel
+    lv_draw_buf_t *buf_1 = disp->buf_1;
+    lv_draw_buf_t *buf_2 = disp->buf_2;
+    uint32_t render_size = buf_1->data_size / sizeof(uint16_t);
+    uint32_t staging_px = COLOR_L8_STAGING_ROWS * lv_display_get_horizontal_resolution(disp);
+    uint8_t *render_1 = (uint8_t *)heap_caps_malloc(render_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    uint8_t *render_2 = buf_2 ? (uint8_t *)heap_caps_malloc(render_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) : NULL;
+    uint16_t *staging = (uint16_t *)heap_caps_malloc(2 * staging_px * sizeof(uint16_t), MALLOC_CAP_DMA);
+    if (!render_1 || (buf_2 && !render_2) || !staging)
+    {
+        log_e("8 bit mode: out of memory for its buffers");
+        heap_caps_free(render_1);
+        heap_caps_free(render_2);
+        heap_caps_free(staging);
+        return false;
+    }
+
+    lv_display_set_buffers(disp, render_1, render_2, render_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    flush_hooks_set_converter(convert_cb, staging, staging_px);
+    uint32_t before = release_buf(buf_1) + release_buf(buf_2);
+    uint32_t after = (render_2 ? 2 : 1) * render_size + 2 * staging_px * sizeof(uint16_t);
+
+    log_i("8 bit mode: draw buffers %lu bytes (%lu bytes at 16 bit): %d x %lu bytes render, 2 x %lu px staging",
+          (unsigned long)after, (unsigned long)before, render_2 ? 2 : 1, (unsigned long)render_size,
+          (unsigned long)staging_px);
+    return true;
+}
+
+int color_l8_add_region(lv_obj_t *obj, lv_color_t ink, int32_t inset)
+{
+    if (region_count >= COLOR_L8_MAX_REGIONS)
+    {
+        log_e("Too many 8 bit colour regions");
+        return -1;
+    }
+
+    region_t *r = &regions[region_count];
+    r->obj = obj;
+    r->inset = inset;
+    build_lut(r->lut, ink);
+    if (obj)
+        lv_obj_invalidate(obj);
+    return region_count++;
+}
+
+void color_l8_set_region_obj(int id, lv_obj_t *obj)
+{
+    if (id < 0 || id >= region_count || regions[id].obj == obj)
+        return;
+
+    if (regions[id].obj)
+        lv_obj_invalidate(regions[id].obj);
+    regions[id].obj = obj;
+    if (obj)
+        lv_obj_invalidate(obj);
+}
+
+lv_obj_t *color_l8_get_region_obj(int id)
+{
+    if (id < 0 || id >= region_count)
+        return NULL;
+
+    return regions[id].obj;
+}
@@ -0,0 +1,145 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include "flush_hooks.h"
+#include "cursor_overlay.h"
+
+typedef struct
+{
+    uint16_t color;
+    lv_coord_t width;
+    lv_coord_t height;
+    lv_area_t area;         // Visible (clipped) rectangle in screen coordinates
+    bool placed;            // area is valid
+    uint32_t captured[32];  // Per row of area, bit per column whose background is in bg
+    uint16_t bg[CURSOR_OVERLAY_MAX_PX];
+} cursor_t;
+
+static cursor_t cursors[CURSOR_OVERLAY_MAX_CURSORS];
+static int cursor_count = 0;
+static bool cursors_visible = false;
+static uint16_t blink_buf[CURSOR_OVERLAY_MAX_PX];
+
+// Bits of n columns from the first one
+static uint32_t columns(lv_coord_t first, lv_coord_t n)
+{
+    return (n >= 32 ? 0xFFFFFFFF : (1u << n) - 1) << first;
+}
+
+static bool all_captured(const cursor_t *c)
+{
+    uint32_t row = columns(0, lv_area_get_width(&c->area));
+    for (lv_coord_t y = 0; y < lv_area_get_height(&c->area); y++)
+        if (c->captured[y] != row)
+            return false;
+    return true;
+}
+
+static void cursor_flush_filter(const lv_area_t *area, uint16_t *px_map, void *user_data)
+{
+    lv_coord_t stride = lv_area_get_width(area);
+
+    for (int i = 0; i < cursor_count; i++)
+    {
+        cursor_t *c = &cursors[i];
+        lv_area_t common;
+        if (!c->placed || !lv_area_intersect(&common, &c->area, area))
+            continue;
+
+        // An invalidated area can end inside the cursor: its other columns are
+        // captured by another block
+        lv_coord_t cursor_w = lv_area_get_width(&c->area);
+        lv_coord_t n = lv_area_get_width(&common);
+        for (lv_coord_t y = common.y1; y <= common.y2; y++)
+        {
+            uint16_t *px = px_map + (y - area->y1) * stride + (common.x1 - area->x1);
+            uint16_t *bg = c->bg + (y - c->area.y1) * cursor_w + (common.x1 - c->area.x1);
+
+            // LVGL just rendered the real background here: keep it for the blinks
+            memcpy(bg, px, n * sizeof(uint16_t));
+            c->captured[y - c->area.y1] |= columns(common.x1 - c->area.x1, n);
+
+            if (cursors_visible)
+                for (lv_coord_t x = 0; x < n; x++)
+                    px[x] = c->color;
+        }
+    }
+}
+
+void cursor_overlay_init()
+{
+    flush_hooks_add_filter(cursor_flush_filter, NULL);
+}
+
+int cursor_overlay_add(lv_color_t color, lv_coord_t width, lv_coord_t height)
+{
+    if (cursor_count >= CURSOR_OVERLAY_MAX_CURSORS || width * height > CURSOR_OVERLAY_MAX_PX || width > 32 || height > 32)
+    {
+        log_e("Cannot add a %dx%d cursor", width, height);
+        return -1;
+    }
+
+    cursor_t *c = &cursors[cursor_count];
+    c->color = lv_color_to_u16(color);
+    c->width = width;
+    c->height = height;
+    c->placed = false;
+    memset(c->captured, 0, sizeof(c->captured));
+    return cursor_count++;
+}
+
+void cursor_overlay_move(int id, lv_coord_t x, lv_coord_t y, const lv_area_t *clip)
+{
+    if (id < 0 || id >= cursor_count)
+        return;
+
+    cursor_t *c = &cursors[id];
+    lv_display_t *disp = lv_display_get_default();
+    lv_area_t area = {x, y, x + c->width - 1, y + c->height - 1};
+    bool visible = lv_area_intersect(&area, &area, clip);
+
+    if (c->placed && visible && memcmp(&area, &c->area, sizeof(area)) == 0)
+        return;
+
+    // Let LVGL restore what was under the old position
+    if (c->placed)
+        lv_inv_area(disp, &c->area);
+
+    c->placed = visible;
+    memset(c->captured, 0, sizeof(c->captured));
+    if (visible)
+    {
+        // Rendered once by LVGL so the filter captures the new background
+        c->area = area;
+        lv_inv_area(disp, &c->area);
+    }
+}
+
+uint32_t cursor_overlay_blink()
+{
+    cursors_visible = !cursors_visible;
+
+    uint32_t written = 0;
+    for (int i = 0; i < cursor_count; i++)
+    {
+        cursor_t *c = &cursors[i];
+        // Not rendered yet at this position: the next flush will paint it
+        if (!c->placed || !all_captured(c))
+            continue;
+
+        uint32_t n = lv_area_get_size(&c->area);
+        if (cursors_visible)
+        {
+            for (uint32_t p = 0; p < n; p++)
+                blink_buf[p] = c->color;
+        }
+        else
+        {
+            memcpy(blink_buf, c->bg, n * sizeof(uint16_t));
+        }
+
+        flush_hooks_write(&c->area, blink_buf);
+        written += n;
+    }
+
+    return written;
+}
@@ -0,0 +1,517 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <esp_rom_crc.h>
+#include <lvgl.h>
+#include "doc_journal.h"
+#include "doc_store.h"
+
+#define RECORD_MAGIC 0xA5
+#define RECORD_PADDING 0xFF // The rest of the page is unused
+
+enum
+{
+    RECORD_SNAPSHOT = 1,        // The whole document (older journals, still read)
+    RECORD_APPEND = 2,          // Text appended to it
+    RECORD_COMMIT = 3,          // The segment is complete, it replaces the other one
+    RECORD_SNAPSHOT_FRAMES = 4, // The whole document in compressed frames
+};
+
+// Followed by the payload and the CRC32 of header and payload
+typedef struct __attribute__((packed))
+{
+    uint8_t magic;
+    uint8_t type;
+    uint16_t reserved;
+    uint32_t len;
+    uint32_t seq; // Of the segment
+} record_header_t;
+
+#define RECORD_OVERHEAD (sizeof(record_header_t) + sizeof(uint32_t))
+#define APPEND_MAX_PAYLOAD (DOC_JOURNAL_PAGE_SIZE - RECORD_OVERHEAD)
+
+// A snapshot's payload: one frame per DOC_STORE_BLOCK_SIZE document bytes (the last
+// one shorter), a uint16_t frame header and an LZ4 block of that many bytes, or the
+// text itself when FRAME_STORED is set (it did not get smaller)
+#define FRAME_STORED 0x8000
+#define FRAME_MAX (sizeof(uint16_t) + DOC_STORE_BLOCK_SIZE)
+
+// --- Writing ---
+
+static bool write_bytes(doc_journal_t *j, int seg, uint32_t *seg_bytes, const void *buf, uint32_t len, uint32_t *stat)
+{
+    int32_t n = j->store->append(seg, buf, len);
+    if (n > 0)
+    {
+        *stat += n;
+        *seg_bytes += n;
+    }
+    return n == (int32_t)len;
+}
+
+// A small record in a single write that does not cross a page boundary
+static bool write_record(doc_journal_t *j, int seg, uint32_t *seg_bytes, uint8_t type, uint32_t seq,
+                         const void *payload, uint32_t len, uint32_t *stat)
+{
+    uint8_t buf[DOC_JOURNAL_PAGE_SIZE];
+    record_header_t h = {RECORD_MAGIC, type, 0, len, seq};
+    memcpy(buf, &h, sizeof(h));
+    if (len)
+        memcpy(buf + sizeof(h), payload, len);
+    uint32_t crc = esp_rom_crc32_le(0, buf, sizeof(h) + len);
+    memcpy(buf + sizeof(h) + len, &crc, sizeof(crc));
+    uint32_t rec_len = len + RECORD_OVERHEAD;
+
+    uint32_t in_page = *seg_bytes % DOC_JOURNAL_PAGE_SIZE;
+    if (in_page && in_page + rec_len > DOC_JOURNAL_PAGE_SIZE)
+    {
+        uint8_t pad[DOC_JOURNAL_PAGE_SIZE];
+        memset(pad, RECORD_PADDING, DOC_JOURNAL_PAGE_SIZE - in_page);
+        if (!write_bytes(j, seg, seg_bytes, pad, DOC_JOURNAL_PAGE_SIZE - in_page, stat))
+            return false;
+    }
+
+    return write_bytes(j, seg, seg_bytes, buf, rec_len, stat);
+}
+
+static bool write_appends(doc_journal_t *j, int seg, uint32_t *seg_bytes, uint32_t seq, const char *text, uint32_t len, uint32_t *stat)
+{
+    for (uint32_t done = 0; done < len;)
+    {
+        uint32_t n = LV_MIN(len - done, APPEND_MAX_PAYLOAD);
+        if (!write_record(j, seg, seg_bytes, RECORD_APPEND, seq, text + done, n, stat))
+            return false;
+        done += n;
+    }
+    return true;
+}
+
+// Document bytes [offset, offset + len) as append records
+static bool write_document_appends(doc_journal_t *j, int seg, uint32_t *seg_bytes, uint32_t seq, uint32_t offset, uint32_t len, uint32_t *stat)
+{
+    char text[APPEND_MAX_PAYLOAD];
+    for (uint32_t done = 0; done < len;)
+    {
+        uint32_t n = LV_MIN(len - done, APPEND_MAX_PAYLOAD);
+        if (!j->text->read(offset + done, text, n) || !write_record(j, seg, seg_bytes, RECORD_APPEND, seq, text, n, stat))
+            return false;
+        done += n;
+    }
+    return true;
+}
+
+static void drop_segment(doc_journal_t *j, int seg)
+{
+    if (j->store->size(seg) >= 0)
+        j->store->remove(seg);
+}
+
+// --- Compaction ---
+
+static uint32_t new_seg_bytes; // Written to the new segment so far
+// The frame being written: FRAME_MAX bytes, then the document bytes it holds
+static uint8_t *frame;
+static uint32_t frame_len;
+static uint32_t frame_done;
+
+static void compact_end(doc_journal_t *j)
+{
+    j->compacting = false;
+    free(frame);
+    frame = NULL;
+}
+
+static void compact_failed(doc_journal_t *j)
+{
+    // The old segment stays valid; retrying would only wear a full or failing flash
+    log_e("Journal: compaction failed, text is no longer persisted");
+    compact_end(j);
+    j->ok = false;
+}
+
+static void compact_begin(doc_journal_t *j, uint32_t len)
+{
+    drop_segment(j, 1 - j->seg);
+    j->compacting = true;
+    j->compact_len = len;
+    j->compact_done = 0;
+    new_seg_bytes = 0;
+    frame_len = frame_done = 0;
+    frame = (uint8_t *)malloc(FRAME_MAX + DOC_STORE_BLOCK_SIZE);
+    if (!frame)
+    {
+        compact_failed(j);
+        return;
+    }
+
+    record_header_t h = {RECORD_MAGIC, RECORD_SNAPSHOT_FRAMES, 0, len, j->seq + 1};
+    j->compact_crc = esp_rom_crc32_le(0, (const uint8_t *)&h, sizeof(h));
+    if (!write_bytes(j, 1 - j->seg, &new_seg_bytes, &h, sizeof(h), &j->stats.compaction_bytes))
+        compact_failed(j);
+}
+
+// Compress the next block of the document into frame
+static bool compact_frame(doc_journal_t *j)
+{
+    uint32_t len = LV_MIN(j->compact_len - j->compact_done, DOC_STORE_BLOCK_SIZE);
+    char *text = (char *)frame + FRAME_MAX;
+    if (!j->text->read(j->compact_done, text, len))
+        return false;
+    uint16_t header = doc_store_compress(text, len, frame + sizeof(header), len - 1);
+    if (!header)
+    {
+        header = len | FRAME_STORED;
+        memcpy(frame + sizeof(header), text, len);
+    }
+    memcpy(frame, &header, sizeof(header));
+    frame_len = sizeof(header) + (header & ~FRAME_STORED);
+    frame_done = 0;
+    j->compact_done += len;
+    return true;
+}
+
+static void compact_step(doc_journal_t *j)
+{
+    int new_seg = 1 - j->seg;
+    if (frame_done == frame_len && j->compact_done < j->compact_len && !compact_frame(j))
+    {
+        compact_failed(j);
+        return;
+    }
+    uint32_t n = LV_MIN(frame_len - frame_done, DOC_JOURNAL_STEP_BYTES);
+    if (n)
+    {
+        j->compact_crc = esp_rom_crc32_le(j->compact_crc, frame + frame_done, n);
+        if (!write_bytes(j, new_seg, &new_seg_bytes, frame + frame_done, n, &j->stats.compaction_bytes))
+            compact_failed(j);
+        frame_done += n;
+        return;
+    }
+
+    // Snapshot done: its CRC, the text accepted meanwhile and the commit marker,
+    // then the old segment can go
+    uint32_t seq = j->seq + 1;
+    uint32_t snapshot_bytes = new_seg_bytes + sizeof(uint32_t);
+    uint32_t tail = j->text->len() - j->compact_len;
+    compact_end(j);
+    if (!write_bytes(j, new_seg, &new_seg_bytes, &j->compact_crc, sizeof(uint32_t), &j->stats.compaction_bytes) ||
+        !write_document_appends(j, new_seg, &new_seg_bytes, seq, j->compact_len, tail, &j->stats.compaction_bytes) ||
+        !write_record(j, new_seg, &new_seg_bytes, RECORD_COMMIT, seq, NULL, 0, &j->stats.compaction_bytes))
+    {
+        compact_failed(j);
+        return;
+    }
+
+    drop_segment(j, j->seg);
+    j->seg = new_seg;
+    j->seq = seq;
+    j->seg_bytes = new_seg_bytes;
+    j->snapshot_bytes = snapshot_bytes;
+    j->stats.compactions++;
+}
+
+static bool needs_compaction(const doc_journal_t *j)
+{
+    uint32_t after_snapshot = j->seg_bytes - j->snapshot_bytes;
+    return !j->compacting && after_snapshot > DOC_JOURNAL_COMPACT_BYTES && after_snapshot > j->snapshot_bytes;
+}
+
+// --- Reading ---
+
+typedef struct
+{
+    bool committed;
+    bool torn; // Unreadable bytes after the last good record
+    uint32_t seq;
+    uint32_t valid_bytes;
+    uint32_t snapshot_bytes;
+    char *text; // malloc'ed
+    uint32_t len;
+} segment_t;
+
+static bool read_record(const doc_journal_t *j, int seg, uint32_t *offset, uint32_t size, record_header_t *h, char *payload, uint32_t max_len)
+{
+    // Skip the unused rest of a page
+    uint8_t first;
+    while (*offset < size && j->store->read(seg, *offset, &first, 1) == 1 && first == RECORD_PADDING)
+        *offset = (*offset / DOC_JOURNAL_PAGE_SIZE + 1) * DOC_JOURNAL_PAGE_SIZE;
+
+    if (*offset + RECORD_OVERHEAD > size || j->store->read(seg, *offset, h, sizeof(*h)) != sizeof(*h) ||
+        h->magic != RECORD_MAGIC || h->len > max_len || *offset + RECORD_OVERHEAD + h->len > size ||
+        j->store->read(seg, *offset + sizeof(*h), payload, h->len) != (int32_t)h->len)
+        return false;
+
+    uint32_t crc;
+    if (j->store->read(seg, *offset + sizeof(*h) + h->len, &crc, sizeof(crc)) != sizeof(crc) ||
+        crc != esp_rom_crc32_le(esp_rom_crc32_le(0, (const uint8_t *)h, sizeof(*h)), (const uint8_t *)payload, h->len))
+        return false;
+
+    *offset += RECORD_OVERHEAD + h->len;
+    return true;
+}
+
+// The frames of a compressed snapshot into text, and their CRC after them
+static bool read_snapshot_frames(const doc_journal_t *j, int seg, uint32_t *offset, uint32_t size, const record_header_t *h, char *text)
+{
+    uint8_t *frame = (uint8_t *)malloc(FRAME_MAX);
+    if (!frame)
+        return false;
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t *)h, sizeof(*h));
+    uint32_t pos = *offset + sizeof(*h);
+    bool ok = true;
+    for (uint32_t done = 0; ok && done < h->len;)
+    {
+        uint32_t len = LV_MIN(h->len - done, DOC_STORE_BLOCK_SIZE);
+        uint16_t header = 0;
+        ok = pos + sizeof(header) <= size && j->store->read(seg, pos, &header, sizeof(header)) == sizeof(header);
+        uint32_t n = header & ~FRAME_STORED;
+        ok = ok && n <= DOC_STORE_BLOCK_SIZE && pos + sizeof(header) + n <= size &&
+             j->store->read(seg, pos + sizeof(header), frame + sizeof(header), n) == (int32_t)n;
+        if (!ok)
+            break;
+        memcpy(frame, &header, sizeof(header));
+        crc = esp_rom_crc32_le(crc, frame, sizeof(header) + n);
+        if (header & FRAME_STORED)
+        {
+            ok = n == len;
+            memcpy(text + done, frame + sizeof(header), ok ? n : 0);
+        }
+        else
+            ok = doc_store_decompress(frame + sizeof(header), n, text + done, len) == (int32_t)len;
+        pos += sizeof(header) + n;
+        done += len;
+    }
+    free(frame);
+
+    uint32_t stored_crc;
+    if (!ok || pos + sizeof(stored_crc) > size || j->store->read(seg, pos, &stored_crc, sizeof(stored_crc)) != sizeof(stored_crc) ||
+        stored_crc != crc)
+        return false;
+    *offset = pos + sizeof(stored_crc);
+    return true;
+}
+
+static bool read_segment(const doc_journal_t *j, int seg, segment_t *s)
+{
+    memset(s, 0, sizeof(*s));
+    int32_t size = j->store->size(seg);
+    record_header_t h;
+    if (size < (int32_t)RECORD_OVERHEAD || j->store->read(seg, 0, &h, sizeof(h)) != sizeof(h) || h.magic != RECORD_MAGIC)
+        return false;
+
+    // The document can't be longer than its snapshot and the rest of the segment;
+    // an LZ4 block expands at most 255 times
+    bool frames = h.type == RECORD_SNAPSHOT_FRAMES;
+    if (frames && h.len / 255 >= (uint32_t)size)
+        return false;
+    uint32_t max_len = frames ? h.len + size : size;
+    s->text = (char *)malloc(max_len + 1);
+    if (!s->text)
+        return false;
+
+    uint32_t offset = 0;
+    if (!(frames ? read_snapshot_frames(j, seg, &offset, size, &h, s->text)
+                 : read_record(j, seg, &offset, size, &h, s->text, size) && h.type == RECORD_SNAPSHOT))
+    {
+        free(s->text);
+        s->text = NULL;
+        return false;
+    }
+    s->seq = h.seq;
+    s->len = h.len;
+    s->snapshot_bytes = offset;
+
+    while (offset < (uint32_t)size)
+    {
+        if (!read_record(j, seg, &offset, size, &h, s->text + s->len, max_len - s->len) || h.seq != s->seq)
+        {
+            s->torn = true;
+            break;
+        }
+        if (h.type == RECORD_APPEND)
+            s->len += h.len;
+        else if (h.type == RECORD_COMMIT)
+            s->committed = true;
+    }
+    s->text[s->len] = '\0';
+    // Padding cut short: a record appended now would not start on a page boundary
+    if (offset > (uint32_t)size)
+        s->torn = true;
+    s->valid_bytes = LV_MIN(offset, (uint32_t)size);
+    return s->committed;
+}
+
+// --- Journal ---
+
+// The restored text, for a compaction before it is the document
+static const char *restored_text;
+static uint32_t restored_len;
+static uint32_t restored_text_len() { return restored_len; }
+static bool restored_text_read(uint32_t offset, char *buf, uint32_t len)
+{
+    memcpy(buf, restored_text + offset, len);
+    return true;
+}
+static const doc_journal_text_t restored_source = {restored_text_len, restored_text_read};
+
+bool doc_journal_open(doc_journal_t *j, const doc_journal_store_t *store, const doc_journal_text_t *document,
+                      char **text, uint32_t *len)
+{
+    memset(j, 0, sizeof(*j));
+    j->store = store;
+    j->text = document;
+    *text = NULL;
+    *len = 0;
+    if (!store)
+        return false;
+
+    // The newest complete segment; the other one is either replaced or unfinished
+    segment_t segs[2];
+    bool valid[2] = {read_segment(j, 0, &segs[0]), read_segment(j, 1, &segs[1])};
+    int seg = valid[0] && valid[1] ? (segs[1].seq > segs[0].seq ? 1 : 0) : (valid[1] ? 1 : 0);
+    free(segs[1 - seg].text);
+    drop_segment(j, 1 - seg);
+
+    if (!valid[seg])
+    {
+        // Fresh journal with the current document
+        free(segs[seg].text);
+        drop_segment(j, seg);
+        j->seg = 1; // Compaction writes segment 0
+        j->seq = 0;
+        compact_begin(j, document->len());
+        while (j->compacting)
+            compact_step(j);
+        j->ok = j->seq == 1;
+        return j->ok;
+    }
+
+    j->seg = seg;
+    j->seq = segs[seg].seq;
+    j->seg_bytes = segs[seg].valid_bytes;
+    j->snapshot_bytes = segs[seg].snapshot_bytes;
+    *text = segs[seg].text;
+    *len = segs[seg].len;
+    j->ok = true;
+
+    // Records after torn bytes could not be read back: rewrite the segment now
+    if (segs[seg].torn)
+    {
+        log_w("Journal: torn record after %lu bytes, compacting", (unsigned long)j->seg_bytes);
+        restored_text = *text;
+        restored_len = *len;
+        j->text = &restored_source;
+        compact_begin(j, *len);
+        while (j->compacting)
+            compact_step(j);
+        j->text = document;
+    }
+
+    log_i("Journal: restored %lu bytes from segment %d (%lu bytes)", (unsigned long)*len, j->seg, (unsigned long)j->seg_bytes);
+    return true;
+}
+
+bool doc_journal_append(doc_journal_t *j, const char *text, uint32_t len)
+{
+    if (!j->ok)
+        return false;
+
+    j->stats.accepts++;
+    j->stats.text_bytes += len;
+    // Appends go to the active segment during a compaction too, the new one copies them at its end
+    if (!write_appends(j, j->seg, &j->seg_bytes, j->seq, text, len, &j->stats.record_bytes))
+    {
+        // Records after a partial one can't be read back: stop until the next boot repairs it
+        log_e("Journal: append failed, text is no longer persisted");
+        j->ok = false;
+    }
+    return j->ok;
+}
+
+// Returns true when a compaction completed
+static bool journal_step(doc_journal_t *j)
+{
+    if (!j->ok)
+        return false;
+
+    if (needs_compaction(j))
+    {
+        compact_begin(j, j->text->len());
+        return false;
+    }
+
+    if (!j->compacting)
+        return false;
+
+    uint32_t compactions = j->stats.compactions;
+    compact_step(j);
+    return j->stats.compactions != compactions;
+}
+
+void doc_journal_poll(doc_journal_t *j)
+{
+    if (journal_step(j))
+        doc_journal_report(j);
+}
+
+void doc_journal_report(const doc_journal_t *j)
+{
+    const doc_journal_stats_t *s = &j->stats;
+    uint32_t written = s->record_bytes + s->compaction_bytes;
+    log_i("Journal: %lu accepts, %lu text bytes, %lu written to the segment files (amplification %lu.%02lu), "
+          "%lu compactions",
+          (unsigned long)s->accepts, (unsigned long)s->text_bytes, (unsigned long)written,
+          (unsigned long)(s->text_bytes ? written / s->text_bytes : 0), (unsigned long)(s->text_bytes ? written * 100 / s->text_bytes % 100 : 0),
+          (unsigned long)s->compactions);
+}
+
+// --- LittleFS Store ---
+
+static const char *const segment_paths[2] = {"/doc0.jnl", "/doc1.jnl"};
+
+static int32_t fs_size(int seg)
+{
+    File f = LittleFS.open(segment_paths[seg], "r");
+    if (!f)
+        return -1;
+    int32_t size = f.size();
+    f.close();
+    return size;
+}
+
+static int32_t fs_read(int seg, uint32_t offset, void *buf, uint32_t len)
+{
+    File f = LittleFS.open(segment_paths[seg], "r");
+    if (!f || !f.seek(offset))
+        return -1;
+    int32_t n = f.read((uint8_t *)buf, len);
+    f.close();
+    return n;
+}
+
+static int32_t fs_append(int seg, const void *buf, uint32_t len)
+{
+    // Closed after every append: the data is on flash when this returns
+    File f = LittleFS.open(segment_paths[seg], "a");
+    if (!f)
+        return -1;
+    int32_t n = f.write((const uint8_t *)buf, len);
+    f.close();
+    return n;
+}
+
+static bool fs_remove(int seg)
+{
+    return LittleFS.remove(segment_paths[seg]);
+}
+
+static const doc_journal_store_t littlefs_store = {fs_size, fs_read, fs_append, fs_remove};
+
+const doc_journal_store_t *doc_journal_littlefs_store()
+{
+    if (!LittleFS.begin(true))
+    {
+        log_e("Journal: no LittleFS partition, text is not persisted");
+        return NULL;
+    }
+    return &littlefs_store;
+}
@@ -0,0 +1,472 @@
+#include <Arduino.h>
+#include <ctype.h>
+#include <lvgl.h>
+#include <string.h>
+#include "doc_store.h"
+
+// --- Codec ---
+// Greedy LZ4: one hash table probe per position, no lazy matching. Text blocks
+// compress about as well as with the reference compressor's fast mode.
+
+#define MIN_MATCH 4
+#define LAST_LITERALS 5 // The last bytes of a block are literals
+#define MATCH_LIMIT 12  // A match starts at least this far from the end
+#define HASH_LOG 10
+
+static_assert(DOC_STORE_BLOCK_SIZE <= 65535, "block positions are 16 bit");
+
+static uint16_t hash_table[1 << HASH_LOG]; // Latest position of each hashed 4 bytes
+
+static uint32_t hash4(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return (v * 2654435761u) >> (32 - HASH_LOG);
+}
+
+// Length bytes after a token nibble of 15
+static uint8_t *put_length(uint8_t *out, uint32_t len)
+{
+    for (; len >= 255; len -= 255)
+        *out++ = 255;
+    *out++ = len;
+    return out;
+}
+
+// Token, literal length, literals and the room for a match; false when it does not fit
+static bool put_literals(uint8_t **out, const uint8_t *out_end, const uint8_t *literals, uint32_t len, uint32_t match_bytes)
+{
+    if ((uint32_t)(out_end - *out) < 1 + (len >= 15 ? (len - 15) / 255 + 1 : 0) + len + match_bytes)
+        return false;
+    uint8_t *o = *out;
+    *o++ = (len >= 15 ? 15 : len) << 4;
+    if (len >= 15)
+        o = put_length(o, len - 15);
+    memcpy(o, literals, len);
+    *out = o + len;
+    return true;
+}
+
+uint32_t doc_store_compress(const char *src, uint32_t len, uint8_t *dst, uint32_t cap)
+{
+    const uint8_t *in = (const uint8_t *)src;
+    const uint8_t *end = in + len;
+    const uint8_t *anchor = in; // First literal not yet written
+    uint8_t *out = dst;
+    const uint8_t *out_end = dst + cap;
+    if (len > DOC_STORE_BLOCK_SIZE)
+        return 0;
+
+    memset(hash_table, 0, sizeof(hash_table));
+    for (const uint8_t *p = in; len > MATCH_LIMIT && p < end - MATCH_LIMIT;)
+    {
+        uint32_t h = hash4(p);
+        const uint8_t *ref = in + hash_table[h];
+        hash_table[h] = p - in;
+        if (ref >= p || memcmp(ref, p, MIN_MATCH) != 0)
+        {
+            p++;
+            continue;
+        }
+
+        const uint8_t *m = p + MIN_MATCH;
+        for (const uint8_t *r = ref + MIN_MATCH; m < end - LAST_LITERALS && *m == *r; m++, r++)
+            ;
+        uint32_t match = m - p - MIN_MATCH;
+        uint8_t *token = out;
+        if (!put_literals(&out, out_end, anchor, p - anchor, 2 + (match >= 15 ? (match - 15) / 255 + 1 : 0)))
+            return 0;
+        *token |= match >= 15 ? 15 : match;
+        uint16_t offset = p - ref;
+        *out++ = offset;
+        *out++ = offset >> 8;
+        if (match >= 15)
+            out = put_length(out, match - 15);
+
+        p = anchor = m;
+        if (p < end - MATCH_LIMIT)
+            hash_table[hash4(p - 2)] = p - 2 - in;
+    }
+
+    // The rest as literals, in a token without a match
+    if (!put_literals(&out, out_end, anchor, end - anchor, 0))
+        return 0;
+    return out - dst;
+}
+
+// Length bytes after a token nibble of 15; false when src ends first
+static bool get_length(const uint8_t **in, const uint8_t *end, uint32_t *len)
+{
+    uint8_t b;
+    do
+    {
+        if (*in >= end)
+            return false;
+        b = *(*in)++;
+        *len += b;
+    } while (b == 255);
+    return true;
+}
+
+int32_t doc_store_decompress(const uint8_t *src, uint32_t len, char *dst, uint32_t cap)
+{
+    const uint8_t *in = src;
+    const uint8_t *end = src + len;
+    uint8_t *out = (uint8_t *)dst;
+    const uint8_t *out_end = out + cap;
+    while (in < end)
+    {
+        uint8_t token = *in++;
+        uint32_t literals = token >> 4;
+        if ((literals == 15 && !get_length(&in, end, &literals)) || literals > (uint32_t)(end - in) ||
+            literals > (uint32_t)(out_end - out))
+            return -1;
+        memcpy(out, in, literals);
+        in += literals;
+        out += literals;
+        if (in == end)
+            break; // The last token has no match
+
+        uint32_t match = (token & 15) + MIN_MATCH;
+        if (end - in < 2)
+            return -1;
+        uint32_t offset = in[0] | in[1] << 8;
+        in += 2;
+        if (((token & 15) == 15 && !get_length(&in, end, &match)) || offset == 0 ||
+            offset > (uint32_t)(out - (uint8_t *)dst) || match > (uint32_t)(out_end - out))
+            return -1;
+        const uint8_t *ref = out - offset;
+        if (offset >= match)
+            memcpy(out, ref, match);
+        else
+            for (uint32_t i = 0; i < match; i++) // Overlapping: repeats the last offset bytes
+                out[i] = ref[i];
+        out += match;
+    }
+    return out - (uint8_t *)dst;
+}
+
+// --- Document ---
+
+typedef struct
+{
+    uint8_t *data; // Compressed, or the text when size is DOC_STORE_BLOCK_SIZE
+    uint16_t size;
+} block_t;
+
+static block_t *blocks; // The full blocks
+static uint32_t block_count;
+static uint32_t block_capacity;
+// The last full block (when there is one) and the text after it
+static char *view;
+static uint32_t view_prev; // 0 or DOC_STORE_BLOCK_SIZE
+static uint32_t view_tail;
+// Block decompressed by the last doc_store_read, -1: none
+static char *scratch;
+static int32_t scratch_block = -1;
+
+static uint32_t compressed_bytes;
+static uint32_t seal_us_max;
+static uint32_t decompress_us_max;
+
+static void *store_malloc(size_t size)
+{
+    // PSRAM when the board has it, it is the larger heap
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    return p ? p : heap_caps_malloc(size, MALLOC_CAP_DEFAULT);
+}
+
+static bool decompress_block(uint32_t index, char *buf);
+
+bool doc_store_init()
+{
+    view = (char *)store_malloc(3 * DOC_STORE_BLOCK_SIZE + 1);
+    if (!view)
+    {
+        log_e("Document: out of memory");
+        return false;
+    }
+    scratch = view + 2 * DOC_STORE_BLOCK_SIZE + 1;
+    doc_store_clear();
+    return true;
+}
+
+// Compress the full tail into a new block; it becomes the previous block of the view
+static bool seal()
+{
+    uint32_t start = micros();
+    if (block_count == block_capacity)
+    {
+        uint32_t capacity = block_capacity ? 2 * block_capacity : 16;
+        block_t *grown = (block_t *)heap_caps_realloc(blocks, capacity * sizeof(block_t), MALLOC_CAP_DEFAULT);
+        if (!grown)
+            return false;
+        blocks = grown;
+        block_capacity = capacity;
+    }
+
+    // Kept as text when it does not get smaller
+    const char *tail = view + view_prev;
+    uint32_t size = doc_store_compress(tail, DOC_STORE_BLOCK_SIZE, (uint8_t *)scratch, DOC_STORE_BLOCK_SIZE - 1);
+    scratch_block = -1;
+    uint16_t stored = size ? size : DOC_STORE_BLOCK_SIZE;
+    uint8_t *data = (uint8_t *)store_malloc(stored);
+    if (!data)
+        return false;
+    memcpy(data, size ? scratch : tail, stored);
+    blocks[block_count++] = {data, stored};
+    compressed_bytes += stored;
+
+    if (view_prev)
+        memmove(view, tail, DOC_STORE_BLOCK_SIZE);
+    view_prev = DOC_STORE_BLOCK_SIZE;
+    view_tail = 0;
+    view[view_prev] = '\0';
+    seal_us_max = LV_MAX(seal_us_max, micros() - start);
+    return true;
+}
+
+// Back to count blocks and tail bytes after them, undoing the seals since
+static void unseal(uint32_t count, uint32_t tail)
+{
+    if (block_count > count)
+    {
+        // The old tail starts the first block sealed since, the old previous block is the one before it
+        decompress_block(count, scratch);
+        if (count)
+            decompress_block(count - 1, view);
+        view_prev = count ? DOC_STORE_BLOCK_SIZE : 0;
+        memcpy(view + view_prev, scratch, tail);
+        scratch_block = -1;
+        while (block_count > count)
+        {
+            block_count--;
+            compressed_bytes -= blocks[block_count].size;
+            free(blocks[block_count].data);
+        }
+    }
+    view_tail = tail;
+    view[view_prev + view_tail] = '\0';
+}
+
+bool doc_store_append(const char *text, uint32_t len)
+{
+    if (!view)
+        return false;
+    uint32_t count = block_count;
+    uint32_t tail = view_tail;
+    while (len)
+    {
+        if (view_tail == DOC_STORE_BLOCK_SIZE && !seal())
+        {
+            log_e("Document: out of memory for block %lu", (unsigned long)block_count);
+            unseal(count, tail);
+            return false;
+        }
+        uint32_t n = LV_MIN(len, DOC_STORE_BLOCK_SIZE - view_tail);
+        memcpy(view + view_prev + view_tail, text, n);
+        view_tail += n;
+        view[view_prev + view_tail] = '\0';
+        text += n;
+        len -= n;
+    }
+    return true;
+}
+
+void doc_store_clear()
+{
+    if (!view)
+        return;
+    for (uint32_t i = 0; i < block_count; i++)
+        free(blocks[i].data);
+    free(blocks);
+    blocks = NULL;
+    block_count = block_capacity = 0;
+    compressed_bytes = 0;
+    view_prev = view_tail = 0;
+    view[0] = '\0';
+    scratch_block = -1;
+}
+
+uint32_t doc_store_length()
+{
+    return block_count * DOC_STORE_BLOCK_SIZE + view_tail;
+}
+
+const char *doc_store_view()
+{
+    if (!view)
+        return "";
+    // A block can end inside a character: skip its continuation bytes
+    const char *v = view;
+    while (v < view + 3 && ((uint8_t)*v & 0xc0) == 0x80)
+        v++;
+    return v;
+}
+
+const char *doc_store_text()
+{
+    return view && block_count <= 1 ? view : NULL;
+}
+
+// The text of a full block into buf
+static bool decompress_block(uint32_t index, char *buf)
+{
+    const block_t *b = &blocks[index];
+    if (b->size == DOC_STORE_BLOCK_SIZE)
+    {
+        memcpy(buf, b->data, DOC_STORE_BLOCK_SIZE);
+        return true;
+    }
+    uint32_t start = micros();
+    bool ok = doc_store_decompress(b->data, b->size, buf, DOC_STORE_BLOCK_SIZE) == DOC_STORE_BLOCK_SIZE;
+    decompress_us_max = LV_MAX(decompress_us_max, micros() - start);
+    if (!ok)
+        log_e("Document: block %lu is damaged", (unsigned long)index);
+    return ok;
+}
+
+bool doc_store_read(uint32_t offset, char *buf, uint32_t len)
+{
+    if (offset > doc_store_length() || len > doc_store_length() - offset)
+        return false;
+    uint32_t view_offset = block_count * DOC_STORE_BLOCK_SIZE - view_prev;
+    while (len)
+    {
+        uint32_t index = offset / DOC_STORE_BLOCK_SIZE;
+        uint32_t in_block = offset % DOC_STORE_BLOCK_SIZE;
+        uint32_t n = LV_MIN(len, DOC_STORE_BLOCK_SIZE - in_block);
+        if (offset >= view_offset)
+            memcpy(buf, view + offset - view_offset, n);
+        else
+        {
+            // Sequential reads decompress each block once
+            if (scratch_block != (int32_t)index)
+            {
+                scratch_block = -1;
+                if (!decompress_block(index, scratch))
+                    return false;
+                scratch_block = index;
+            }
+            memcpy(buf, scratch + in_block, n);
+        }
+        buf += n;
+        offset += n;
+        len -= n;
+    }
+    return true;
+}
+
+void doc_store_report()
+{
+    uint32_t length = doc_store_length();
+    uint32_t stored = compressed_bytes + view_tail; // The view's full block is counted compressed
+    log_i("Document: %lu bytes in %lu blocks, %lu stored (ratio %lu.%02lu), %lu decompressed; "
+          "compress %lu us, decompress %lu us at most",
+          (unsigned long)length, (unsigned long)block_count, (unsigned long)stored,
+          (unsigned long)(stored ? length / stored : 0), (unsigned long)(stored ? length * 100 / stored % 100 : 0),
+          (unsigned long)(view_prev + view_tail), (unsigned long)seal_us_max, (unsigned long)decompress_us_max);
+}
+
+#if DOC_STORE_BENCH
+// --- Benchmark ---
+
+// Common English words: text with the letter and word statistics of notes
+static const char *const bench_words[] = {
+    "the", "of", "and", "to", "a", "in", "is", "you", "that", "it", "he", "was", "for", "on", "are",
+    "as", "with", "his", "they", "I", "at", "be", "this", "have", "from", "or", "one", "had", "by",
+    "word", "but", "not", "what", "all", "were", "we", "when", "your", "can", "said", "there", "use",
+    "an", "each", "which", "she", "do", "how", "their", "if", "will", "up", "other", "about", "out",
+    "many", "then", "them", "these", "so", "some", "her", "would", "make", "like", "him", "into",
+    "time", "has", "look", "two", "more", "write", "go", "see", "number", "no", "way", "could",
+    "people", "my", "than", "first", "water", "been", "call", "who", "oil", "its", "now", "find",
+    "long", "down", "day", "did", "get", "come", "made", "may", "part", "meeting", "tomorrow",
+    "remember", "buy", "milk", "bread", "keyboard", "display", "battery", "charge", "notes", "idea",
+};
+
+static void bench_text(char *text, uint32_t len)
+{
+    uint32_t n = 0;
+    bool sentence = true;
+    while (n < len)
+    {
+        char word[16];
+        snprintf(word, sizeof(word), "%s", bench_words[random(sizeof(bench_words) / sizeof(bench_words[0]))]);
+        if (sentence)
+            word[0] = toupper(word[0]);
+        long r = random(12);
+        sentence = r == 0;
+        int w = snprintf(text + n, len - n + 1, "%s%s", word, r == 0 ? ". " : r == 1 ? ", " : " ");
+        n += LV_MIN((uint32_t)w, len - n);
+    }
+}
+
+typedef struct
+{
+    uint32_t blocks;
+    uint32_t text_bytes;
+    uint32_t compressed_bytes;
+    uint32_t compress_us;
+    uint32_t decompress_us;
+    uint32_t decompress_us_max;
+    uint32_t failures;
+} bench_t;
+
+static void bench_block(bench_t *b, const char *text, uint8_t *compressed, char *check)
+{
+    uint32_t start = micros();
+    uint32_t size = doc_store_compress(text, DOC_STORE_BLOCK_SIZE, compressed, DOC_STORE_BLOCK_SIZE - 1);
+    b->compress_us += micros() - start;
+    start = micros();
+    bool ok = size && doc_store_decompress(compressed, size, check, DOC_STORE_BLOCK_SIZE) == DOC_STORE_BLOCK_SIZE;
+    uint32_t us = micros() - start;
+    b->decompress_us += us;
+    b->decompress_us_max = LV_MAX(b->decompress_us_max, us);
+    b->blocks++;
+    b->text_bytes += DOC_STORE_BLOCK_SIZE;
+    b->compressed_bytes += size ? size : DOC_STORE_BLOCK_SIZE;
+    if (!ok || memcmp(text, check, DOC_STORE_BLOCK_SIZE) != 0)
+        b->failures++;
+}
+
+static void bench_report(const char *name, const bench_t *b)
+{
+    if (!b->blocks)
+        return;
+    log_i("Document bench, %s: %lu blocks, ratio %lu.%02lu, compress %lu us, decompress %lu us (max %lu us, "
+          "%lu.%02lu%% of a %d ms frame), %lu round trips failed",
+          name, (unsigned long)b->blocks, (unsigned long)(b->text_bytes / b->compressed_bytes),
+          (unsigned long)(b->text_bytes * 100 / b->compressed_bytes % 100), (unsigned long)(b->compress_us / b->blocks),
+          (unsigned long)(b->decompress_us / b->blocks), (unsigned long)b->decompress_us_max,
+          (unsigned long)(b->decompress_us_max / (DOC_STORE_FRAME_MS * 10)),
+          (unsigned long)(b->decompress_us_max * 10 / DOC_STORE_FRAME_MS % 100), DOC_STORE_FRAME_MS,
+          (unsigned long)b->failures);
+}
+
+void doc_store_bench()
+{
+    char *text = (char *)store_malloc(3 * DOC_STORE_BLOCK_SIZE + 1);
+    if (!text)
+    {
+        log_e("Document bench: out of memory");
+        return;
+    }
+    uint8_t *compressed = (uint8_t *)text + DOC_STORE_BLOCK_SIZE + 1;
+    char *check = text + 2 * DOC_STORE_BLOCK_SIZE + 1;
+
+    bench_t generated = {};
+    for (int i = 0; i < DOC_STORE_BENCH_BLOCKS; i++)
+    {
+        bench_text(text, DOC_STORE_BLOCK_SIZE);
+        bench_block(&generated, text, compressed, check);
+    }
+    bench_report("generated text", &generated);
+
+    bench_t document = {};
+    for (uint32_t i = 0; i < block_count; i++)
+        if (decompress_block(i, text))
+            bench_block(&document, text, compressed, check);
+    bench_report("document", &document);
+    free(text);
+}
+#endif
@@ -0,0 +1,232 @@
+#include <string.h>
+#include <lvgl.h>
+#include "draw_sw_asm_custom.h"
+
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+#define DRAW_ASM_PIE 1
+#elif defined(__SSE2__) && !DRAW_ASM_SCALAR
+#include <emmintrin.h>
+#define DRAW_ASM_SSE2 1
+#endif
+
+// --- Vector helpers ---
+
+#if DRAW_ASM_PIE
+// dst must be 16 byte aligned; writes blocks * 8 pixels, blocks > 0
+static inline void pie_fill_blocks(uint16_t *dst, uint16_t color, int32_t blocks)
+{
+    // Broadcast the color to the 8 lanes of q0, then one 128 bit store per 8 pixels. One
+    // statement: the compiler knows nothing of q0, it must not be live across two of them
+    __asm__ volatile("ee.vldbc.16 q0, %[color]\n"
+                     "1:\n"
+                     "ee.vst.128.ip q0, %[dst], 16\n"
+                     "addi %[blocks], %[blocks], -1\n"
+                     "bnez %[blocks], 1b"
+                     : [dst] "+r"(dst), [blocks] "+r"(blocks)
+                     : [color] "r"(&color), "m"(color)
+                     : "memory");
+}
+
+// dst and src must be 16 byte aligned; copies blocks * 8 pixels
+static inline void pie_copy_blocks(uint16_t *dst, const uint16_t *src, int32_t blocks)
+{
+    for (; blocks > 0; blocks--)
+        __asm__ volatile("ee.vld.128.ip q0, %1, 16\n"
+                         "ee.vst.128.ip q0, %0, 16"
+                         : "+r"(dst), "+r"(src)::"memory");
+}
+#endif
+
+// --- Kernels ---
+
+int draw_asm_fill_rgb565(void *dest_buf, int32_t w, int32_t h, int32_t dest_stride, uint16_t color)
+{
+    uint32_t color32 = color | ((uint32_t)color << 16);
+    uint8_t *row = (uint8_t *)dest_buf;
+
+    for (int32_t y = 0; y < h; y++, row += dest_stride)
+    {
+        uint16_t *d = (uint16_t *)row;
+        int32_t x = 0;
+
+        // Head: reach 32 bit alignment
+        if (((uintptr_t)d & 2) && x < w)
+            d[x++] = color;
+
+#if DRAW_ASM_PIE
+        // Reach 128 bit alignment two pixels at a time
+        for (; x + 2 <= w && ((uintptr_t)(d + x) & 15); x += 2)
+            *(uint32_t *)(d + x) = color32;
+        int32_t blocks = (w - x) / 8;
+        if (blocks > 0)
+        {
+            pie_fill_blocks(d + x, color, blocks);
+            x += blocks * 8;
+        }
+#elif DRAW_ASM_SSE2
+        __m128i v = _mm_set1_epi16((short)color);
+        for (; x + 8 <= w; x += 8)
+            _mm_storeu_si128((__m128i *)(d + x), v);
+#endif
+
+        for (; x + 2 <= w; x += 2)
+            *(uint32_t *)(d + x) = color32;
+        if (x < w)
+            d[x] = color;
+    }
+
+    return LV_RESULT_OK;
+}
+
+int draw_asm_copy_rgb565(void *dest_buf, int32_t w, int32_t h, int32_t dest_stride, const void *src_buf, int32_t src_stride)
+{
+    uint8_t *dest_row = (uint8_t *)dest_buf;
+    const uint8_t *src_row = (const uint8_t *)src_buf;
+
+    for (int32_t y = 0; y < h; y++, dest_row += dest_stride, src_row += src_stride)
+    {
+#if DRAW_ASM_PIE
+        uint16_t *d = (uint16_t *)dest_row;
+        const uint16_t *s = (const uint16_t *)src_row;
+        // The vector path needs both pointers at the same offset within 16 bytes
+        if ((((uintptr_t)d ^ (uintptr_t)s) & 15) == 0)
+        {
+            int32_t x = 0;
+            for (; x < w && ((uintptr_t)(d + x) & 15); x++)
+                d[x] = s[x];
+            int32_t blocks = (w - x) / 8;
+            if (blocks > 0)
+            {
+                pie_copy_blocks(d + x, s + x, blocks);
+                x += blocks * 8;
+            }
+            for (; x < w; x++)
+                d[x] = s[x];
+            continue;
+        }
+#endif
+        memcpy(dest_row, src_row, w * sizeof(uint16_t));
+    }
+
+    return LV_RESULT_OK;
+}
+
+// --- Self test and benchmark ---
+
+#if DRAW_ASM_SELFTEST
+#include <stdlib.h>
+#include <esp_timer.h>
+#include <esp32-hal-log.h>
+
+#define SELFTEST_W 320
+#define SELFTEST_H 48
+#define SELFTEST_RUNS 200
+
+static void ref_fill_rgb565(void *dest_buf, int32_t w, int32_t h, int32_t dest_stride, uint16_t color)
+{
+    for (int32_t y = 0; y < h; y++)
+    {
+        uint16_t *d = (uint16_t *)((uint8_t *)dest_buf + y * dest_stride);
+        for (int32_t x = 0; x < w; x++)
+            d[x] = color;
+    }
+}
+
+static void ref_copy_rgb565(void *dest_buf, int32_t w, int32_t h, int32_t dest_stride, const void *src_buf, int32_t src_stride)
+{
+    for (int32_t y = 0; y < h; y++)
+    {
+        uint16_t *d = (uint16_t *)((uint8_t *)dest_buf + y * dest_stride);
+        const uint16_t *s = (const uint16_t *)((const uint8_t *)src_buf + y * src_stride);
+        for (int32_t x = 0; x < w; x++)
+            d[x] = s[x];
+    }
+}
+
+static uint32_t lcg_state = 1;
+static uint32_t lcg_next(void)
+{
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state >> 8;
+}
+
+// Pixels per microsecond * 100 of one kernel over a full SELFTEST_W x SELFTEST_H buffer
+#define BENCH(call)                                             \
+    ({                                                          \
+        int64_t t0 = esp_timer_get_time();                      \
+        for (int r = 0; r < SELFTEST_RUNS; r++)                 \
+            call;                                               \
+        int64_t us = esp_timer_get_time() - t0;                 \
+        (uint32_t)((int64_t)SELFTEST_W * SELFTEST_H * SELFTEST_RUNS * 100 / (us ? us : 1)); \
+    })
+
+void draw_asm_selftest(void)
+{
+    size_t size = SELFTEST_W * SELFTEST_H * sizeof(uint16_t) + 16;
+    uint8_t *a = (uint8_t *)malloc(size);
+    uint8_t *b = (uint8_t *)malloc(size);
+    uint8_t *src = (uint8_t *)malloc(size);
+    if (!a || !b || !src)
+    {
+        log_e("Draw kernel self test: out of memory");
+        free(a);
+        free(b);
+        free(src);
+        return;
+    }
+
+    for (size_t i = 0; i < size; i++)
+        src[i] = (uint8_t)lcg_next();
+
+    // Random sizes, strides and (2 byte aligned) offsets against the reference loops
+    int failures = 0;
+    for (int i = 0; i < 1000; i++)
+    {
+        int32_t w = 1 + lcg_next() % (SELFTEST_W - 8);
+        int32_t h = 1 + lcg_next() % SELFTEST_H;
+        int32_t stride = (w + lcg_next() % (SELFTEST_W - w + 1)) * 2;
+        if ((size_t)stride * h > size - 16)
+            h = (size - 16) / stride;
+        size_t ofs = (lcg_next() % 8) * 2;
+        size_t src_ofs = (lcg_next() % 8) * 2;
+        uint16_t color = (uint16_t)lcg_next();
+
+        memset(a, 0x5a, size);
+        memset(b, 0x5a, size);
+        draw_asm_fill_rgb565(a + ofs, w, h, stride, color);
+        ref_fill_rgb565(b + ofs, w, h, stride, color);
+        if (memcmp(a, b, size) != 0)
+        {
+            log_e("fill mismatch: w=%ld h=%ld stride=%ld ofs=%u", (long)w, (long)h, (long)stride, (unsigned)ofs);
+            failures++;
+        }
+
+        draw_asm_copy_rgb565(a + ofs, w, h, stride, src + src_ofs, stride);
+        ref_copy_rgb565(b + ofs, w, h, stride, src + src_ofs, stride);
+        if (memcmp(a, b, size) != 0)
+        {
+            log_e("copy mismatch: w=%ld h=%ld stride=%ld ofs=%u/%u", (long)w, (long)h, (long)stride, (unsigned)ofs, (unsigned)src_ofs);
+            failures++;
+        }
+    }
+
+    int32_t stride = SELFTEST_W * 2;
+    uint32_t fill = BENCH(draw_asm_fill_rgb565(a, SELFTEST_W, SELFTEST_H, stride, 0xf4c5));
+    uint32_t fill_ref = BENCH(ref_fill_rgb565(b, SELFTEST_W, SELFTEST_H, stride, 0xf4c5));
+    uint32_t copy = BENCH(draw_asm_copy_rgb565(a, SELFTEST_W, SELFTEST_H, stride, src, stride));
+    uint32_t copy_ref = BENCH(ref_copy_rgb565(b, SELFTEST_W, SELFTEST_H, stride, src, stride));
+
+    log_i("Draw kernels: %s, fill %lu.%02lu px/us (ref %lu.%02lu), copy %lu.%02lu px/us (ref %lu.%02lu)",
+          failures ? "MISMATCH" : "bit-exact",
+          (unsigned long)(fill / 100), (unsigned long)(fill % 100), (unsigned long)(fill_ref / 100), (unsigned long)(fill_ref % 100),
+          (unsigned long)(copy / 100), (unsigned long)(copy % 100), (unsigned long)(copy_ref / 100), (unsigned long)(copy_ref % 100));
+
+    free(a);
+    free(b);
+    free(src);
+}
+#else
+void draw_asm_selftest(void)
+{
+}
+#endif
@@ -0,0 +1,449 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <stdio.h>
+#include <lvgl.h>
+#include "emoji_glyphs.h"
+
+static bool no_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter, uint32_t letter_next)
+{
+    return false;
+}
+
+static lv_font_t empty_font()
+{
+    lv_font_t font = {};
+    font.get_glyph_dsc = no_glyph_dsc;
+    return font;
+}
+
+// The UI fonts fall back to it from the first frame on: no glyphs until emoji_glyphs_init
+lv_font_t emoji_font = empty_font();
+
+#if EMOJI_LAYER
+
+static_assert(sizeof(emoji_pack_header_t) == 16, "pack header layout");
+static_assert(sizeof(emoji_pack_entry_t) == 12, "pack index entry layout");
+
+#define EMOJI_PIXELS (EMOJI_SIZE * EMOJI_SIZE)
+#define EMOJI_MAX_CODED (EMOJI_PIXELS + (EMOJI_PIXELS + 127) / 128) // Nothing but literal runs
+#define EMOJI_MAX_STRIDE 64                                          // Index entries read per lookup
+
+typedef struct
+{
+    uint32_t codepoint; // 0: empty
+    uint32_t used;      // Lookup clock of the last use
+    uint16_t pins;
+    lv_image_dsc_t dsc;
+    uint8_t pixels[EMOJI_PIXELS];
+} slot_t;
+
+static const emoji_store_t *store;
+static emoji_pack_header_t pack;
+static uint32_t sparse[EMOJI_PACK_MAX_BLOCKS];
+static uint32_t block_count;
+static uint32_t last_codepoint;
+static emoji_pack_entry_t block[EMOJI_MAX_STRIDE];
+static uint8_t coded[EMOJI_MAX_CODED];
+static slot_t slots[EMOJI_CACHE_SLOTS];
+static uint32_t clock_now;
+static emoji_stats_t stats;
+
+// --- File Store ---
+
+static FILE *pack_file;
+
+static bool file_open()
+{
+    if (!LittleFS.begin(true))
+        return false;
+    pack_file = fopen(EMOJI_PACK_PATH, "rb");
+    return pack_file != NULL;
+}
+
+static int32_t file_read(uint32_t offset, void *buf, uint32_t len)
+{
+    if (fseek(pack_file, offset, SEEK_SET) != 0)
+        return -1;
+    return fread(buf, 1, len, pack_file);
+}
+
+static const emoji_store_t file_store = {file_open, file_read};
+
+const emoji_store_t *emoji_glyphs_file_store()
+{
+    return &file_store;
+}
+
+// --- Pack ---
+
+static uint32_t index_offset()
+{
+    return sizeof(emoji_pack_header_t) + block_count * sizeof(uint32_t);
+}
+
+static bool read_entries(uint32_t first, emoji_pack_entry_t *entries, uint32_t count)
+{
+    uint32_t len = count * sizeof(emoji_pack_entry_t);
+    return store->read(index_offset() + first * sizeof(emoji_pack_entry_t), entries, len) == (int32_t)len;
+}
+
+static bool find_entry(uint32_t codepoint, emoji_pack_entry_t *entry)
+{
+    if (!pack.count || codepoint < sparse[0] || codepoint > last_codepoint)
+        return false;
+
+    // Last block starting at or before codepoint, from RAM, then one read of its entries
+    uint32_t lo = 0, hi = block_count;
+    while (hi - lo > 1)
+    {
+        uint32_t mid = (lo + hi) / 2;
+        if (sparse[mid] <= codepoint)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    uint32_t first = lo * pack.stride;
+    uint32_t count = LV_MIN((uint32_t)pack.stride, pack.count - first);
+    if (!read_entries(first, block, count))
+        return false;
+
+    lo = 0;
+    hi = count;
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2;
+        if (block[mid].codepoint < codepoint)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == count || block[lo].codepoint != codepoint)
+        return false;
+    *entry = block[lo];
+    return true;
+}
+
+static bool decode(const uint8_t *src, uint32_t len, uint8_t *dest)
+{
+    const uint8_t *end = src + len;
+    uint32_t n = 0;
+    while (src < end)
+    {
+        uint8_t c = *src++;
+        if (c < 0x80)
+        {
+            uint32_t run = c + 1;
+            if (run > (uint32_t)(end - src) || n + run > EMOJI_PIXELS)
+                return false;
+            memcpy(dest + n, src, run);
+            src += run;
+            n += run;
+        }
+        else
+        {
+            uint32_t run = c - 0x80 + 2;
+            if (src == end || n + run > EMOJI_PIXELS)
+                return false;
+            memset(dest + n, *src++, run);
+            n += run;
+        }
+    }
+    return n == EMOJI_PIXELS;
+}
+
+// --- Cache ---
+
+static slot_t *lookup(uint32_t codepoint, bool pin)
+{
+    if (!codepoint) // Marks an empty slot
+        return NULL;
+    stats.lookups++;
+    clock_now++;
+    slot_t *victim = NULL;
+    for (int i = 0; i < EMOJI_CACHE_SLOTS; i++)
+    {
+        slot_t *slot = &slots[i];
+        if (slot->codepoint == codepoint)
+        {
+            stats.hits++;
+            slot->used = clock_now;
+            slot->pins += pin;
+            return slot;
+        }
+        // Least recently used of the unpinned ones (an empty slot is never used)
+        if (!slot->pins && (!victim || slot->used < victim->used))
+            victim = slot;
+    }
+
+    uint32_t start = micros();
+    emoji_pack_entry_t entry;
+    if (!find_entry(codepoint, &entry))
+    {
+        stats.not_found++;
+        return NULL;
+    }
+    if (!victim || entry.length > EMOJI_MAX_CODED || store->read(entry.offset, coded, entry.length) != entry.length)
+    {
+        stats.failures++;
+        return NULL;
+    }
+    uint32_t read_us = micros() - start;
+
+    if (victim->codepoint)
+    {
+        stats.evictions++;
+        lv_image_cache_drop(&victim->dsc); // Same descriptor, new pixels
+    }
+    victim->codepoint = 0;
+    if (!decode(coded, entry.length, victim->pixels))
+    {
+        stats.failures++;
+        return NULL;
+    }
+    victim->codepoint = codepoint;
+    victim->used = clock_now;
+    victim->pins = pin;
+
+    uint32_t us = micros() - start;
+    stats.misses++;
+    stats.miss_us += us;
+    stats.read_us += read_us;
+    stats.miss_max_us = LV_MAX(stats.miss_max_us, us);
+    return victim;
+}
+
+const lv_image_dsc_t *emoji_glyphs_get(uint32_t codepoint)
+{
+    slot_t *slot = lookup(codepoint, false);
+    return slot ? &slot->dsc : NULL;
+}
+
+const lv_image_dsc_t *emoji_glyphs_pin(uint32_t codepoint)
+{
+    slot_t *slot = lookup(codepoint, true);
+    return slot ? &slot->dsc : NULL;
+}
+
+void emoji_glyphs_unpin(const lv_image_dsc_t *glyph)
+{
+    for (int i = 0; i < EMOJI_CACHE_SLOTS; i++)
+        if (&slots[i].dsc == glyph && slots[i].pins)
+            slots[i].pins--;
+}
+
+static const void *font_path_cb(const lv_font_t *font, uint32_t unicode, uint32_t unicode_next, int32_t *offset_y,
+                                void *user_data)
+{
+    // Only for characters the UI font lacks, while a label is measured or drawn. The
+    // glyph is blitted before the next lookup: there is one draw unit
+    return emoji_glyphs_get(unicode);
+}
+
+// --- API ---
+
+uint32_t emoji_glyphs_count()
+{
+    return pack.count;
+}
+
+uint32_t emoji_glyphs_codepoints(uint32_t first, uint32_t *codepoints, uint32_t count)
+{
+    if (first >= pack.count)
+        return 0;
+    count = LV_MIN(count, pack.count - first);
+    for (uint32_t done = 0; done < count;)
+    {
+        uint32_t n = LV_MIN(count - done, (uint32_t)EMOJI_MAX_STRIDE);
+        if (!read_entries(first + done, block, n))
+            return done;
+        for (uint32_t i = 0; i < n; i++)
+            codepoints[done + i] = block[i].codepoint;
+        done += n;
+    }
+    return count;
+}
+
+size_t emoji_glyphs_utf8(uint32_t codepoint, char *out)
+{
+    size_t len;
+    if (codepoint < 0x80)
+    {
+        out[0] = codepoint;
+        len = 1;
+    }
+    else if (codepoint < 0x800)
+    {
+        out[0] = 0xc0 | (codepoint >> 6);
+        out[1] = 0x80 | (codepoint & 0x3f);
+        len = 2;
+    }
+    else if (codepoint < 0x10000)
+    {
+        out[0] = 0xe0 | (codepoint >> 12);
+        out[1] = 0x80 | ((codepoint >> 6) & 0x3f);
+        out[2] = 0x80 | (codepoint & 0x3f);
+        len = 3;
+    }
+    else
+    {
+        out[0] = 0xf0 | (codepoint >> 18);
+        out[1] = 0x80 | ((codepoint >> 12) & 0x3f);
+        out[2] = 0x80 | ((codepoint >> 6) & 0x3f);
+        out[3] = 0x80 | (codepoint & 0x3f);
+        len = 4;
+    }
+    out[len] = '\0';
+    return len;
+}
+
+const emoji_stats_t *emoji_glyphs_stats()
+{
+    return &stats;
+}
+
+static void log_stats(const char *what, const emoji_stats_t *s)
+{
+    uint32_t found = s->hits + s->misses;
+    log_i("Emoji %s: %lu lookups, hit rate %lu.%lu%% (%lu hits, %lu misses), %lu not found, %lu evictions, "
+          "%lu failures; miss %lu us average (read %lu us), %lu us worst",
+          what, (unsigned long)s->lookups, (unsigned long)(found ? s->hits * 1000ULL / found / 10 : 0),
+          (unsigned long)(found ? s->hits * 1000ULL / found % 10 : 0), (unsigned long)s->hits,
+          (unsigned long)s->misses, (unsigned long)s->not_found, (unsigned long)s->evictions,
+          (unsigned long)s->failures, (unsigned long)(s->misses ? s->miss_us / s->misses : 0),
+          (unsigned long)(s->misses ? s->read_us / s->misses : 0), (unsigned long)s->miss_max_us);
+}
+
+void emoji_glyphs_report()
+{
+    log_stats("cache", &stats);
+}
+
+static void report_timer_cb(lv_timer_t *timer)
+{
+    emoji_glyphs_report();
+}
+
+bool emoji_glyphs_init(const emoji_store_t *pack_store)
+{
+    store = pack_store;
+    pack.count = 0; // No glyphs until the pack is read
+    if (!store->open())
+    {
+        log_w("Emoji: no pack at %s", EMOJI_PACK_PATH);
+        return false;
+    }
+    if (store->read(0, &pack, sizeof(pack)) != sizeof(pack) || pack.magic != EMOJI_PACK_MAGIC ||
+        pack.width != EMOJI_SIZE || pack.height != EMOJI_SIZE || !pack.stride || pack.stride > EMOJI_MAX_STRIDE)
+    {
+        log_e("Emoji: %s is not a pack of %d x %d glyphs", EMOJI_PACK_PATH, EMOJI_SIZE, EMOJI_SIZE);
+        pack.count = 0;
+        return false;
+    }
+    block_count = (pack.count + pack.stride - 1) / pack.stride;
+    emoji_pack_entry_t last;
+    if (!pack.count || block_count > EMOJI_PACK_MAX_BLOCKS ||
+        store->read(sizeof(pack), sparse, block_count * sizeof(uint32_t)) != (int32_t)(block_count * sizeof(uint32_t)) ||
+        !read_entries(pack.count - 1, &last, 1))
+    {
+        log_e("Emoji: %lu glyphs in %s, at most %d are read", (unsigned long)pack.count, EMOJI_PACK_PATH,
+              EMOJI_PACK_MAX_BLOCKS * EMOJI_MAX_STRIDE);
+        pack.count = 0;
+        return false;
+    }
+    last_codepoint = last.codepoint;
+
+    for (int i = 0; i < EMOJI_CACHE_SLOTS; i++)
+    {
+        lv_image_dsc_t *dsc = &slots[i].dsc;
+        dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
+        dsc->header.cf = LV_COLOR_FORMAT_A8;
+        dsc->header.w = EMOJI_SIZE;
+        dsc->header.h = EMOJI_SIZE;
+        dsc->header.stride = EMOJI_SIZE;
+        dsc->data_size = EMOJI_PIXELS;
+        dsc->data = slots[i].pixels;
+    }
+
+    // A copy, so the UI fonts name it as their fallback at compile time; the original stays allocated
+    lv_font_t *font = lv_imgfont_create(EMOJI_SIZE, font_path_cb, NULL);
+    if (font)
+        emoji_font = *font;
+
+    lv_timer_create(report_timer_cb, EMOJI_REPORT_MS, NULL);
+    log_i("Emoji: %lu glyphs U+%04lX..U+%04lX in %s, cache of %d slots (%lu bytes)", (unsigned long)pack.count,
+          (unsigned long)sparse[0], (unsigned long)last_codepoint, EMOJI_PACK_PATH, EMOJI_CACHE_SLOTS,
+          (unsigned long)sizeof(slots));
+    return true;
+}
+
+#if EMOJI_BENCH
+// --- Benchmark ---
+
+#define EMOJI_BENCH_PAGE 36 // Glyphs on the keys
+#define EMOJI_BENCH_LINE 12 // Glyphs on a line of the text
+
+static void bench_phase(const char *what, const emoji_stats_t *before)
+{
+    emoji_stats_t s = stats;
+    s.lookups -= before->lookups;
+    s.hits -= before->hits;
+    s.misses -= before->misses;
+    s.not_found -= before->not_found;
+    s.evictions -= before->evictions;
+    s.failures -= before->failures;
+    s.miss_us -= before->miss_us;
+    s.read_us -= before->read_us;
+    log_stats(what, &s);
+}
+
+void emoji_glyphs_bench()
+{
+    if (!pack.count)
+        return;
+
+    // Page through the picker and back, the page shown pinned
+    emoji_stats_t before = stats;
+    stats.miss_max_us = 0;
+    const lv_image_dsc_t *pinned[EMOJI_BENCH_PAGE] = {};
+    uint32_t codepoints[EMOJI_BENCH_PAGE];
+    uint32_t pages = (pack.count + EMOJI_BENCH_PAGE - 1) / EMOJI_BENCH_PAGE;
+    for (uint32_t p = 0; p < 2 * pages; p++)
+    {
+        uint32_t page = p < pages ? p : 2 * pages - 1 - p;
+        uint32_t n = emoji_glyphs_codepoints(page * EMOJI_BENCH_PAGE, codepoints, EMOJI_BENCH_PAGE);
+        for (int i = 0; i < EMOJI_BENCH_PAGE; i++)
+        {
+            if (pinned[i])
+                emoji_glyphs_unpin(pinned[i]);
+            pinned[i] = i < (int)n ? emoji_glyphs_pin(codepoints[i]) : NULL;
+        }
+    }
+    for (int i = 0; i < EMOJI_BENCH_PAGE; i++)
+        if (pinned[i])
+            emoji_glyphs_unpin(pinned[i]);
+    bench_phase("bench, picker pages", &before);
+
+    // Text: a few glyphs are typed most of the time (the rank of one is u^3 of a uniform
+    // u, about a Zipf distribution, spread over the pack). After each, the line it ends
+    // is measured and drawn again, as a label does
+    before = stats;
+    stats.miss_max_us = 0;
+    uint32_t line[EMOJI_BENCH_LINE] = {};
+    uint32_t random_state = 0x5eed1234;
+    for (int i = 0; i < EMOJI_BENCH_TYPED; i++)
+    {
+        random_state ^= random_state << 13;
+        random_state ^= random_state >> 17;
+        random_state ^= random_state << 5;
+        uint64_t u = random_state & 0xffff;
+        uint32_t rank = (pack.count * u * u * u) >> 48;
+        if (!emoji_glyphs_codepoints((uint64_t)rank * 7919 % pack.count, &line[i % EMOJI_BENCH_LINE], 1))
+            break;
+        for (int pass = 0; pass < 2; pass++)
+            for (int j = 0; j < EMOJI_BENCH_LINE && j <= i; j++)
+                emoji_glyphs_get(line[j]);
+    }
+    bench_phase("bench, typed text", &before);
+}
+#endif
+#endif
@@ -0,0 +1,114 @@
+#include <Arduino.h>
+#include <lvgl.h>
+// The original flush callback and the flushing flag are not part of the public API
+#include "src/display/lv_display_private.h"
+#include "flush_hooks.h"
+
+static lv_display_t *hooked_display;
+static lv_display_flush_cb_t panel_flush_cb;
+
+static struct
+{
+    flush_filter_cb_t cb;
+    void *user_data;
+} filters[FLUSH_HOOKS_MAX_FILTERS];
+static int filter_count = 0;
+static flush_hooks_stats_t stats;
+static flush_convert_cb_t convert_cb;
+static uint16_t *staging_bufs[2];
+static uint32_t staging_px;
+
+static void count(const lv_area_t *area)
+{
+    stats.transactions++;
+    stats.bytes += lv_area_get_size(area) * sizeof(uint16_t);
+}
+
+static void wait_for_panel()
+{
+    // Cleared by lv_display_flush_ready() once the panel driver is done
+    while (hooked_display->flushing)
+        ;
+}
+
+static void send(lv_display_t *disp, const lv_area_t *area, uint16_t *px_map)
+{
+    for (int i = 0; i < filter_count; i++)
+        filters[i].cb(area, px_map, filters[i].user_data);
+
+    count(area);
+    panel_flush_cb(disp, area, (uint8_t *)px_map);
+}
+
+static void hooked_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    if (!convert_cb)
+    {
+        send(disp, area, (uint16_t *)px_map);
+        return;
+    }
+
+    // LVGL marked the display as flushing for the first chunk. Each further chunk is
+    // converted while the previous one is sent from the other staging buffer.
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t rows = staging_px / w;
+    lv_area_t chunk = *area;
+    int k = 0;
+    for (lv_coord_t y = area->y1; y <= area->y2; y += rows, k ^= 1)
+    {
+        chunk.y1 = y;
+        chunk.y2 = LV_MIN(y + rows - 1, area->y2);
+        convert_cb(&chunk, px_map + (y - area->y1) * w, staging_bufs[k]);
+
+        if (y != area->y1)
+        {
+            wait_for_panel();
+            disp->flushing = 1;
+        }
+        send(disp, &chunk, staging_bufs[k]);
+    }
+}
+
+void flush_hooks_init(lv_display_t *disp)
+{
+    hooked_display = disp;
+    panel_flush_cb = disp->flush_cb;
+    lv_display_set_flush_cb(disp, hooked_flush_cb);
+}
+
+void flush_hooks_set_converter(flush_convert_cb_t cb, uint16_t *staging, uint32_t px)
+{
+    staging_bufs[0] = staging;
+    staging_bufs[1] = staging + px;
+    staging_px = px;
+    convert_cb = cb;
+}
+
+void flush_hooks_add_filter(flush_filter_cb_t cb, void *user_data)
+{
+    if (filter_count >= FLUSH_HOOKS_MAX_FILTERS)
+    {
+        log_e("Too many flush filters");
+        return;
+    }
+
+    filters[filter_count].cb = cb;
+    filters[filter_count].user_data = user_data;
+    filter_count++;
+}
+
+void flush_hooks_write(const lv_area_t *area, uint16_t *px_map)
+{
+    // The last flush of LVGL's previous refresh may still be in flight
+    wait_for_panel();
+
+    hooked_display->flushing = 1;
+    count(area);
+    panel_flush_cb(hooked_display, area, (uint8_t *)px_map);
+    wait_for_panel();
+}
+
+const flush_hooks_stats_t *flush_hooks_get_stats()
+{
+    return &stats;
+}
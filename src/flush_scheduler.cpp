@@ -0,0 +1,147 @@
+#include <Arduino.h>
+#include <lvgl.h>
+// The invalidated area list is not part of the public API
+#include "src/display/lv_display_private.h"
+#include "flush_hooks.h"
+#include "flush_scheduler.h"
+
+static uint32_t frames = 0;
+static uint32_t keystrokes = 0;
+static uint32_t areas_in = 0;  // Invalidated areas before merging
+static uint32_t areas_out = 0; // Areas actually rendered
+
+static uint32_t area_cost(const lv_area_t *a)
+{
+    return lv_area_get_size(a) * sizeof(uint16_t) + FLUSH_SCHEDULER_TX_OVERHEAD_BYTES;
+}
+
+static void bounding_box(lv_area_t *res, const lv_area_t *a, const lv_area_t *b)
+{
+    res->x1 = LV_MIN(a->x1, b->x1);
+    res->y1 = LV_MIN(a->y1, b->y1);
+    res->x2 = LV_MAX(a->x2, b->x2);
+    res->y2 = LV_MAX(a->y2, b->y2);
+}
+
+static bool overlap(const lv_area_t *a, const lv_area_t *b)
+{
+    return a->x1 <= b->x2 && b->x1 <= a->x2 && a->y1 <= b->y2 && b->y1 <= a->y2;
+}
+
+static void coalesce(lv_display_t *disp)
+{
+    lv_area_t *areas = disp->inv_areas;
+    int n = disp->inv_p;
+    areas_in += n;
+
+    // Greedy: merge the pair with the largest saving until no merge saves anything.
+    // Overlapping areas always merge, even when their bounding box costs more than
+    // both: rendered apart, their overlap would be rendered and sent twice.
+    while (n > 1)
+    {
+        int best_i = -1, best_j = -1;
+        int32_t best_gain = 0;
+        lv_area_t best_box;
+        for (int i = 0; i < n - 1; i++)
+            for (int j = i + 1; j < n; j++)
+            {
+                lv_area_t box;
+                bounding_box(&box, &areas[i], &areas[j]);
+                int32_t gain = (int32_t)(area_cost(&areas[i]) + area_cost(&areas[j])) - (int32_t)area_cost(&box);
+                if (gain <= 0 && overlap(&areas[i], &areas[j]))
+                    gain = 1; // Ranked after the merges that save something
+                if (gain > best_gain)
+                {
+                    best_gain = gain;
+                    best_i = i;
+                    best_j = j;
+                    best_box = box;
+                }
+            }
+
+        if (best_i < 0)
+            break;
+
+        areas[best_i] = best_box;
+        areas[best_j] = areas[--n];
+    }
+
+    // Top to bottom, then left to right: follows the panel's scan direction
+    for (int i = 1; i < n; i++)
+    {
+        lv_area_t a = areas[i];
+        int j = i - 1;
+        for (; j >= 0 && (areas[j].y1 > a.y1 || (areas[j].y1 == a.y1 && areas[j].x1 > a.x1)); j--)
+            areas[j + 1] = areas[j];
+        areas[j + 1] = a;
+    }
+
+    for (int i = 0; i < n; i++)
+        disp->inv_area_joined[i] = 0;
+    disp->inv_p = n;
+    areas_out += n;
+}
+
+static void refr_start_cb(lv_event_t *e)
+{
+    lv_display_t *disp = static_cast<lv_display_t *>(lv_event_get_target(e));
+
+    // Same layout pass LVGL runs right after this event: it can still invalidate areas
+    lv_obj_update_layout(lv_display_get_screen_active(disp));
+    lv_obj_update_layout(lv_display_get_layer_top(disp));
+    lv_obj_update_layout(lv_display_get_layer_sys(disp));
+    coalesce(disp);
+}
+
+static void render_ready_cb(lv_event_t *e)
+{
+    frames++;
+}
+
+static void report_timer_cb(lv_timer_t *timer)
+{
+    static flush_hooks_stats_t last;
+    static uint32_t last_frames, last_keystrokes, last_areas_in, last_areas_out;
+
+    const flush_hooks_stats_t *stats = flush_hooks_get_stats();
+    uint32_t tx = stats->transactions - last.transactions;
+    uint32_t bytes = stats->bytes - last.bytes;
+    uint32_t n_frames = frames - last_frames;
+    uint32_t n_keys = keystrokes - last_keystrokes;
+
+    if (tx > 0)
+    {
+        uint32_t bus_us = flush_scheduler_model_us(bytes, tx);
+        log_i("Flush: %lu frames, %lu tx, %lu bytes (%lu B/frame, %lu B/key), bus %lu us (%lu.%lu%%), areas %lu -> %lu",
+              (unsigned long)n_frames, (unsigned long)tx, (unsigned long)bytes,
+              (unsigned long)(n_frames ? bytes / n_frames : 0), (unsigned long)(n_keys ? bytes / n_keys : 0),
+              (unsigned long)bus_us, (unsigned long)(bus_us / (FLUSH_SCHEDULER_REPORT_MS * 10)),
+              (unsigned long)(bus_us / FLUSH_SCHEDULER_REPORT_MS % 10),
+              (unsigned long)(areas_in - last_areas_in), (unsigned long)(areas_out - last_areas_out));
+    }
+
+    last = *stats;
+    last_frames = frames;
+    last_keystrokes = keystrokes;
+    last_areas_in = areas_in;
+    last_areas_out = areas_out;
+}
+
+void flush_scheduler_init(lv_display_t *disp)
+{
+#if FLUSH_SCHEDULER
+    lv_display_add_event_cb(disp, refr_start_cb, LV_EVENT_REFR_START, NULL);
+#endif
+    lv_display_add_event_cb(disp, render_ready_cb, LV_EVENT_RENDER_READY, NULL);
+    lv_timer_create(report_timer_cb, FLUSH_SCHEDULER_REPORT_MS, NULL);
+}
+
+void flush_scheduler_mark_input()
+{
+    keystrokes++;
+}
+
+uint32_t flush_scheduler_model_us(uint32_t bytes, uint32_t transactions)
+{
+    return (uint64_t)bytes * 8 * 1000000 / FLUSH_SCHEDULER_BUS_HZ + transactions * FLUSH_SCHEDULER_TX_OVERHEAD_US;
+}
@@ -0,0 +1,171 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include "glyph_atlas.h"
+
+typedef struct
+{
+    char text[GLYPH_ATLAS_MAX_TEXT];
+    lv_image_dsc_t dsc;
+} atlas_entry_t;
+
+static atlas_entry_t entries[GLYPH_ATLAS_MAX_ENTRIES];
+static int entry_count = 0;
+static int8_t char_index[128]; // Direct lookup for single ASCII characters, -1: none
+static uint8_t *pixels = NULL;
+static size_t pixels_size = 0;
+
+static int find_entry(const char *text)
+{
+    for (int i = 0; i < entry_count; i++)
+        if (strcmp(entries[i].text, text) == 0)
+            return i;
+
+    return -1;
+}
+
+static void add_entry(const char *text, const lv_font_t *font)
+{
+    if (find_entry(text) >= 0 || strlen(text) >= GLYPH_ATLAS_MAX_TEXT)
+        return;
+
+    if (entry_count >= GLYPH_ATLAS_MAX_ENTRIES)
+    {
+        log_e("Glyph atlas full, \"%s\" not added", text);
+        return;
+    }
+
+    lv_point_t size;
+    lv_text_get_size(&size, text, font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    if (size.x <= 0 || size.y <= 0)
+        return;
+
+    atlas_entry_t *entry = &entries[entry_count++];
+    strcpy(entry->text, text);
+    entry->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    entry->dsc.header.cf = LV_COLOR_FORMAT_A8;
+    entry->dsc.header.w = size.x;
+    entry->dsc.header.h = size.y;
+    entry->dsc.header.stride = size.x;
+    entry->dsc.data_size = size.x * size.y;
+}
+
+bool glyph_atlas_build(const lv_font_t *font, const char *const *chars, int chars_count, const char *const *labels, int labels_count)
+{
+    uint32_t start = micros();
+
+    // Built again for another keymap: the bitmaps shown so far are dropped
+    for (int i = 0; i < entry_count; i++)
+        lv_image_cache_drop(&entries[i].dsc); // Same descriptors, new pixels
+    free(pixels);
+    pixels = NULL;
+    pixels_size = 0;
+    entry_count = 0;
+
+    for (int i = 0; i < chars_count; i++)
+        for (const char *c = chars[i]; *c;)
+        {
+            // UTF-8: a character is 1 to 4 bytes
+            char text[5] = {};
+            uint8_t len = LV_MIN(lv_text_encoded_size(c), 4);
+            if (strnlen(c, len) < len)
+                break;
+            memcpy(text, c, len);
+            add_entry(text, font);
+            c += len;
+        }
+
+    for (int i = 0; i < labels_count; i++)
+        add_entry(labels[i], font);
+
+    // One pool for all bitmaps, and a scratch canvas as large as the largest entry
+    lv_coord_t max_w = 0, max_h = 0;
+    pixels_size = 0;
+    for (int i = 0; i < entry_count; i++)
+    {
+        max_w = LV_MAX(max_w, (lv_coord_t)entries[i].dsc.header.w);
+        max_h = LV_MAX(max_h, (lv_coord_t)entries[i].dsc.header.h);
+        pixels_size += entries[i].dsc.data_size;
+    }
+
+    pixels = (uint8_t *)malloc(pixels_size);
+    uint16_t *canvas_buf = (uint16_t *)malloc(max_w * max_h * sizeof(uint16_t));
+    if (!pixels || !canvas_buf)
+    {
+        log_e("Failed to allocate memory for the glyph atlas");
+        free(pixels);
+        free(canvas_buf);
+        pixels = NULL;
+        // Images still showing an entry draw nothing
+        for (int i = 0; i < entry_count; i++)
+            entries[i].dsc.header.w = entries[i].dsc.header.h = entries[i].dsc.data_size = 0;
+        entry_count = 0;
+        return false;
+    }
+
+    // Render white on black; any channel of the result is the glyph coverage
+    lv_obj_t *canvas = lv_canvas_create(NULL);
+    uint8_t *dest = pixels;
+    for (int i = 0; i < entry_count; i++)
+    {
+        atlas_entry_t *entry = &entries[i];
+        lv_coord_t w = entry->dsc.header.w;
+        lv_coord_t h = entry->dsc.header.h;
+
+        lv_canvas_set_buffer(canvas, canvas_buf, w, h, LV_COLOR_FORMAT_RGB565);
+        lv_canvas_fill_bg(canvas, lv_color_hex(0x000000), LV_OPA_COVER);
+
+        lv_layer_t layer;
+        lv_canvas_init_layer(canvas, &layer);
+        lv_draw_label_dsc_t label_dsc;
+        lv_draw_label_dsc_init(&label_dsc);
+        label_dsc.font = font;
+        label_dsc.color = lv_color_hex(0xffffff);
+        label_dsc.text = entry->text;
+        lv_area_t coords = {0, 0, w - 1, h - 1};
+        lv_draw_label(&layer, &label_dsc, &coords);
+        lv_canvas_finish_layer(canvas, &layer);
+
+        // Expand the 6 bit green channel to 8 bit coverage
+        for (lv_coord_t p = 0; p < w * h; p++)
+        {
+            uint8_t g = (canvas_buf[p] >> 5) & 0x3F;
+            dest[p] = (g << 2) | (g >> 4);
+        }
+
+        entry->dsc.data = dest;
+        dest += entry->dsc.data_size;
+    }
+
+    lv_obj_delete(canvas);
+    free(canvas_buf);
+
+    memset(char_index, -1, sizeof(char_index));
+    for (int i = 0; i < entry_count; i++)
+        if (entries[i].text[1] == '\0' && (uint8_t)entries[i].text[0] < 128)
+            char_index[(uint8_t)entries[i].text[0]] = i;
+
+    log_i("Glyph atlas: %d entries, %u bytes, built in %lu us", entry_count, (unsigned)glyph_atlas_footprint(), (unsigned long)(micros() - start));
+    return true;
+}
+
+const lv_image_dsc_t *glyph_atlas_get_char(char c)
+{
+    if (!pixels || (uint8_t)c >= 128 || char_index[(uint8_t)c] < 0)
+        return NULL;
+
+    return &entries[char_index[(uint8_t)c]].dsc;
+}
+
+const lv_image_dsc_t *glyph_atlas_get_label(const char *text)
+{
+    if (!pixels)
+        return NULL;
+
+    int i = find_entry(text);
+    return i < 0 ? NULL : &entries[i].dsc;
+}
+
+size_t glyph_atlas_footprint()
+{
+    return pixels_size + entry_count * sizeof(atlas_entry_t) + sizeof(char_index);
+}
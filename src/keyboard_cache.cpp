@@ -0,0 +1,141 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include "keyboard_cache.h"
+
+static lv_obj_t *cached_area;
+static uint32_t cache_buf_size = 0;
+static lv_color_format_t cache_cf;
+static bool serving = false;
+
+// A bitmap per image (keyboard layer), allocated when first rendered
+static struct
+{
+    lv_image_dsc_t dsc;
+    uint8_t *buf;
+    bool rendered; // Since the last keyboard_cache_invalidate
+} images[KEYBOARD_CACHE_MAX_IMAGES];
+static int shown = -1; // Image drawn while serving
+
+// Idle keys are not drawn at all (lv_obj_refr skips objects with opa_layered 0);
+// the live style restores them while they differ from the cached image
+static lv_style_t style_cached;
+static lv_style_t style_live;
+
+static void kb_area_draw_cb(lv_event_t *e)
+{
+    if (!serving)
+        return;
+
+    lv_obj_t *obj = static_cast<lv_obj_t *>(lv_event_get_current_target(e));
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+
+    // Plain copy, replaces the background fill and every idle key
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = &images[shown].dsc;
+    lv_draw_image(lv_event_get_layer(e), &dsc, &coords);
+
+    // Skip the default background drawing
+    lv_event_stop_processing(e);
+}
+
+static void set_serving(bool enabled)
+{
+    serving = enabled && shown >= 0;
+    lv_style_set_opa_layered(&style_cached, serving ? LV_OPA_TRANSP : LV_OPA_COVER);
+    lv_obj_report_style_change(&style_cached);
+    if (cached_area)
+        lv_obj_invalidate(cached_area);
+}
+
+bool keyboard_cache_init(lv_obj_t *kb_area)
+{
+    lv_obj_update_layout(kb_area);
+    // Same format as the display renders (RGB565, or L8 in 8 bit mode)
+    cache_cf = lv_display_get_color_format(lv_obj_get_display(kb_area));
+    cache_buf_size = lv_snapshot_buf_size_needed(kb_area, cache_cf);
+    // The first image: without room for one, there's no point in the others
+    images[0].buf = (uint8_t *)heap_caps_malloc(cache_buf_size, MALLOC_CAP_SPIRAM);
+    if (!images[0].buf)
+    {
+        log_w("Keyboard cache: no PSRAM for %lu bytes, keyboard drawn live", (unsigned long)cache_buf_size);
+        return false;
+    }
+
+    lv_style_init(&style_cached);
+    lv_style_set_opa_layered(&style_cached, LV_OPA_COVER);
+    lv_style_init(&style_live);
+    lv_style_set_opa_layered(&style_live, LV_OPA_COVER);
+
+    cached_area = kb_area;
+    // Preprocess, so the handler runs before (and can stop) the default drawing
+    lv_obj_add_event_cb(kb_area, kb_area_draw_cb, (lv_event_code_t)(LV_EVENT_DRAW_MAIN | LV_EVENT_PREPROCESS), NULL);
+    return true;
+}
+
+void keyboard_cache_add_key(lv_obj_t *key)
+{
+    if (!cached_area)
+        return;
+
+    lv_obj_add_style(key, &style_cached, 0);
+    lv_obj_add_style(key, &style_live, LV_STATE_PRESSED);
+    lv_obj_add_style(key, &style_live, KEYBOARD_CACHE_STATE_LIVE);
+}
+
+void keyboard_cache_render(uint8_t image)
+{
+    if (!cached_area || image >= KEYBOARD_CACHE_MAX_IMAGES)
+        return;
+
+    uint32_t start = micros();
+
+    // Render with every key visible and without the cache
+    shown = -1;
+    set_serving(false);
+    if (!images[image].buf)
+        images[image].buf = (uint8_t *)heap_caps_malloc(cache_buf_size, MALLOC_CAP_SPIRAM);
+    if (!images[image].buf)
+    {
+        log_w("Keyboard cache: no PSRAM for image %u, drawn live", image);
+        return;
+    }
+    lv_result_t res = lv_snapshot_take_to_buf(cached_area, cache_cf, &images[image].dsc, images[image].buf, cache_buf_size);
+    if (res != LV_RESULT_OK)
+    {
+        log_e("Keyboard cache: snapshot failed, keyboard drawn live");
+        return;
+    }
+
+    // The buffer may be reused, drop a decoded copy the image cache may hold
+    lv_image_cache_drop(&images[image].dsc);
+    images[image].rendered = true;
+    shown = image;
+    set_serving(true);
+
+    log_i("Keyboard cache: image %u, %ldx%ld, %lu bytes, rendered in %lu us", image, (long)images[image].dsc.header.w,
+          (long)images[image].dsc.header.h, (unsigned long)cache_buf_size, (unsigned long)(micros() - start));
+}
+
+bool keyboard_cache_show(uint8_t image)
+{
+    if (image >= KEYBOARD_CACHE_MAX_IMAGES || !images[image].rendered)
+        return false;
+
+    // Only the bitmap is swapped; the glyphs set by the caller invalidated their areas
+    shown = image;
+    set_serving(true);
+    return true;
+}
+
+void keyboard_cache_invalidate()
+{
+    for (int i = 0; i < KEYBOARD_CACHE_MAX_IMAGES; i++)
+        images[i].rendered = false;
+}
+
+void keyboard_cache_set_enabled(bool enabled)
+{
+    set_serving(enabled);
+}
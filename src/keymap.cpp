@@ -0,0 +1,249 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <esp_rom_crc.h>
+#include <string.h>
+#include "keymap.h"
+
+static_assert(sizeof(keymap_header_t) == 24, "keymap header layout");
+static_assert(sizeof(keymap_layer_t) == 88, "keymap layer layout");
+static_assert(sizeof(keymap_alternate_t) == 4, "keymap alternate layout");
+
+#define KEYMAP_MAX_PATH 48
+
+// The selected keymap, checked: the accessors index it without further tests (keymap_init first)
+static const uint8_t *keymap;
+static const keymap_header_t *header;
+static const keymap_layer_t *layers;
+static const keymap_alternate_t *alternates;
+static uint8_t *loaded = NULL;          // Read from LittleFS, NULL: the built-in one is selected
+static char selected_path[KEYMAP_MAX_PATH]; // "": built in
+
+// --- Checks ---
+
+static bool string_ok(const uint8_t *data, uint32_t size, uint16_t offset)
+{
+    return offset < size && memchr(data + offset, '\0', size - offset) != NULL;
+}
+
+// NULL when data is a keymap this firmware can use in place, else what is wrong
+static const char *check(const uint8_t *data, uint32_t size)
+{
+    const keymap_header_t *h = (const keymap_header_t *)data;
+    if (((uintptr_t)data & 3) || size < sizeof(*h) || size > KEYMAP_MAX_SIZE || h->magic != KEYMAP_MAGIC || h->size != size)
+        return "not a keymap";
+    if (h->crc != esp_rom_crc32_le(0, data + 8, size - 8))
+        return "CRC mismatch";
+    if (h->layer_count == 0 || h->layer_count > KEYMAP_MAX_LAYERS || (h->layers & 1) || (h->alternates & 1) ||
+        h->layers + h->layer_count * sizeof(keymap_layer_t) > size ||
+        h->alternates + h->alternate_count * sizeof(keymap_alternate_t) > size || !string_ok(data, size, h->name))
+        return "tables out of bounds";
+
+    const keymap_layer_t *l = (const keymap_layer_t *)(data + h->layers);
+    for (int i = 0; i < KEYMAP_ACTION_KEYS; i++)
+        if (h->actions[i] > KEYMAP_ACTION_LAYER)
+            return "unknown action";
+    for (int layer = 0; layer < h->layer_count; layer++, l++)
+    {
+        for (int key = 0; key < KEYMAP_KEYS; key++)
+            for (int slot = 0; slot < KEYMAP_SLOTS; slot++)
+                if (!string_ok(data, size, l->slots[key][slot]))
+                    return "key string out of bounds";
+        for (int i = 0; i < KEYMAP_ACTION_KEYS; i++)
+            if (!string_ok(data, size, l->labels[i]) || l->targets[i] >= h->layer_count)
+                return "action key out of bounds";
+    }
+
+    const keymap_alternate_t *a = (const keymap_alternate_t *)(data + h->alternates);
+    for (int i = 0; i < h->alternate_count; i++)
+        if (!string_ok(data, size, a[i].character) || !string_ok(data, size, a[i].alternates) ||
+            (i > 0 && strcmp((const char *)data + a[i - 1].character, (const char *)data + a[i].character) >= 0))
+            return "alternates out of bounds or order";
+    return NULL;
+}
+
+static void use(const uint8_t *data)
+{
+    keymap = data;
+    header = (const keymap_header_t *)data;
+    layers = (const keymap_layer_t *)(data + header->layers);
+    alternates = (const keymap_alternate_t *)(data + header->alternates);
+}
+
+// --- Selection ---
+
+static bool select_builtin()
+{
+    const char *error = check(keymap_builtin, keymap_builtin_size);
+    if (error)
+    {
+        // The build checks it: only a broken build gets here
+        log_e("Keymap: built-in keymap: %s", error);
+        return false;
+    }
+    use(keymap_builtin);
+    free(loaded);
+    loaded = NULL;
+    selected_path[0] = '\0';
+    log_i("Keymap: %s, built in", keymap_name());
+    return true;
+}
+
+static bool select_file(const char *path)
+{
+    uint32_t start = micros();
+    File file = LittleFS.open(path, "r");
+    if (!file)
+    {
+        log_e("Keymap: cannot read %s", path);
+        return false;
+    }
+    size_t size = file.size();
+    uint8_t *data = size <= KEYMAP_MAX_SIZE ? (uint8_t *)malloc(size) : NULL; // malloc aligns it
+    bool read = data && file.read(data, size) == size;
+    file.close();
+
+    const char *error = read ? check(data, size) : "cannot read it";
+    if (error)
+    {
+        log_e("Keymap: %s: %s", path, error);
+        free(data);
+        return false;
+    }
+
+    // Labels still pointing at the old strings are set again before the next frame (keymap.h)
+    use(data);
+    free(loaded);
+    loaded = data;
+    snprintf(selected_path, sizeof(selected_path), "%s", path);
+    log_i("Keymap: %s from %s, %u bytes, checked in %lu us", keymap_name(), path, (unsigned)size,
+          (unsigned long)(micros() - start));
+    return true;
+}
+
+static void save_selection()
+{
+    if (!selected_path[0])
+    {
+        LittleFS.remove(KEYMAP_SELECTION_PATH);
+        return;
+    }
+    File file = LittleFS.open(KEYMAP_SELECTION_PATH, "w");
+    if (!file || file.write((const uint8_t *)selected_path, strlen(selected_path)) != strlen(selected_path))
+        log_e("Keymap: cannot write %s", KEYMAP_SELECTION_PATH);
+    file.close();
+}
+
+static int compare_paths(const void *a, const void *b)
+{
+    return strcmp((const char *)a, (const char *)b);
+}
+
+// The *.kmp in KEYMAP_DIR, sorted
+static int list_files(char paths[KEYMAP_MAX_FILES][KEYMAP_MAX_PATH])
+{
+    int count = 0;
+    File dir = LittleFS.open(KEYMAP_DIR);
+    if (!dir || !dir.isDirectory())
+        return 0;
+    for (File file = dir.openNextFile(); file && count < KEYMAP_MAX_FILES; file = dir.openNextFile())
+    {
+        size_t len = strlen(file.name());
+        if (!file.isDirectory() && len > 4 && strcmp(file.name() + len - 4, ".kmp") == 0 &&
+            snprintf(paths[count], KEYMAP_MAX_PATH, "%s/%s", KEYMAP_DIR, file.name()) < KEYMAP_MAX_PATH)
+            count++;
+    }
+    qsort(paths, count, KEYMAP_MAX_PATH, compare_paths);
+    return count;
+}
+
+void keymap_init()
+{
+    select_builtin();
+    if (!LittleFS.begin(true))
+        return;
+
+    char path[KEYMAP_MAX_PATH] = {};
+    File file = LittleFS.open(KEYMAP_SELECTION_PATH, "r");
+    if (!file)
+        return;
+    file.read((uint8_t *)path, sizeof(path) - 1);
+    file.close();
+    if (!select_file(path))
+        log_w("Keymap: %s selected, using the built-in keymap", path);
+}
+
+bool keymap_select_next()
+{
+    if (!LittleFS.begin(true))
+        return false;
+
+    char paths[KEYMAP_MAX_FILES][KEYMAP_MAX_PATH];
+    int count = list_files(paths);
+    // -1: the built-in one
+    int current = -1;
+    for (int i = 0; i < count; i++)
+        if (strcmp(paths[i], selected_path) == 0)
+            current = i;
+
+    // The next one that loads, once round: the built-in one (-1), then the files
+    for (int step = 1; step <= count; step++)
+    {
+        int i = (current + 1 + step) % (count + 1) - 1;
+        if (i < 0 ? select_builtin() : select_file(paths[i]))
+        {
+            save_selection();
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *keymap_name()
+{
+    return (const char *)keymap + header->name;
+}
+
+// --- Lookups ---
+
+uint8_t keymap_layer_count()
+{
+    return header->layer_count;
+}
+
+const char *keymap_slot(uint8_t layer, int key, int slot)
+{
+    return (const char *)keymap + layers[layer].slots[key][slot];
+}
+
+const char *keymap_label(uint8_t layer, int action_key)
+{
+    return (const char *)keymap + layers[layer].labels[action_key];
+}
+
+keymap_action_t keymap_action(int action_key)
+{
+    return (keymap_action_t)header->actions[action_key];
+}
+
+uint8_t keymap_target(uint8_t layer, int action_key)
+{
+    return layers[layer].targets[action_key];
+}
+
+const char *keymap_alternates(const char *character)
+{
+    // Sorted by the compiler
+    int low = 0, high = header->alternate_count - 1;
+    while (low <= high)
+    {
+        int mid = (low + high) / 2;
+        int order = strcmp(character, (const char *)keymap + alternates[mid].character);
+        if (order == 0)
+            return (const char *)keymap + alternates[mid].alternates;
+        if (order < 0)
+            high = mid - 1;
+        else
+            low = mid + 1;
+    }
+    return NULL;
+}
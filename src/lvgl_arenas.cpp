@@ -0,0 +1,493 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include <multi_heap.h>
+#include "lvgl_arenas.h"
+
+#if LVGL_ARENAS
+
+typedef struct
+{
+    const char *name;
+    uint8_t *base; // NULL: not available
+    size_t size;
+    multi_heap_handle_t heap;
+    size_t capacity;        // Free bytes when empty
+    uint32_t pinned_frames; // Frames that ended with live blocks
+    uint32_t fallbacks;     // Allocations this arena was selected for but couldn't take
+    uint32_t failures;      // Of those, the ones no other arena could take either
+} arena_t;
+
+typedef struct
+{
+    arena_t arenas[LVGL_ARENA_COUNT];
+    lvgl_arena_id_t selected;
+    bool system_fallback; // The system heap is the last resort
+} arena_set_t;
+
+typedef struct
+{
+    size_t used;
+    size_t peak;
+    size_t free;
+    size_t largest_free;
+    size_t blocks;
+    size_t free_blocks;
+} arena_stats_t;
+
+// Where an allocation goes when the selected arena is exhausted
+static const lvgl_arena_id_t fallback_order[LVGL_ARENA_COUNT][LVGL_ARENA_COUNT] = {
+    {LVGL_ARENA_UI, LVGL_ARENA_TEXT, LVGL_ARENA_COUNT},
+    {LVGL_ARENA_SCRATCH, LVGL_ARENA_UI, LVGL_ARENA_TEXT},
+    {LVGL_ARENA_TEXT, LVGL_ARENA_UI, LVGL_ARENA_COUNT},
+};
+
+// --- Arenas ---
+
+static void arena_init(arena_t *arena, const char *name, void *base, size_t size)
+{
+    memset(arena, 0, sizeof(*arena));
+    arena->name = name;
+    if (!base)
+        return;
+    arena->base = (uint8_t *)base;
+    arena->size = size;
+    // The heap's bookkeeping lives in the region too
+    arena->heap = multi_heap_register(base, size);
+    if (!arena->heap)
+    {
+        arena->base = NULL;
+        return;
+    }
+    multi_heap_info_t info;
+    multi_heap_get_info(arena->heap, &info);
+    arena->capacity = info.total_free_bytes;
+}
+
+static bool arena_owns(const arena_t *arena, const void *p)
+{
+    return arena->base && (const uint8_t *)p >= arena->base && (const uint8_t *)p < arena->base + arena->size;
+}
+
+static void *arena_malloc(arena_t *arena, size_t size)
+{
+    return arena->base ? multi_heap_malloc(arena->heap, size) : NULL;
+}
+
+static void arena_free(arena_t *arena, void *p)
+{
+    multi_heap_free(arena->heap, p);
+}
+
+static size_t arena_block_size(arena_t *arena, void *p)
+{
+    return multi_heap_get_allocated_size(arena->heap, p);
+}
+
+static void arena_get_stats(arena_t *arena, arena_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    if (!arena->base)
+        return;
+    multi_heap_info_t info;
+    multi_heap_get_info(arena->heap, &info);
+    stats->used = info.total_allocated_bytes;
+    stats->peak = arena->capacity - info.minimum_free_bytes;
+    stats->free = info.total_free_bytes;
+    stats->largest_free = info.largest_free_block;
+    stats->blocks = info.allocated_blocks;
+    stats->free_blocks = info.free_blocks;
+}
+
+// Share of the free memory that the largest allocation possible can't use
+static uint8_t fragmentation_pct(size_t free, size_t largest_free)
+{
+    return free ? 100 - largest_free * 100 / free : 0;
+}
+
+// --- Arena Sets ---
+
+static arena_t *set_owner(arena_set_t *set, const void *p)
+{
+    for (int i = 0; i < LVGL_ARENA_COUNT; i++)
+        if (arena_owns(&set->arenas[i], p))
+            return &set->arenas[i];
+    return NULL;
+}
+
+static void *set_malloc(arena_set_t *set, size_t size)
+{
+    const lvgl_arena_id_t *order = fallback_order[set->selected];
+    void *p = arena_malloc(&set->arenas[order[0]], size);
+    if (p)
+        return p;
+
+    set->arenas[set->selected].fallbacks++;
+    for (int i = 1; i < LVGL_ARENA_COUNT && order[i] != LVGL_ARENA_COUNT && !p; i++)
+        p = arena_malloc(&set->arenas[order[i]], size);
+    if (!p && set->system_fallback)
+        p = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    if (!p)
+        set->arenas[set->selected].failures++;
+    return p;
+}
+
+static void set_free(arena_set_t *set, void *p)
+{
+    arena_t *owner = set_owner(set, p);
+    if (owner)
+        arena_free(owner, p);
+    else
+        heap_caps_free(p);
+}
+
+static void *set_realloc(arena_set_t *set, void *p, size_t size)
+{
+    arena_t *owner = set_owner(set, p);
+    // A block of the system heap stays there
+    if (!owner)
+        return heap_caps_realloc(p, size, MALLOC_CAP_8BIT);
+
+    // In place if the block is where it belongs; scratch never takes a block over
+    arena_t *selected = &set->arenas[set->selected];
+    if (owner == selected || set->selected == LVGL_ARENA_SCRATCH)
+    {
+        void *q = multi_heap_realloc(owner->heap, p, size);
+        if (q)
+            return q;
+    }
+
+    // Move; on failure the block is left as it was
+    size_t old_size = arena_block_size(owner, p);
+    void *q = set_malloc(set, size);
+    if (!q)
+        return NULL;
+    memcpy(q, p, old_size < size ? old_size : size);
+    arena_free(owner, p);
+    return q;
+}
+
+// --- LVGL Allocator ---
+
+static uint8_t ui_pool[LVGL_ARENA_UI_SIZE] __attribute__((aligned(8)));
+static uint8_t scratch_pool[LVGL_ARENA_SCRATCH_SIZE] __attribute__((aligned(8)));
+static arena_set_t lvgl_set;
+
+void lv_mem_init(void)
+{
+    arena_init(&lvgl_set.arenas[LVGL_ARENA_UI], "ui", ui_pool, sizeof(ui_pool));
+    arena_init(&lvgl_set.arenas[LVGL_ARENA_SCRATCH], "scratch", scratch_pool, sizeof(scratch_pool));
+    // No PSRAM: no text arena, the text goes to the UI arena
+    void *text_pool = heap_caps_malloc(LVGL_ARENA_TEXT_SIZE, MALLOC_CAP_SPIRAM);
+    arena_init(&lvgl_set.arenas[LVGL_ARENA_TEXT], "text", text_pool, LVGL_ARENA_TEXT_SIZE);
+    lvgl_set.selected = LVGL_ARENA_UI;
+    lvgl_set.system_fallback = true;
+    log_i("Arenas: ui %lu bytes, scratch %lu bytes, text %lu bytes%s",
+          (unsigned long)lvgl_set.arenas[LVGL_ARENA_UI].capacity,
+          (unsigned long)lvgl_set.arenas[LVGL_ARENA_SCRATCH].capacity,
+          (unsigned long)lvgl_set.arenas[LVGL_ARENA_TEXT].capacity, text_pool ? " in PSRAM" : " (no PSRAM)");
+}
+
+void lv_mem_deinit(void)
+{
+    // multi_heap has no unregister, the regions are just forgotten
+    if (lvgl_set.arenas[LVGL_ARENA_TEXT].base)
+        heap_caps_free(lvgl_set.arenas[LVGL_ARENA_TEXT].base);
+    memset(&lvgl_set, 0, sizeof(lvgl_set));
+}
+
+lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes)
+{
+    // The arenas are fixed
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool)
+{
+}
+
+void *lv_malloc_core(size_t size)
+{
+    return set_malloc(&lvgl_set, size);
+}
+
+void *lv_realloc_core(void *p, size_t new_size)
+{
+    return set_realloc(&lvgl_set, p, new_size);
+}
+
+void lv_free_core(void *p)
+{
+    if (p)
+        set_free(&lvgl_set, p);
+}
+
+// All arenas together
+void lv_mem_monitor_core(lv_mem_monitor_t *mon_p)
+{
+    for (int i = 0; i < LVGL_ARENA_COUNT; i++)
+    {
+        arena_stats_t stats;
+        arena_get_stats(&lvgl_set.arenas[i], &stats);
+        mon_p->total_size += lvgl_set.arenas[i].capacity;
+        mon_p->free_size += stats.free;
+        if (stats.largest_free > mon_p->free_biggest_size)
+            mon_p->free_biggest_size = stats.largest_free;
+        mon_p->used_cnt += stats.blocks;
+        mon_p->free_cnt += stats.free_blocks;
+        mon_p->max_used += stats.peak;
+    }
+    if (mon_p->total_size)
+        mon_p->used_pct = (mon_p->total_size - mon_p->free_size) * 100 / mon_p->total_size;
+    mon_p->frag_pct = fragmentation_pct(mon_p->free_size, mon_p->free_biggest_size);
+}
+
+lv_result_t lv_mem_test_core(void)
+{
+    for (int i = 0; i < LVGL_ARENA_COUNT; i++)
+        if (lvgl_set.arenas[i].base && !multi_heap_check(lvgl_set.arenas[i].heap, true))
+            return LV_RESULT_INVALID;
+    return LV_RESULT_OK;
+}
+
+// --- Frames and Reports ---
+
+lvgl_arena_id_t lvgl_arena_select(lvgl_arena_id_t arena)
+{
+    lvgl_arena_id_t previous = lvgl_set.selected;
+    lvgl_set.selected = arena;
+    return previous;
+}
+
+static lvgl_arena_id_t arena_before_render;
+
+static void render_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START)
+    {
+        arena_before_render = lvgl_arena_select(LVGL_ARENA_SCRATCH);
+        return;
+    }
+    lvgl_arena_select(arena_before_render);
+    // Caches filled while drawing (images, glyphs) outlive the frame; they only hold
+    // their own bytes of the scratch heap
+    arena_t *scratch = &lvgl_set.arenas[LVGL_ARENA_SCRATCH];
+    arena_stats_t stats;
+    arena_get_stats(scratch, &stats);
+    if (stats.blocks)
+        scratch->pinned_frames++;
+}
+
+static void report_timer_cb(lv_timer_t *timer)
+{
+    lvgl_arenas_report();
+}
+
+void lvgl_arenas_init(lv_display_t *disp)
+{
+    lv_display_add_event_cb(disp, render_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, render_event_cb, LV_EVENT_RENDER_READY, NULL);
+    lv_timer_create(report_timer_cb, LVGL_ARENAS_REPORT_MS, NULL);
+}
+
+static void report_arena(arena_t *arena)
+{
+    if (!arena->base)
+        return;
+    arena_stats_t stats;
+    arena_get_stats(arena, &stats);
+    log_i("Arena %-7s: %6lu / %6lu bytes used, peak %6lu, largest free %6lu (fragmentation %u%%), "
+          "%lu fallbacks, %lu failures",
+          arena->name, (unsigned long)stats.used, (unsigned long)arena->capacity, (unsigned long)stats.peak,
+          (unsigned long)stats.largest_free, fragmentation_pct(stats.free, stats.largest_free),
+          (unsigned long)arena->fallbacks, (unsigned long)arena->failures);
+}
+
+void lvgl_arenas_report()
+{
+    for (int i = 0; i < LVGL_ARENA_COUNT; i++)
+        report_arena(&lvgl_set.arenas[i]);
+    log_i("Arena scratch: %lu frames ended with live blocks",
+          (unsigned long)lvgl_set.arenas[LVGL_ARENA_SCRATCH].pinned_frames);
+}
+
+#if LVGL_ARENAS_SELFTEST
+// --- Soak Self-Test ---
+
+#define SOAK_UI_SIZE (24 * 1024U)
+#define SOAK_SCRATCH_SIZE (4 * 1024U)
+#define SOAK_TEXT_SIZE (16 * 1024U)
+#define SOAK_OPS 40000
+#define SOAK_SAMPLE_OPS 1000
+#define SOAK_SLOTS 96
+#define SOAK_FRAG_GROWTH_PCT 10 // Allowed growth of the worst fragmentation from the first half to the second
+
+static uint32_t soak_seed;
+
+static uint32_t soak_random(uint32_t n)
+{
+    // xorshift32, the same sequence on every run
+    soak_seed ^= soak_seed << 13;
+    soak_seed ^= soak_seed >> 17;
+    soak_seed ^= soak_seed << 5;
+    return soak_seed % n;
+}
+
+static bool soak_check(const uint8_t *p, size_t size, uint8_t fill)
+{
+    for (size_t i = 0; i < size; i++)
+        if (p[i] != fill)
+            return false;
+    return true;
+}
+
+void lvgl_arenas_selftest()
+{
+    // Private arenas, LVGL's are in use
+    uint8_t *mem = (uint8_t *)heap_caps_malloc(SOAK_UI_SIZE + SOAK_SCRATCH_SIZE + SOAK_TEXT_SIZE, MALLOC_CAP_8BIT);
+    if (!mem)
+    {
+        log_e("Arena self-test: no memory");
+        return;
+    }
+    static arena_set_t set;
+    arena_init(&set.arenas[LVGL_ARENA_UI], "ui", mem, SOAK_UI_SIZE);
+    arena_init(&set.arenas[LVGL_ARENA_SCRATCH], "scratch", mem + SOAK_UI_SIZE, SOAK_SCRATCH_SIZE);
+    arena_init(&set.arenas[LVGL_ARENA_TEXT], "text", mem + SOAK_UI_SIZE + SOAK_SCRATCH_SIZE, SOAK_TEXT_SIZE);
+    set.selected = LVGL_ARENA_UI;
+    set.system_fallback = false;
+    arena_t *ui = &set.arenas[LVGL_ARENA_UI];
+    arena_t *scratch = &set.arenas[LVGL_ARENA_SCRATCH];
+    soak_seed = 0x2545f491;
+
+    static struct
+    {
+        uint8_t *p;
+        size_t size;
+    } slots[SOAK_SLOTS];
+    memset(slots, 0, sizeof(slots));
+    size_t live = 0;
+    uint8_t *text = NULL;
+    size_t text_len = 0;
+    uint8_t worst_frag[2] = {}; // First and second half
+    int failures = 0;
+    uint32_t start = millis();
+
+    for (uint32_t op = 0; op < SOAK_OPS; op++)
+    {
+        uint32_t kind = soak_random(16);
+        if (kind < 9)
+        {
+            // Objects: create or delete one, with about half of the arena live
+            uint32_t i = soak_random(SOAK_SLOTS);
+            if (slots[i].p)
+            {
+                if (!soak_check(slots[i].p, slots[i].size, i))
+                    failures++;
+                set_free(&set, slots[i].p);
+                live -= slots[i].size;
+                slots[i].p = NULL;
+            }
+            else if (live < SOAK_UI_SIZE / 2)
+            {
+                size_t size = 16 + (soak_random(8) == 0 ? soak_random(1024) : soak_random(160));
+                slots[i].p = (uint8_t *)set_malloc(&set, size);
+                if (!slots[i].p)
+                {
+                    failures++;
+                    continue;
+                }
+                slots[i].size = size;
+                memset(slots[i].p, i, size);
+                live += size;
+            }
+        }
+        else if (kind < 13)
+        {
+            // A transient string
+            void *p = set_malloc(&set, 8 + soak_random(120));
+            if (!p)
+                failures++;
+            else
+                set_free(&set, p);
+        }
+        else if (kind < 15)
+        {
+            // The document grows by a word, or is cleared; at a third of the arena, growing
+            // it still fits when realloc has to copy
+            set.selected = LVGL_ARENA_TEXT;
+            size_t len = text_len > SOAK_TEXT_SIZE / 3 || soak_random(200) == 0 ? 0 : text_len + 1 + soak_random(24);
+            uint8_t *p = (uint8_t *)(text ? set_realloc(&set, text, len + 1) : set_malloc(&set, len + 1));
+            if (!p)
+                failures++;
+            else
+            {
+                for (size_t i = text_len; i < len; i++)
+                    p[i] = 'a' + i % 26;
+                text = p;
+                text_len = len;
+            }
+            set.selected = LVGL_ARENA_UI;
+        }
+        else
+        {
+            // A frame: layers and draw tasks, all freed by its end
+            set.selected = LVGL_ARENA_SCRATCH;
+            void *blocks[6];
+            int count = 1 + soak_random(6);
+            for (int i = 0; i < count; i++)
+                blocks[i] = set_malloc(&set, 32 + soak_random(600));
+            for (int i = 0; i < count; i++)
+                if (blocks[i])
+                    set_free(&set, blocks[i]);
+            arena_stats_t stats;
+            arena_get_stats(scratch, &stats);
+            if (stats.used != 0)
+                failures++;
+            set.selected = LVGL_ARENA_UI;
+        }
+
+        if ((op + 1) % SOAK_SAMPLE_OPS == 0)
+        {
+            arena_stats_t stats;
+            arena_get_stats(ui, &stats);
+            uint8_t frag = fragmentation_pct(stats.free, stats.largest_free);
+            uint8_t *worst = &worst_frag[op >= SOAK_OPS / 2];
+            if (frag > *worst)
+                *worst = frag;
+        }
+    }
+
+    // Contents intact, everything returned
+    for (uint32_t i = 0; i < SOAK_SLOTS; i++)
+    {
+        if (!slots[i].p)
+            continue;
+        if (!soak_check(slots[i].p, slots[i].size, i))
+            failures++;
+        set_free(&set, slots[i].p);
+    }
+    for (size_t i = 0; i < text_len; i++)
+        if (text[i] != 'a' + i % 26)
+        {
+            failures++;
+            break;
+        }
+    if (text)
+        set_free(&set, text);
+    arena_stats_t stats;
+    arena_get_stats(ui, &stats);
+    if (stats.used != 0 || !multi_heap_check(ui->heap, true))
+        failures++;
+    // Half the arena live must never need another arena
+    if (ui->fallbacks != 0 || worst_frag[1] > worst_frag[0] + SOAK_FRAG_GROWTH_PCT)
+        failures++;
+
+    log_i("Arena self-test: %s (%d failures), %lu ops in %lu ms, worst fragmentation %u%% / %u%% "
+          "(first / second half), ui peak %lu of %lu bytes, %lu ui fallbacks, %lu text fallbacks",
+          failures ? "FAILED" : "passed", failures, (unsigned long)SOAK_OPS, (unsigned long)(millis() - start),
+          worst_frag[0], worst_frag[1], (unsigned long)stats.peak, (unsigned long)ui->capacity,
+          (unsigned long)ui->fallbacks, (unsigned long)set.arenas[LVGL_ARENA_TEXT].fallbacks);
+    heap_caps_free(mem);
+}
+#endif
+#endif
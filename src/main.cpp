@@ -2,74 +2,385 @@
 #include <esp32_smartdisplay.h>
 #include <string.h> // Include for strlen, strcpy, strcat
 
+#include "flush_hooks.h"
+#include "flush_scheduler.h"
+#include "cursor_overlay.h"
+#include "glyph_atlas.h"
+#include "perf_hud.h"
+#include "draw_sw_asm_custom.h"
+#include "keyboard_cache.h"
+#include "color_l8.h"
+#include "ui_layout.h"
+#include "render_bench.h"
+#include "alt_popup.h"
+#include "touch_rollover.h"
+#include "touch_filter.h"
+#include "touch_trace.h"
+#include "doc_journal.h"
+#include "doc_store.h"
+#include "boot_trace.h"
+#include "warm_resume.h"
+#include "lvgl_arenas.h"
+#include "soak_test.h"
+#include "ui_fonts.h"
+#include "emoji_glyphs.h"
+#include "keymap.h"
+
 // --- Configuration ---
-// Define UI dimensions based on the desired portrait layout (like the HTML)
-#define UI_WIDTH 320
-#define UI_HEIGHT 480
-
-// Layout dimensions (matching CSS, adapted for 320x480 UI)
-#define STATUS_BAR_HEIGHT 20
-#define TEXT_AREA_HEIGHT 140 // 150 in web simulator but 140 in the diagram.
-#define KEYBOARD_PADDING 9
-#define TOP_ROW_HEIGHT 45
-#define BOTTOM_ROW_HEIGHT 40
-#define KEY_ROW_V_GAP 12
-// #define KEY_H_GAP 20 // Will be calculated based on key width and UI width
-#define TOP_ROW_H_GAP 20
-#define BOTTOM_ROW_H_GAP 18
-#define ACTION_BTN_WIDTH 60
-#define BLOB_KEY_WIDTH 62  // Fixed 62px width as requested
-#define BLOB_KEY_HEIGHT 50 // Fixed 50px height as requested
-
-// Calculate the height for the keyboard area
-#define KEYBOARD_HEIGHT (UI_HEIGHT - STATUS_BAR_HEIGHT - TEXT_AREA_HEIGHT)
+// UI dimensions: the board's resolution, the layout is computed for it at compile time (ui_layout.h)
+#define UI_WIDTH board_layout::width
+#define UI_HEIGHT board_layout::height
+
+// Layout dimensions (matching CSS, designed for a 320x480 UI and scaled)
+#define STATUS_BAR_HEIGHT board_layout::status_bar_height
+#define TEXT_AREA_HEIGHT board_layout::text_area_height
+#define KEYBOARD_PADDING board_layout::keyboard_padding
+#define TOP_ROW_HEIGHT board_layout::top_row_height
+#define BOTTOM_ROW_HEIGHT board_layout::bottom_row_height
+#define TOP_ROW_H_GAP board_layout::top_row_h_gap
+#define BOTTOM_ROW_H_GAP board_layout::bottom_row_h_gap
+#define ACTION_BTN_WIDTH board_layout::action_btn_width
+#define BLOB_KEY_WIDTH board_layout::blob_key_width   // 62px at 320x480
+#define BLOB_KEY_HEIGHT board_layout::blob_key_height // 50px at 320x480
+#define BLOB_KEY_RADIUS board_layout::key_radius
+#define CURSOR_WIDTH 2
+#define TEXT_CURSOR_HEIGHT 20  // Match font size
+#define INPUT_CURSOR_HEIGHT 18
+
+// Height of the keyboard area
+#define KEYBOARD_HEIGHT board_layout::keyboard_height
+
+static_assert(INPUT_CURSOR_HEIGHT <= TOP_ROW_HEIGHT, "Input cursor taller than the input field");
+static_assert(TEXT_CURSOR_HEIGHT <= TEXT_AREA_HEIGHT, "Text cursor taller than the text area");
 
 // --- Colors ---
-#define COLOR_BUTTON lv_color_hex(0xf79b2b)
-#define COLOR_BUTTON_ACTIVE lv_color_hex(0x3aeb3a)
-#define COLOR_BLACK lv_color_hex(0x000000)
-#define COLOR_WHITE lv_color_hex(0xffffff)
-#define COLOR_STATUS_BAR_TEXT COLOR_WHITE
-#define COLOR_TEXT_AREA_BG COLOR_WHITE
-#define COLOR_TEXT_AREA_TEXT COLOR_BLACK
-#define COLOR_KEYBOARD_BG COLOR_BLACK
-#define COLOR_INPUT_BG COLOR_WHITE
-#define COLOR_INPUT_TEXT COLOR_BLACK
-#define COLOR_CURSOR lv_color_hex(0x0004d4)
-#define COLOR_CURSOR_INPUT COLOR_BUTTON
+// Constant expressions, so the style tables below are initialized at compile time
+static constexpr lv_color_t COLOR_BUTTON_RGB = LV_COLOR_MAKE(0xf7, 0x9b, 0x2b);
+static constexpr lv_color_t COLOR_BUTTON_ACTIVE_RGB = LV_COLOR_MAKE(0x3a, 0xeb, 0x3a);
+#if LV_COLOR_DEPTH == 8
+// Rendered as a gray level (COLOR_L8_INK), tinted back by the colour regions in the flush path
+static constexpr lv_color_t COLOR_BUTTON = LV_COLOR_MAKE(COLOR_L8_INK_LEVEL, COLOR_L8_INK_LEVEL, COLOR_L8_INK_LEVEL);
+static constexpr lv_color_t COLOR_BUTTON_ACTIVE = COLOR_BUTTON;
+#else
+static constexpr lv_color_t COLOR_BUTTON = COLOR_BUTTON_RGB;
+static constexpr lv_color_t COLOR_BUTTON_ACTIVE = COLOR_BUTTON_ACTIVE_RGB;
+#endif
+static constexpr lv_color_t COLOR_BLACK = LV_COLOR_MAKE(0x00, 0x00, 0x00);
+static constexpr lv_color_t COLOR_WHITE = LV_COLOR_MAKE(0xff, 0xff, 0xff);
+static constexpr lv_color_t COLOR_STATUS_BAR_TEXT = COLOR_WHITE;
+static constexpr lv_color_t COLOR_TEXT_AREA_BG = COLOR_WHITE;
+static constexpr lv_color_t COLOR_TEXT_AREA_TEXT = COLOR_BLACK;
+static constexpr lv_color_t COLOR_KEYBOARD_BG = COLOR_BLACK;
+static constexpr lv_color_t COLOR_INPUT_BG = COLOR_WHITE;
+static constexpr lv_color_t COLOR_INPUT_TEXT = COLOR_BLACK;
+static constexpr lv_color_t COLOR_CURSOR = LV_COLOR_MAKE(0x00, 0x04, 0xd4);
+static constexpr lv_color_t COLOR_CURSOR_INPUT = COLOR_BUTTON_RGB; // Drawn at flush time, always RGB565
 
 // --- Globals ---
 static lv_obj_t *scr;
 static lv_obj_t *text_content_label;
 static lv_obj_t *input_text_label;
-static lv_obj_t *text_cursor;
-static lv_obj_t *input_cursor;
+static int text_cursor = -1;  // Cursor overlay ids, drawn at flush time
+static int input_cursor = -1;
 static lv_timer_t *cursor_timer;
 
 static char input_buffer[128] = "";
+static bool document_resumed; // The document came from the warm resume snapshot
+
+#if DOC_STORE
+// The document lives in compressed blocks (doc_store.h); the label shows the decompressed
+// end of it in place
+#if SOAK_TEST
+static uint32_t document_length() { return doc_store_length(); }
+#endif
+
+static void set_document_text(const char *text)
+{
+    doc_store_clear();
+    doc_store_append(text, strlen(text));
+    lv_label_set_text_static(text_content_label, doc_store_view());
+}
+
+static bool append_document_text(const char *text)
+{
+    bool ok = doc_store_append(text, strlen(text));
+    lv_label_set_text_static(text_content_label, doc_store_view());
+    return ok;
+}
+
+#if DOC_JOURNAL
+static const doc_journal_text_t document = {doc_store_length, doc_store_read};
+#endif
+#else
+// The document is the label's text, in the text arena (PSRAM), apart from the UI objects
+#if DOC_JOURNAL || SOAK_TEST
+static uint32_t document_length() { return strlen(lv_label_get_text(text_content_label)); }
+#endif
+
+static void set_document_text(const char *text)
+{
+#if LVGL_ARENAS
+    lvgl_arena_id_t previous = lvgl_arena_select(LVGL_ARENA_TEXT);
+    lv_label_set_text(text_content_label, text);
+    lvgl_arena_select(previous);
+#else
+    lv_label_set_text(text_content_label, text);
+#endif
+}
+
+static bool append_document_text(const char *text)
+{
+    const char *current_text = lv_label_get_text(text_content_label);
+    char *new_text = (char *)malloc(strlen(current_text) + strlen(text) + 1);
+    if (!new_text)
+        return false;
+    strcpy(new_text, current_text);
+    strcat(new_text, text);
+    set_document_text(new_text);
+    free(new_text);
+    return true;
+}
+
+#if DOC_JOURNAL
+static bool document_read(uint32_t offset, char *buf, uint32_t len)
+{
+    memcpy(buf, lv_label_get_text(text_content_label) + offset, len);
+    return true;
+}
+static const doc_journal_text_t document = {document_length, document_read};
+#endif
+#endif
+#if DOC_JOURNAL
+static doc_journal_t doc_journal;
+#endif
 static int active_blob_key_letter_index = -1; // 0: left, 1: center, 2: right
 static lv_point_t last_touch_point = {0, 0};
 
+// --- Keyboard Layout ---
+// The layers of the selected keymap (keymap.h), swapped into the same key objects
+// Positions of the action keys, in the order of the keymap's action keys
+enum
+{
+    ACTION_KEY_CLEAR,
+    ACTION_KEY_ACCEPT,
+    ACTION_KEY_SPACE, // A long press switches keymaps
+    ACTION_KEY_SHIFT,
+    ACTION_KEY_NUMBERS,
+};
+static uint8_t current_layer = 0;
+
+#if EMOJI_LAYER
+// The emoji picker replaces the letters of the blob keys with a page of the emoji pack;
+// shift pages on ("more"), 123 goes back to current_layer. A long press on 123 opens it
+#define EMOJI_PAGE_SIZE 36
+static int32_t emoji_page = -1; // Shown page, -1: a layer of the keymap is shown
+static int32_t emoji_last_page = 0;
+static uint32_t emoji_key_codepoints[12][3];          // 0: none
+static const lv_image_dsc_t *emoji_key_glyphs[12][3]; // Pinned in the emoji cache while shown
+static char emoji_key_text[12][3][5];                  // UTF-8, for label glyphs
+static const char *const picker_labels[] = {"more", "abc"}; // On shift and 123
+#endif
+
+static lv_obj_t *blob_keys[12]; // user_data: the index
+static lv_obj_t *action_keys[KEYMAP_ACTION_KEYS]; // ACTION_KEY_* order
+static const char *action_key_text[KEYMAP_ACTION_KEYS]; // Shown labels, NULL: to be set
+static bool action_long_pressed = false; // The click that follows does the long press action
+static bool blob_key_clipped[12];        // Corner clipping enabled (style_blob_key_clip)
+static lv_obj_t *keyboard_area;
+static int keyboard_rows_created; // Top row, 3 blob key rows, bottom row
+#if LV_COLOR_DEPTH == 8
+static int active_key_region = -1; // Colour region following the key drawn in COLOR_BUTTON_ACTIVE
+static int alt_popup_region = -1;  // Colour region following the open alternates popup
+#endif
+
 // --- Styles ---
-static lv_style_t style_key;
-static lv_style_t style_key_pressed;
-static lv_style_t style_blob_key_cont;
-static lv_style_t style_input_cont;
-static lv_style_t style_text_area;
-static lv_style_t style_status_bar;
-static lv_style_t style_keyboard_area;
-static lv_style_t style_letter_label;
-static lv_style_t style_letter_label_active;
-static lv_style_t style_letter_label_hidden;
+// Constant property tables shared by the objects (LV_STYLE_CONST_INIT): they stay in
+// flash, and objects referencing them need no local style, which LVGL allocates per
+// object on its heap. Padding, transparent backgrounds and zero borders are LVGL's
+// defaults once an object's theme styles are removed, so they are not repeated.
+// Blob key pressed / selected: border in COLOR_BUTTON_ACTIVE (a custom state: the key
+// of a second finger is not pressed as far as LVGL is concerned)
+#define KEY_STATE_ACTIVE LV_STATE_USER_4
+
+// --- Key Style (Common for Action and Blob) ---
+static const lv_style_const_prop_t style_key_props[] = {
+    LV_STYLE_CONST_RADIUS(BLOB_KEY_RADIUS),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_BUTTON),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_BUTTON),
+    LV_STYLE_CONST_IMAGE_RECOLOR(COLOR_BUTTON), // Atlas glyphs are A8 images tinted by recolor
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_FONT(LV_FONT_DEFAULT), // Adjust font if needed
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),     // Center content (like labels)
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_key, style_key_props);
+
+// --- Key Pressed Style ---
+static const lv_style_const_prop_t style_key_pressed_props[] = {
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_BUTTON_ACTIVE),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_BUTTON_ACTIVE),
+    LV_STYLE_CONST_IMAGE_RECOLOR(COLOR_BUTTON_ACTIVE),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_key_pressed, style_key_pressed_props);
+
+// --- Blob Key Container Style ---
+static const lv_style_const_prop_t style_blob_key_cont_props[] = {
+    LV_STYLE_CONST_RADIUS(BLOB_KEY_RADIUS),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_BUTTON),
+    LV_STYLE_CONST_BG_COLOR(COLOR_BLACK),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    // No clip_corner: it renders every key redraw through an intermediate layer
+    // plus a mask pass. The letters never reach the corners (see children_clear_of_corners)
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_blob_key_cont, style_blob_key_cont_props);
+
+// --- Blob Key Active Style (KEY_STATE_ACTIVE) ---
+static const lv_style_const_prop_t style_blob_key_active_props[] = {
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_BUTTON_ACTIVE),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_blob_key_active, style_blob_key_active_props);
+
+// --- Blob Key Corner Clipping (fallback only) ---
+static const lv_style_const_prop_t style_blob_key_clip_props[] = {
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_blob_key_clip, style_blob_key_clip_props);
+
+// --- Input Container Style ---
+static const lv_style_const_prop_t style_input_cont_props[] = {
+    LV_STYLE_CONST_RADIUS(board_layout::input_radius),
+    LV_STYLE_CONST_BORDER_WIDTH(1),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_BUTTON),
+    LV_STYLE_CONST_BG_COLOR(COLOR_INPUT_BG),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PAD_LEFT(5),
+    LV_STYLE_CONST_PAD_RIGHT(5),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_LEFT_MID), // Align content vertically
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_input_cont, style_input_cont_props);
+
+// --- Input Text Style ---
+static const lv_style_const_prop_t style_input_text_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_INPUT_TEXT),
+    LV_STYLE_CONST_TEXT_FONT(UI_FONT_18),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_LEFT_MID), // Within input_cont padding
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_input_text, style_input_text_props);
+
+// --- Text Area Style ---
+static const lv_style_const_prop_t style_text_area_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_TEXT_AREA_BG),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PAD_TOP(10),
+    LV_STYLE_CONST_PAD_BOTTOM(10),
+    LV_STYLE_CONST_PAD_LEFT(10),
+    LV_STYLE_CONST_PAD_RIGHT(10),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_text_area, style_text_area_props);
+
+// --- Text Content Style ---
+static const lv_style_const_prop_t style_text_content_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_MAX_HEIGHT(LV_PCT(100)), // Constrain height
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_TEXT_AREA_TEXT),
+    LV_STYLE_CONST_TEXT_FONT(UI_FONT_20),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_text_content, style_text_content_props);
+
+// --- Status Bar Style ---
+static const lv_style_const_prop_t style_status_bar_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_BLACK),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_STATUS_BAR_TEXT),
+    LV_STYLE_CONST_PAD_LEFT(10),
+    LV_STYLE_CONST_PAD_RIGHT(10),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_status_bar, style_status_bar_props);
+
+// --- Status Bar Dots ---
+static const lv_style_const_prop_t style_dots_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_LEFT_MID),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX),
+    LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_PAD_COLUMN(3),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_dots, style_dots_props);
+
+static const lv_style_const_prop_t style_dot_props[] = {
+    LV_STYLE_CONST_WIDTH(6),
+    LV_STYLE_CONST_HEIGHT(6),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BG_COLOR(COLOR_WHITE),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_dot, style_dot_props);
+
+static const lv_style_const_prop_t style_dot_hollow_props[] = {
+    LV_STYLE_CONST_WIDTH(6),
+    LV_STYLE_CONST_HEIGHT(6),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_WHITE),
+    LV_STYLE_CONST_BORDER_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_dot_hollow, style_dot_hollow_props);
+
+// --- Keyboard Area Style ---
+static const lv_style_const_prop_t style_keyboard_area_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_KEYBOARD_BG),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PAD_TOP(KEYBOARD_PADDING),
+    LV_STYLE_CONST_PAD_BOTTOM(KEYBOARD_PADDING),
+    LV_STYLE_CONST_PAD_LEFT(KEYBOARD_PADDING),
+    LV_STYLE_CONST_PAD_RIGHT(KEYBOARD_PADDING),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_keyboard_area, style_keyboard_area_props);
+
+// --- Letter Label Style ---
+static const lv_style_const_prop_t style_letter_label_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_BUTTON),
+    LV_STYLE_CONST_TEXT_FONT(UI_FONT_14), // Using available font
+    LV_STYLE_CONST_TEXT_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_IMAGE_RECOLOR(COLOR_BUTTON),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_letter_label, style_letter_label_props);
+
+// --- Letter Label Active Style ---
+static const lv_style_const_prop_t style_letter_label_active_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_BUTTON_ACTIVE),
+    LV_STYLE_CONST_TEXT_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_IMAGE_RECOLOR(COLOR_BUTTON_ACTIVE),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_letter_label_active, style_letter_label_active_props);
+
+// --- Letter Label Hidden Style ---
+static const lv_style_const_prop_t style_letter_label_hidden_props[] = {
+    LV_STYLE_CONST_TEXT_OPA(LV_OPA_TRANSP), // Hide by making transparent
+    LV_STYLE_CONST_IMAGE_OPA(LV_OPA_TRANSP),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_letter_label_hidden, style_letter_label_hidden_props);
 
 // --- Function Prototypes ---
 static void create_status_bar(lv_obj_t *parent);
 static void create_text_area(lv_obj_t *parent);
 static void create_keyboard(lv_obj_t *parent);
-static lv_obj_t *create_blob_key(lv_obj_t *parent, const char *letters);
+static void create_top_row();
+static void create_blob_row(int row);
+static void create_bottom_row();
+static void finish_keyboard();
+static lv_obj_t *create_blob_key(lv_obj_t *parent, int key_index);
+static lv_obj_t *create_key_glyph(lv_obj_t *parent, const char *text);
 static void blob_key_event_cb(lv_event_t *e);
 static void action_button_event_cb(lv_event_t *e);
 static void update_blob_key_visuals(lv_obj_t *key, int letter_index, bool pressed);
+static int blob_key_letter_index(lv_obj_t *key, const lv_point_t *point);
+static void schedule_blob_key_reset(lv_obj_t *key);
 static void reset_blob_key_visuals(lv_obj_t *key);
 static void cursor_blink_timer_cb(lv_timer_t *timer);
 static void update_input_display();
@@ -77,91 +388,22 @@ static void update_text_area_display();
 static void accept_input();
 static void clear_input();
 static void add_char_to_input(char c);
+static void add_text_to_input(const char *text);
+static bool children_clear_of_corners(lv_obj_t *obj);
+static void set_key_glyphs(uint8_t layer);
+static void set_key_layer(uint8_t layer);
+static void select_next_keymap();
+#if EMOJI_LAYER
+static void set_emoji_page(int32_t page);
+static void add_emoji_to_input(int key_index, int letter_index);
+#endif
+static void set_key_glyph(lv_obj_t *glyph, const char *text);
+static void build_glyphs();
+#if LV_COLOR_DEPTH == 8
+static void pressed_key_region_cb(lv_event_t *e);
+#endif
 
 // --- Style Initialization ---
-void init_styles()
-{
-    // --- Key Style (Common for Action and Blob) ---
-    lv_style_init(&style_key);
-    lv_style_set_radius(&style_key, 10);
-    lv_style_set_border_width(&style_key, 2);
-    lv_style_set_border_color(&style_key, COLOR_BUTTON);
-    lv_style_set_text_color(&style_key, COLOR_BUTTON);
-    lv_style_set_bg_opa(&style_key, LV_OPA_TRANSP);      // Transparent background for containers
-    lv_style_set_bg_color(&style_key, COLOR_BLACK);      // Background for actual buttons
-    lv_style_set_text_font(&style_key, LV_FONT_DEFAULT); // Adjust font if needed
-    lv_style_set_pad_all(&style_key, 0);
-    lv_style_set_align(&style_key, LV_ALIGN_CENTER); // Center content (like labels)
-
-    // --- Key Pressed Style ---
-    lv_style_init(&style_key_pressed);
-    lv_style_set_border_color(&style_key_pressed, COLOR_BUTTON_ACTIVE);
-    lv_style_set_text_color(&style_key_pressed, COLOR_BUTTON_ACTIVE);
-    // Add transform later if desired
-
-    // --- Blob Key Container Style ---
-    lv_style_init(&style_blob_key_cont);
-    lv_style_set_radius(&style_blob_key_cont, 10); // Use standard radius for now
-    lv_style_set_border_width(&style_blob_key_cont, 2);
-    lv_style_set_border_color(&style_blob_key_cont, COLOR_BUTTON);
-    lv_style_set_bg_color(&style_blob_key_cont, COLOR_BLACK);
-    lv_style_set_bg_opa(&style_blob_key_cont, LV_OPA_COVER);
-    lv_style_set_clip_corner(&style_blob_key_cont, true); // Helps with radius
-    lv_style_set_pad_all(&style_blob_key_cont, 0);
-
-    // --- Input Container Style ---
-    lv_style_init(&style_input_cont);
-    lv_style_set_radius(&style_input_cont, 5);
-    lv_style_set_border_width(&style_input_cont, 1);
-    lv_style_set_border_color(&style_input_cont, COLOR_BUTTON);
-    lv_style_set_bg_color(&style_input_cont, COLOR_INPUT_BG);
-    lv_style_set_bg_opa(&style_input_cont, LV_OPA_COVER);
-    lv_style_set_pad_hor(&style_input_cont, 5);
-    lv_style_set_pad_ver(&style_input_cont, 0);               // Pad vertically to center text
-    lv_style_set_align(&style_input_cont, LV_ALIGN_LEFT_MID); // Align content vertically
-
-    // --- Text Area Style ---
-    lv_style_init(&style_text_area);
-    lv_style_set_bg_color(&style_text_area, COLOR_TEXT_AREA_BG);
-    lv_style_set_bg_opa(&style_text_area, LV_OPA_COVER);
-    lv_style_set_pad_all(&style_text_area, 10);
-    lv_style_set_border_width(&style_text_area, 0);
-    lv_style_set_radius(&style_text_area, 0);
-
-    // --- Status Bar Style ---
-    lv_style_init(&style_status_bar);
-    lv_style_set_bg_color(&style_status_bar, COLOR_BLACK);
-    lv_style_set_bg_opa(&style_status_bar, LV_OPA_COVER);
-    lv_style_set_text_color(&style_status_bar, COLOR_STATUS_BAR_TEXT);
-    lv_style_set_pad_hor(&style_status_bar, 10);
-    lv_style_set_pad_ver(&style_status_bar, 0);
-    lv_style_set_border_width(&style_status_bar, 0);
-    lv_style_set_radius(&style_status_bar, 0);
-
-    // --- Keyboard Area Style ---
-    lv_style_init(&style_keyboard_area);
-    lv_style_set_bg_color(&style_keyboard_area, COLOR_KEYBOARD_BG);
-    lv_style_set_bg_opa(&style_keyboard_area, LV_OPA_COVER);
-    lv_style_set_pad_all(&style_keyboard_area, KEYBOARD_PADDING);
-    lv_style_set_border_width(&style_keyboard_area, 0);
-    lv_style_set_radius(&style_keyboard_area, 0);
-
-    // --- Letter Label Style ---
-    lv_style_init(&style_letter_label);
-    lv_style_set_text_color(&style_letter_label, COLOR_BUTTON);
-    lv_style_set_text_font(&style_letter_label, &lv_font_montserrat_14); // Using available font
-    lv_style_set_text_opa(&style_letter_label, LV_OPA_COVER);
-
-    // --- Letter Label Active Style ---
-    lv_style_init(&style_letter_label_active);
-    lv_style_set_text_color(&style_letter_label_active, COLOR_BUTTON_ACTIVE);
-    lv_style_set_text_opa(&style_letter_label_active, LV_OPA_COVER);
-
-    // --- Letter Label Hidden Style ---
-    lv_style_init(&style_letter_label_hidden);
-    lv_style_set_text_opa(&style_letter_label_hidden, LV_OPA_TRANSP); // Hide by making transparent
-}
-
 // --- UI Creation Functions ---
 
 void create_status_bar(lv_obj_t *parent)
@@ -173,33 +415,20 @@ void create_status_bar(lv_obj_t *parent)
     lv_obj_align(bar, LV_ALIGN_TOP_MID, 0, 0);
     lv_obj_remove_flag(bar, LV_OBJ_FLAG_SCROLLABLE);
 
+#if PERF_HUD
+    // Live performance fields replace the decorative dots, time and battery
+    perf_hud_create(bar);
+#else
     // Dots (Simplified)
     lv_obj_t *dots_cont = lv_obj_create(bar);
     lv_obj_remove_style_all(dots_cont); // Remove default padding/border
-    lv_obj_set_size(dots_cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-    lv_obj_align(dots_cont, LV_ALIGN_LEFT_MID, 0, 0);
-    lv_obj_set_flex_flow(dots_cont, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(dots_cont, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_pad_column(dots_cont, 3, 0);
-    lv_obj_set_style_bg_opa(dots_cont, LV_OPA_TRANSP, 0); // Make container transparent
+    lv_obj_add_style(dots_cont, &style_dots, 0);
 
     for (int i = 0; i < 5; i++)
     {
         lv_obj_t *dot = lv_obj_create(dots_cont);
-        lv_obj_set_size(dot, 6, 6);
-        lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, 0);
-        if (i < 4)
-        {
-            lv_obj_set_style_bg_color(dot, COLOR_WHITE, 0);
-            lv_obj_set_style_bg_opa(dot, LV_OPA_COVER, 0);
-            lv_obj_set_style_border_width(dot, 0, 0);
-        }
-        else
-        {
-            lv_obj_set_style_bg_opa(dot, LV_OPA_TRANSP, 0);
-            lv_obj_set_style_border_color(dot, COLOR_WHITE, 0);
-            lv_obj_set_style_border_width(dot, 1, 0);
-        }
+        lv_obj_remove_style_all(dot);
+        lv_obj_add_style(dot, i < 4 ? &style_dot : &style_dot_hollow, 0);
     }
 
     // Time
@@ -211,6 +440,7 @@ void create_status_bar(lv_obj_t *parent)
     lv_obj_t *battery_label = lv_label_create(bar);
     lv_label_set_text(battery_label, LV_SYMBOL_BATTERY_FULL);
     lv_obj_align(battery_label, LV_ALIGN_RIGHT_MID, 0, 0);
+#endif
 }
 
 void create_text_area(lv_obj_t *parent)
@@ -223,80 +453,132 @@ void create_text_area(lv_obj_t *parent)
     lv_obj_remove_flag(area, LV_OBJ_FLAG_SCROLLABLE);
 
     text_content_label = lv_label_create(area);
+#if DOC_STORE
+    doc_store_init();
+    lv_label_set_text_static(text_content_label, doc_store_view());
+#else
     lv_label_set_text(text_content_label, "");
-    lv_obj_set_width(text_content_label, lv_pct(100));
+#endif
     lv_label_set_long_mode(text_content_label, LV_LABEL_LONG_WRAP);
-    lv_obj_set_style_text_color(text_content_label, COLOR_TEXT_AREA_TEXT, 0);
-    lv_obj_set_style_text_font(text_content_label, &lv_font_montserrat_20, 0);
-    lv_obj_set_style_max_height(text_content_label, lv_pct(100), 0); // Constrain height
-    lv_obj_align(text_content_label, LV_ALIGN_TOP_LEFT, 0, 0);
-
-    // Cursor
-    text_cursor = lv_obj_create(area);
-    lv_obj_set_size(text_cursor, 2, 20); // Match font size
-    lv_obj_set_style_bg_color(text_cursor, COLOR_CURSOR, 0);
-    lv_obj_set_style_bg_opa(text_cursor, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(text_cursor, 0, 0);
-    lv_obj_add_flag(text_cursor, LV_OBJ_FLAG_HIDDEN); // Start hidden
+    lv_obj_add_style(text_content_label, &style_text_content, 0); // Top left, full width
+
+    // Cursor (composited at flush time, starts hidden)
+    text_cursor = cursor_overlay_add(COLOR_CURSOR, CURSOR_WIDTH, TEXT_CURSOR_HEIGHT);
     // Position update needed in update_text_area_display
 }
 
+#if LAZY_UI
+static void draw_key_outline(lv_layer_t *layer, lv_draw_rect_dsc_t *dsc, const lv_area_t *content,
+                             int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    lv_area_t a = {content->x1 + x, content->y1 + y, content->x1 + x + w - 1, content->y1 + y + h - 1};
+    lv_draw_rect(layer, dsc, &a);
+}
+
+static void keyboard_outline_draw_cb(lv_event_t *e)
+{
+    // The borders of the idle keys, without objects: a few rectangles instead of
+    // the dozens of objects of the real keys, for the first frame
+    lv_area_t content;
+    lv_obj_get_content_coords(keyboard_area, &content);
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_opa = LV_OPA_TRANSP;
+    dsc.border_color = COLOR_BUTTON;
+    dsc.border_width = 2;
+    dsc.radius = BLOB_KEY_RADIUS;
+
+    // Rows in the order they are created: top, 3 blob key rows, bottom
+    const int32_t right_x = board_layout::inner_width - ACTION_BTN_WIDTH;
+    for (int row = keyboard_rows_created; row < 5; row++)
+    {
+        if (row == 0)
+        {
+            draw_key_outline(layer, &dsc, &content, 0, board_layout::top_row_y, ACTION_BTN_WIDTH, TOP_ROW_HEIGHT);
+            draw_key_outline(layer, &dsc, &content, right_x, board_layout::top_row_y, ACTION_BTN_WIDTH, TOP_ROW_HEIGHT);
+        }
+        else if (row == 4)
+        {
+            draw_key_outline(layer, &dsc, &content, 0, board_layout::bottom_row_y, ACTION_BTN_WIDTH, BOTTOM_ROW_HEIGHT);
+            draw_key_outline(layer, &dsc, &content, ACTION_BTN_WIDTH + BOTTOM_ROW_H_GAP, board_layout::bottom_row_y,
+                             board_layout::space_width, BOTTOM_ROW_HEIGHT);
+            draw_key_outline(layer, &dsc, &content, right_x, board_layout::bottom_row_y, ACTION_BTN_WIDTH, BOTTOM_ROW_HEIGHT);
+        }
+        else
+        {
+            int32_t y = board_layout::blob_row_y + (row - 1) * board_layout::blob_row_pitch;
+            for (int col = 0; col < 4; col++)
+                draw_key_outline(layer, &dsc, &content, col * (BLOB_KEY_WIDTH + board_layout::blob_key_h_gap), y,
+                                 BLOB_KEY_WIDTH, BLOB_KEY_HEIGHT);
+        }
+    }
+}
+#endif
+
 void create_keyboard(lv_obj_t *parent)
 {
     // Create keyboard container
     lv_obj_t *kb_area = lv_obj_create(parent);
+    keyboard_area = kb_area;
     lv_obj_remove_style_all(kb_area);
     lv_obj_add_style(kb_area, &style_keyboard_area, 0);
     // Explicitly set size and position based on UI dimensions
     lv_obj_set_size(kb_area, UI_WIDTH, KEYBOARD_HEIGHT);
-    lv_obj_set_pos(kb_area, 0, STATUS_BAR_HEIGHT + TEXT_AREA_HEIGHT); // Position below text area
+    lv_obj_set_pos(kb_area, 0, board_layout::keyboard_y); // Position below text area
     lv_obj_remove_flag(kb_area, LV_OBJ_FLAG_SCROLLABLE);
+#if LAZY_UI
+    // Idle keys as plain outlines until their rows are created
+    lv_obj_add_event_cb(kb_area, keyboard_outline_draw_cb, LV_EVENT_DRAW_MAIN_END, NULL);
+#endif
+}
 
-    // Calculate inner dimensions (accounting for padding)
-    lv_coord_t kb_inner_width = UI_WIDTH - 2 * KEYBOARD_PADDING;
-
-    // Track vertical position as we build the keyboard
-    lv_coord_t current_y = 0; // Start at the top of the kb_area (padding handled by kb_area style)
+// Clear, accept and the input field
+static void create_top_row()
+{
+    // Inner dimensions (accounting for padding); row positions are relative to the padding
+    lv_coord_t kb_inner_width = board_layout::inner_width;
 
-    // --- Top Row ---
-    lv_obj_t *top_row_cont = lv_obj_create(kb_area);
-    lv_obj_remove_style_all(top_row_cont);
+    lv_obj_t *top_row_cont = lv_obj_create(keyboard_area);
+    lv_obj_remove_style_all(top_row_cont); // Transparent, no padding
     lv_obj_set_size(top_row_cont, kb_inner_width, TOP_ROW_HEIGHT);
-    lv_obj_set_pos(top_row_cont, 0, current_y); // Position relative to kb_area top
-    lv_obj_set_style_pad_all(top_row_cont, 0, 0);
+    lv_obj_set_pos(top_row_cont, 0, board_layout::top_row_y);
     lv_obj_remove_flag(top_row_cont, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_bg_opa(top_row_cont, LV_OPA_TRANSP, 0); // Make container transparent
 
     // Clear button (left)
-    lv_obj_t *clear_btn = lv_button_create(top_row_cont);
+    lv_obj_t *clear_btn = action_keys[ACTION_KEY_CLEAR] = lv_button_create(top_row_cont);
     lv_obj_remove_style_all(clear_btn); // Remove button base style
     lv_obj_add_style(clear_btn, &style_key, 0);
     lv_obj_add_style(clear_btn, &style_key_pressed, LV_STATE_PRESSED);
     lv_obj_align(clear_btn, LV_ALIGN_DEFAULT, 0, 0);
     lv_obj_set_size(clear_btn, ACTION_BTN_WIDTH, TOP_ROW_HEIGHT);
     lv_obj_set_pos(clear_btn, 0, 0);
-    lv_obj_add_event_cb(clear_btn, action_button_event_cb, LV_EVENT_CLICKED, (void *)"clear");
+    lv_obj_add_event_cb(clear_btn, action_button_event_cb, LV_EVENT_CLICKED, (void *)ACTION_KEY_CLEAR);
+#if LV_COLOR_DEPTH == 8
+    lv_obj_add_event_cb(clear_btn, pressed_key_region_cb, LV_EVENT_ALL, NULL);
+#endif
 
-    lv_obj_t *clear_label = lv_label_create(clear_btn);
-    lv_label_set_text(clear_label, "clear");
+    lv_obj_t *clear_label = create_key_glyph(clear_btn, keymap_label(current_layer, ACTION_KEY_CLEAR));
     lv_obj_center(clear_label);
 
     // Accept button (right)
-    lv_obj_t *accept_btn = lv_button_create(top_row_cont);
+    lv_obj_t *accept_btn = action_keys[ACTION_KEY_ACCEPT] = lv_button_create(top_row_cont);
     lv_obj_remove_style_all(accept_btn); // Remove button base style
     lv_obj_add_style(accept_btn, &style_key, 0);
     lv_obj_add_style(accept_btn, &style_key_pressed, LV_STATE_PRESSED);
     lv_obj_align(accept_btn, LV_ALIGN_DEFAULT, 0, 0);
     lv_obj_set_size(accept_btn, ACTION_BTN_WIDTH, TOP_ROW_HEIGHT);
     lv_obj_set_pos(accept_btn, kb_inner_width - ACTION_BTN_WIDTH, 0);
-    lv_obj_add_event_cb(accept_btn, action_button_event_cb, LV_EVENT_CLICKED, (void *)"accept");
+    lv_obj_add_event_cb(accept_btn, action_button_event_cb, LV_EVENT_CLICKED, (void *)ACTION_KEY_ACCEPT);
+#if LV_COLOR_DEPTH == 8
+    lv_obj_add_event_cb(accept_btn, pressed_key_region_cb, LV_EVENT_ALL, NULL);
+#endif
 
-    lv_obj_t *accept_label = lv_label_create(accept_btn);
-    lv_label_set_text(accept_label, "accept");
+    lv_obj_t *accept_label = create_key_glyph(accept_btn, keymap_label(current_layer, ACTION_KEY_ACCEPT));
     lv_obj_center(accept_label);
 
     // Input container (middle)
-    lv_coord_t input_width = kb_inner_width - 2 * ACTION_BTN_WIDTH - 2 * TOP_ROW_H_GAP;
+    lv_coord_t input_width = board_layout::input_width;
     lv_obj_t *input_cont = lv_obj_create(top_row_cont);
     lv_obj_remove_style_all(input_cont);
     lv_obj_add_style(input_cont, &style_input_cont, 0);
@@ -307,116 +589,189 @@ void create_keyboard(lv_obj_t *parent)
     // Input text and cursor
     input_text_label = lv_label_create(input_cont);
     lv_label_set_text(input_text_label, "");
-    lv_obj_set_style_text_color(input_text_label, COLOR_INPUT_TEXT, 0);
-    lv_obj_set_style_text_font(input_text_label, &lv_font_montserrat_18, 0);
-    lv_obj_align(input_text_label, LV_ALIGN_LEFT_MID, 0, 0); // Align within input_cont padding
-
-    input_cursor = lv_obj_create(input_cont);
-    lv_obj_set_size(input_cursor, 2, 18);
-    lv_obj_set_style_bg_color(input_cursor, COLOR_CURSOR_INPUT, 0);
-    lv_obj_set_style_bg_opa(input_cursor, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(input_cursor, 0, 0);
-    lv_obj_add_flag(input_cursor, LV_OBJ_FLAG_HIDDEN);
-    // Position updated in update_input_display
-
-    // Move down for next row
-    current_y += TOP_ROW_HEIGHT + KEY_ROW_V_GAP;
+    lv_obj_add_style(input_text_label, &style_input_text, 0);
 
-    // --- Blob Key Rows ---
-    const char *key_letters[] = {
-        "bac", "fdg", "jek", "mhp",
-        "qiv", "wlx", "ynz", ".o?",
-        ",r-", "@s'", ":t\"", "/u!"};
+    input_cursor = cursor_overlay_add(COLOR_CURSOR_INPUT, CURSOR_WIDTH, INPUT_CURSOR_HEIGHT);
+    // Position updated in update_input_display
+    keyboard_rows_created++;
+}
 
-    // Calculate horizontal gap based on fixed key width
-    lv_coord_t calculated_h_gap = (kb_inner_width - (4 * BLOB_KEY_WIDTH)) / 3;
+// Four blob keys
+static void create_blob_row(int row)
+{
+    lv_obj_t *row_cont = lv_obj_create(keyboard_area);
+    lv_obj_remove_style_all(row_cont); // Transparent, no padding
+    lv_obj_set_size(row_cont, board_layout::inner_width, BLOB_KEY_HEIGHT);
+    lv_obj_set_pos(row_cont, 0, board_layout::blob_row_y + row * board_layout::blob_row_pitch);
+    lv_obj_remove_flag(row_cont, LV_OBJ_FLAG_SCROLLABLE);
 
-    for (int row = 0; row < 3; row++)
+    for (int col = 0; col < 4; col++)
     {
-        lv_obj_t *row_cont = lv_obj_create(kb_area);
-        lv_obj_remove_style_all(row_cont);
-        lv_obj_set_size(row_cont, kb_inner_width, BLOB_KEY_HEIGHT);
-        lv_obj_set_pos(row_cont, 0, current_y); // Position relative to kb_area top
-        lv_obj_set_style_pad_all(row_cont, 0, 0);
-        lv_obj_remove_flag(row_cont, LV_OBJ_FLAG_SCROLLABLE);
-        lv_obj_set_style_bg_opa(row_cont, LV_OPA_TRANSP, 0); // Make container transparent
-
-        for (int col = 0; col < 4; col++)
-        {
-            int key_index = row * 4 + col;
-            lv_obj_t *key = create_blob_key(row_cont, key_letters[key_index]);
-            // Size is set within create_blob_key or here if needed
-            lv_obj_set_size(key, BLOB_KEY_WIDTH, BLOB_KEY_HEIGHT);
-            lv_obj_set_pos(key, col * (BLOB_KEY_WIDTH + calculated_h_gap), 0);
-        }
-
-        current_y += BLOB_KEY_HEIGHT + KEY_ROW_V_GAP;
+        int key_index = row * 4 + col;
+        lv_obj_t *key = create_blob_key(row_cont, key_index);
+        blob_keys[key_index] = key;
+        // Size is set within create_blob_key or here if needed
+        lv_obj_set_size(key, BLOB_KEY_WIDTH, BLOB_KEY_HEIGHT);
+        lv_obj_set_pos(key, col * (BLOB_KEY_WIDTH + board_layout::blob_key_h_gap), 0);
     }
+    keyboard_rows_created++;
+}
 
-    // --- Bottom Row ---
-    // Adjust vertical position slightly if needed to fit exactly
-    current_y = KEYBOARD_HEIGHT - KEYBOARD_PADDING - BOTTOM_ROW_HEIGHT; // Position from bottom
+// Shift, space and 123
+static void create_bottom_row()
+{
+    lv_coord_t kb_inner_width = board_layout::inner_width;
 
-    lv_obj_t *bottom_row_cont = lv_obj_create(kb_area);
-    lv_obj_remove_style_all(bottom_row_cont);
+    lv_obj_t *bottom_row_cont = lv_obj_create(keyboard_area);
+    lv_obj_remove_style_all(bottom_row_cont); // Transparent, no padding
     lv_obj_set_size(bottom_row_cont, kb_inner_width, BOTTOM_ROW_HEIGHT);
-    lv_obj_set_pos(bottom_row_cont, 0, current_y); // Position relative to kb_area top
-    lv_obj_set_style_pad_all(bottom_row_cont, 0, 0);
+    lv_obj_set_pos(bottom_row_cont, 0, board_layout::bottom_row_y); // Anchored to the bottom padding
     lv_obj_remove_flag(bottom_row_cont, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_bg_opa(bottom_row_cont, LV_OPA_TRANSP, 0); // Make container transparent
 
     // Shift button (left)
-    lv_obj_t *shift_btn = lv_button_create(bottom_row_cont);
+    lv_obj_t *shift_btn = action_keys[ACTION_KEY_SHIFT] = lv_button_create(bottom_row_cont);
     lv_obj_remove_style_all(shift_btn); // Remove button base style
     lv_obj_add_style(shift_btn, &style_key, 0);
-    // lv_obj_add_style(shift_btn, &style_key_pressed, LV_STATE_PRESSED);
+    lv_obj_add_style(shift_btn, &style_key_pressed, LV_STATE_PRESSED);
     lv_obj_align(shift_btn, LV_ALIGN_DEFAULT, 0, 0);
     lv_obj_set_size(shift_btn, ACTION_BTN_WIDTH, BOTTOM_ROW_HEIGHT);
     lv_obj_set_pos(shift_btn, 0, 0);
-    // Add event handler later if needed
+    lv_obj_add_event_cb(shift_btn, action_button_event_cb, LV_EVENT_CLICKED, (void *)ACTION_KEY_SHIFT);
+#if LV_COLOR_DEPTH == 8
+    lv_obj_add_event_cb(shift_btn, pressed_key_region_cb, LV_EVENT_ALL, NULL);
+#endif
 
-    lv_obj_t *shift_label = lv_label_create(shift_btn);
-    lv_label_set_text(shift_label, "shift");
+    lv_obj_t *shift_label = create_key_glyph(shift_btn, keymap_label(current_layer, ACTION_KEY_SHIFT));
     lv_obj_center(shift_label);
 
     // Numbers button (right)
-    lv_obj_t *numbers_btn = lv_button_create(bottom_row_cont);
+    lv_obj_t *numbers_btn = action_keys[ACTION_KEY_NUMBERS] = lv_button_create(bottom_row_cont);
     lv_obj_remove_style_all(numbers_btn); // Remove button base style
     lv_obj_add_style(numbers_btn, &style_key, 0);
-    // lv_obj_add_style(numbers_btn, &style_key_pressed, LV_STATE_PRESSED);
+    lv_obj_add_style(numbers_btn, &style_key_pressed, LV_STATE_PRESSED);
     lv_obj_align(numbers_btn, LV_ALIGN_DEFAULT, 0, 0);
     lv_obj_set_size(numbers_btn, ACTION_BTN_WIDTH, BOTTOM_ROW_HEIGHT);
     lv_obj_set_pos(numbers_btn, kb_inner_width - ACTION_BTN_WIDTH, 0);
-    // Add event handler later if needed
+    lv_obj_add_event_cb(numbers_btn, action_button_event_cb, LV_EVENT_CLICKED, (void *)ACTION_KEY_NUMBERS);
+#if EMOJI_LAYER
+    lv_obj_add_event_cb(numbers_btn, action_button_event_cb, LV_EVENT_PRESSED, (void *)ACTION_KEY_NUMBERS);
+    lv_obj_add_event_cb(numbers_btn, action_button_event_cb, LV_EVENT_LONG_PRESSED, (void *)ACTION_KEY_NUMBERS);
+#endif
+#if LV_COLOR_DEPTH == 8
+    lv_obj_add_event_cb(numbers_btn, pressed_key_region_cb, LV_EVENT_ALL, NULL);
+#endif
 
-    lv_obj_t *numbers_label = lv_label_create(numbers_btn);
-    lv_label_set_text(numbers_label, "123");
+    lv_obj_t *numbers_label = create_key_glyph(numbers_btn, keymap_label(current_layer, ACTION_KEY_NUMBERS));
     lv_obj_center(numbers_label);
 
     // Space button (middle)
-    lv_coord_t space_width = kb_inner_width - 2 * ACTION_BTN_WIDTH - 2 * BOTTOM_ROW_H_GAP;
-    lv_obj_t *space_btn = lv_button_create(bottom_row_cont);
+    lv_coord_t space_width = board_layout::space_width;
+    lv_obj_t *space_btn = action_keys[ACTION_KEY_SPACE] = lv_button_create(bottom_row_cont);
     lv_obj_remove_style_all(space_btn); // Remove button base style
     lv_obj_add_style(space_btn, &style_key, 0);
     lv_obj_add_style(space_btn, &style_key_pressed, LV_STATE_PRESSED);
     lv_obj_align(space_btn, LV_ALIGN_DEFAULT, 0, 0);
     lv_obj_set_size(space_btn, space_width, BOTTOM_ROW_HEIGHT);
     lv_obj_set_pos(space_btn, ACTION_BTN_WIDTH + BOTTOM_ROW_H_GAP, 0);
-    lv_obj_add_event_cb(space_btn, action_button_event_cb, LV_EVENT_CLICKED, (void *)"space");
+    lv_obj_add_event_cb(space_btn, action_button_event_cb, LV_EVENT_CLICKED, (void *)ACTION_KEY_SPACE);
+    lv_obj_add_event_cb(space_btn, action_button_event_cb, LV_EVENT_PRESSED, (void *)ACTION_KEY_SPACE);
+    lv_obj_add_event_cb(space_btn, action_button_event_cb, LV_EVENT_LONG_PRESSED, (void *)ACTION_KEY_SPACE);
+#if LV_COLOR_DEPTH == 8
+    lv_obj_add_event_cb(space_btn, pressed_key_region_cb, LV_EVENT_ALL, NULL);
+#endif
 
-    lv_obj_t *space_label = lv_label_create(space_btn);
-    lv_label_set_text(space_label, "space");
+    lv_obj_t *space_label = create_key_glyph(space_btn, keymap_label(current_layer, ACTION_KEY_SPACE));
     lv_obj_center(space_label);
+    keyboard_rows_created++;
+}
+
+static void clip_spilling_keys(int layer)
+{
+    for (int i = 0; i < 12; i++)
+    {
+        if (!blob_key_clipped[i] && !children_clear_of_corners(blob_keys[i]))
+        {
+            log_w("Key %d: letters reach the rounded corners in layer %d, clipping enabled", i, layer);
+            lv_obj_add_style(blob_keys[i], &style_blob_key_clip, 0);
+            blob_key_clipped[i] = true;
+        }
+    }
+}
+
+// Every layer of the keymap, ends on the first one. Only the glyphs are set: the
+// keyboard cache is left to the caller
+static void clip_spilling_layers()
+{
+    for (int layer = keymap_layer_count() - 1; layer >= 0; layer--)
+    {
+        set_key_glyphs(layer);
+        clip_spilling_keys(layer);
+    }
+}
+
+#if KEYBOARD_CACHE
+static_assert(KEYMAP_MAX_LAYERS < KEYBOARD_CACHE_MAX_IMAGES, "A cached image per layer and the emoji picker");
+
+// A bitmap of every layer of the keymap, ends on the layer shown: switching layers
+// then only swaps the bitmap
+static void render_keyboard_cache()
+{
+    uint8_t shown_layer = current_layer;
+    keyboard_cache_invalidate();
+    for (int layer = keymap_layer_count() - 1; layer >= 0; layer--)
+    {
+        set_key_glyphs(layer);
+        keyboard_cache_render(layer);
+    }
+    if (shown_layer != 0)
+        set_key_layer(shown_layer);
+}
+#endif
+
+// Once every row exists: corner clipping where needed and the keyboard cache
+static void finish_keyboard()
+{
+#if LAZY_UI
+    lv_obj_remove_event_cb(keyboard_area, keyboard_outline_draw_cb);
+#endif
+
+    // Keys are drawn without corner clipping; fall back to it for a key whose letters
+    // would spill out in any layer
+    uint8_t shown_layer = current_layer;
+#if EMOJI_LAYER
+    if (emoji_glyphs_count())
+    {
+        set_emoji_page(0); // Every glyph of the pack has the same size
+        clip_spilling_keys(keymap_layer_count());
+    }
+#endif
+    clip_spilling_layers();
+    if (shown_layer != 0)
+        set_key_glyphs(shown_layer); // E.g. restored by a warm resume
+
+#if KEYBOARD_CACHE
+    // Idle keys are drawn from the cached bitmaps, the input field stays live. Rendered
+    // once, here in the last stage: the stages before only draw the keys live
+    if (keyboard_cache_init(keyboard_area))
+    {
+        for (int i = 0; i < 12; i++)
+            keyboard_cache_add_key(blob_keys[i]);
+        for (int i = 0; i < KEYMAP_ACTION_KEYS; i++)
+            keyboard_cache_add_key(action_keys[i]);
+        render_keyboard_cache();
+    }
+#endif
 }
 
-lv_obj_t *create_blob_key(lv_obj_t *parent, const char *letters)
+lv_obj_t *create_blob_key(lv_obj_t *parent, int key_index)
 {
     // Create container for the blob key
     lv_obj_t *cont = lv_obj_create(parent);
     lv_obj_remove_style_all(cont);
     lv_obj_add_style(cont, &style_blob_key_cont, 0);
+    lv_obj_add_style(cont, &style_blob_key_active, KEY_STATE_ACTIVE);
     // Size is set in create_keyboard
-    lv_obj_set_user_data(cont, (void *)letters); // Store letters for event handler
+    lv_obj_set_user_data(cont, (void *)(intptr_t)key_index); // The letters are in the keymap
     lv_obj_add_event_cb(cont, blob_key_event_cb, LV_EVENT_ALL, NULL);
     lv_obj_clear_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
 
@@ -425,32 +780,226 @@ lv_obj_t *create_blob_key(lv_obj_t *parent, const char *letters)
 
     // Create letter labels
     // Left letter (bottom left)
-    lv_obj_t *left_letter = lv_label_create(cont);
+    lv_obj_t *left_letter = create_key_glyph(cont, keymap_slot(current_layer, key_index, 0));
     lv_obj_add_style(left_letter, &style_letter_label, 0);
     lv_obj_add_style(left_letter, &style_letter_label_active, LV_STATE_USER_1); // Active state
     lv_obj_add_style(left_letter, &style_letter_label_hidden, LV_STATE_USER_2); // Hidden state
-    lv_label_set_text_fmt(left_letter, "%c", letters[0]);
     lv_obj_align(left_letter, LV_ALIGN_BOTTOM_LEFT, 4, -4);
 
     // Center letter (top center)
-    lv_obj_t *center_letter = lv_label_create(cont);
+    lv_obj_t *center_letter = create_key_glyph(cont, keymap_slot(current_layer, key_index, 1));
     lv_obj_add_style(center_letter, &style_letter_label, 0);
     lv_obj_add_style(center_letter, &style_letter_label_active, LV_STATE_USER_1);
     lv_obj_add_style(center_letter, &style_letter_label_hidden, LV_STATE_USER_2);
-    lv_label_set_text_fmt(center_letter, "%c", letters[1]);
     lv_obj_align(center_letter, LV_ALIGN_TOP_MID, 0, 2);
 
     // Right letter (bottom right)
-    lv_obj_t *right_letter = lv_label_create(cont);
+    lv_obj_t *right_letter = create_key_glyph(cont, keymap_slot(current_layer, key_index, 2));
     lv_obj_add_style(right_letter, &style_letter_label, 0);
     lv_obj_add_style(right_letter, &style_letter_label_active, LV_STATE_USER_1);
     lv_obj_add_style(right_letter, &style_letter_label_hidden, LV_STATE_USER_2);
-    lv_label_set_text_fmt(right_letter, "%c", letters[2]);
     lv_obj_align(right_letter, LV_ALIGN_BOTTOM_RIGHT, -4, -4);
 
     return cont;
 }
 
+static bool point_in_rounded_rect(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, lv_coord_t r)
+{
+    // Distance to the center of the corner arc, only inside the r x r corner squares
+    lv_coord_t dx = x < r ? r - x : (x >= w - r ? x - (w - r - 1) : 0);
+    lv_coord_t dy = y < r ? r - y : (y >= h - r ? y - (h - r - 1) : 0);
+    return dx == 0 || dy == 0 || dx * dx + dy * dy <= r * r;
+}
+
+static bool children_clear_of_corners(lv_obj_t *obj)
+{
+    lv_obj_update_layout(obj);
+    lv_area_t obj_area;
+    lv_obj_get_coords(obj, &obj_area);
+    lv_coord_t w = lv_area_get_width(&obj_area);
+    lv_coord_t h = lv_area_get_height(&obj_area);
+    lv_coord_t r = LV_MIN(lv_obj_get_style_radius(obj, 0), LV_MIN(w, h) / 2);
+
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++)
+    {
+        lv_area_t a;
+        lv_obj_get_coords(lv_obj_get_child(obj, i), &a);
+        lv_area_move(&a, -obj_area.x1, -obj_area.y1);
+        if (!point_in_rounded_rect(a.x1, a.y1, w, h, r) || !point_in_rounded_rect(a.x2, a.y1, w, h, r) ||
+            !point_in_rounded_rect(a.x1, a.y2, w, h, r) || !point_in_rounded_rect(a.x2, a.y2, w, h, r))
+            return false;
+    }
+
+    return true;
+}
+
+static lv_obj_t *create_key_glyph(lv_obj_t *parent, const char *text)
+{
+    // Keyboard glyphs are blitted from the pre-rendered atlas, a plain label is the fallback
+    const lv_image_dsc_t *glyph = text[1] == '\0' ? glyph_atlas_get_char(text[0]) : glyph_atlas_get_label(text);
+    if (!glyph)
+    {
+        lv_obj_t *label = lv_label_create(parent);
+        lv_label_set_text(label, text);
+        return label;
+    }
+
+    lv_obj_t *image = lv_image_create(parent);
+    lv_image_set_src(image, glyph);
+    return image;
+}
+
+static void set_key_glyph(lv_obj_t *glyph, const char *text)
+{
+    // text must be static: labels keep the pointer
+    if (lv_obj_check_type(glyph, &lv_image_class))
+    {
+        // Not in the atlas (full, or it failed to build): nothing, rather than the
+        // entry the image showed before
+        lv_image_set_src(glyph, text[1] == '\0' ? glyph_atlas_get_char(text[0]) : glyph_atlas_get_label(text));
+    }
+    else
+    {
+        lv_label_set_text_static(glyph, text);
+    }
+}
+
+static void clear_key_glyphs()
+{
+    // Before the atlas is built again: no image may point at an entry while its
+    // pixels are freed and rendered anew
+    for (int i = 0; i < 12; i++)
+        for (int j = 0; j < 3; j++)
+        {
+            lv_obj_t *glyph = lv_obj_get_child(blob_keys[i], j);
+            if (lv_obj_check_type(glyph, &lv_image_class))
+                lv_image_set_src(glyph, NULL);
+        }
+    for (int i = 0; i < KEYMAP_ACTION_KEYS; i++)
+    {
+        lv_obj_t *glyph = lv_obj_get_child(action_keys[i], 0);
+        if (lv_obj_check_type(glyph, &lv_image_class))
+            lv_image_set_src(glyph, NULL);
+        action_key_text[i] = NULL;
+    }
+}
+
+// --- Key Layers ---
+
+static void set_action_label(int action_key, const char *text)
+{
+    // Only when it changes: most layers share most labels
+    if (action_key_text[action_key] == text)
+        return;
+    set_key_glyph(lv_obj_get_child(action_keys[action_key], 0), text);
+    action_key_text[action_key] = text;
+}
+
+#if EMOJI_LAYER
+static void unpin_emoji_keys()
+{
+    for (int i = 0; i < 12; i++)
+        for (int j = 0; j < 3; j++)
+            if (emoji_key_glyphs[i][j])
+            {
+                emoji_glyphs_unpin(emoji_key_glyphs[i][j]);
+                emoji_key_glyphs[i][j] = NULL;
+            }
+}
+
+static void set_emoji_page(int32_t page)
+{
+    // As set_key_layer, the glyphs come from the emoji cache
+    uint32_t codepoints[EMOJI_PAGE_SIZE];
+    uint32_t count = emoji_glyphs_codepoints(page * EMOJI_PAGE_SIZE, codepoints, EMOJI_PAGE_SIZE);
+    unpin_emoji_keys();
+    for (int i = 0; i < 12; i++)
+    {
+        lv_obj_t *key = blob_keys[i];
+        for (int j = 0; j < 3; j++)
+        {
+            uint32_t k = i * 3 + j;
+            uint32_t codepoint = k < count ? codepoints[k] : 0;
+            emoji_key_codepoints[i][j] = codepoint;
+            lv_obj_t *glyph = lv_obj_get_child(key, j);
+            if (lv_obj_check_type(glyph, &lv_image_class))
+            {
+                emoji_key_glyphs[i][j] = codepoint ? emoji_glyphs_pin(codepoint) : NULL;
+                lv_image_set_src(glyph, emoji_key_glyphs[i][j]);
+            }
+            else
+            {
+                emoji_key_text[i][j][0] = '\0';
+                if (codepoint)
+                    emoji_glyphs_utf8(codepoint, emoji_key_text[i][j]); // Drawn through emoji_font
+                lv_label_set_text_static(glyph, emoji_key_text[i][j]);
+            }
+        }
+    }
+    set_action_label(ACTION_KEY_SHIFT, picker_labels[0]);
+    set_action_label(ACTION_KEY_NUMBERS, picker_labels[1]);
+    emoji_page = emoji_last_page = page;
+
+#if KEYBOARD_CACHE
+    keyboard_cache_render(KEYMAP_MAX_LAYERS); // Pages differ, each is rendered when shown
+#endif
+}
+#endif
+
+static void set_key_glyphs(uint8_t layer)
+{
+    // Only the glyphs change: no objects are created and nothing is allocated.
+    // Each glyph invalidates its own old and new area.
+#if EMOJI_LAYER
+    unpin_emoji_keys();
+    emoji_page = -1;
+#endif
+    for (int i = 0; i < 12; i++)
+    {
+        // Children 0..2: left, center and right letter (create_blob_key)
+        for (int j = 0; j < 3; j++)
+            set_key_glyph(lv_obj_get_child(blob_keys[i], j), keymap_slot(layer, i, j));
+    }
+    for (int i = 0; i < KEYMAP_ACTION_KEYS; i++)
+        set_action_label(i, keymap_label(layer, i));
+    current_layer = layer;
+}
+
+static void set_key_layer(uint8_t layer)
+{
+    set_key_glyphs(layer);
+#if KEYBOARD_CACHE
+    // Rendered once per keymap (render_keyboard_cache), swapped in here
+    if (!keyboard_cache_show(layer))
+        keyboard_cache_render(layer);
+#endif
+}
+
+static void select_next_keymap()
+{
+    // The key objects stay, only their glyphs change: the atlas is rendered again
+    // for the new characters and every glyph is set before the next frame
+    uint32_t start = micros();
+    if (!keymap_select_next())
+        return;
+    clear_key_glyphs();
+    build_glyphs();
+    clip_spilling_layers();
+#if KEYBOARD_CACHE
+    render_keyboard_cache();
+#endif
+    log_i("Keymap switch to %s: %lu us", keymap_name(), (unsigned long)(micros() - start));
+}
+
+static bool emoji_picker_shown()
+{
+#if EMOJI_LAYER
+    return emoji_page >= 0;
+#else
+    return false;
+#endif
+}
+
 // --- Event Handlers ---
 
 static void blob_key_event_cb(lv_event_t *e)
@@ -459,7 +1008,7 @@ static void blob_key_event_cb(lv_event_t *e)
     lv_obj_t *key = static_cast<lv_obj_t *>(lv_event_get_target(e));
     if (!key)
         return;
-    const char *letters = (const char *)lv_obj_get_user_data(key);
+    int key_index = (int)(intptr_t)lv_obj_get_user_data(key);
 
     if (code == LV_EVENT_PRESSING)
     {
@@ -467,51 +1016,60 @@ static void blob_key_event_cb(lv_event_t *e)
         if (indev)
         {
             lv_indev_get_point(indev, &last_touch_point);
-            // Get key's absolute position on screen
-            lv_area_t key_area;
-            lv_obj_get_coords(key, &key_area);
-
-            // Calculate touch position relative to the key's top-left corner
-            lv_coord_t touch_x_rel = last_touch_point.x - key_area.x1;
-
-            // Determine letter index (0: left, 1: center, 2: right)
-            // Basic thresholding based on key width
-            lv_coord_t key_width = lv_area_get_width(&key_area);
-            lv_coord_t left_thresh = key_width / 3;
-            lv_coord_t right_thresh = 2 * key_width / 3;
-
-            if (touch_x_rel < left_thresh)
+            // The finger slides over the alternates, the letter stays the same
+            if (alt_popup_is_open())
             {
-                active_blob_key_letter_index = 0;
+                alt_popup_select(&last_touch_point);
+                return;
             }
-            else if (touch_x_rel > right_thresh)
-            {
-                active_blob_key_letter_index = 2;
-            }
-            else
+            active_blob_key_letter_index = blob_key_letter_index(key, &last_touch_point);
+            update_blob_key_visuals(key, active_blob_key_letter_index, true);
+        }
+    }
+    else if (code == LV_EVENT_LONG_PRESSED)
+    {
+        if (active_blob_key_letter_index != -1 && !emoji_picker_shown()) // No alternates for emoji
+        {
+            // Popup centered on the held letter's third of the key
+            lv_area_t key_area;
+            lv_obj_get_coords(key, &key_area);
+            lv_coord_t letter_x = key_area.x1 + (2 * active_blob_key_letter_index + 1) * lv_area_get_width(&key_area) / 6;
+            const char *letter = keymap_slot(current_layer, key_index, active_blob_key_letter_index);
+            if (alt_popup_open(letter, keymap_alternates(letter), &key_area, letter_x))
             {
-                active_blob_key_letter_index = 1;
+#if LV_COLOR_DEPTH == 8
+                color_l8_set_region_obj(alt_popup_region, alt_popup_get_obj());
+#endif
             }
-            update_blob_key_visuals(key, active_blob_key_letter_index, true);
         }
     }
     else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST)
     {
         if (active_blob_key_letter_index != -1)
         {
+            // The selected alternate replaces the letter
+            const char *text = NULL;
+            if (alt_popup_is_open())
+            {
+                text = alt_popup_close();
+#if LV_COLOR_DEPTH == 8
+                color_l8_set_region_obj(alt_popup_region, NULL);
+#endif
+            }
+
             // Add character to input buffer only on valid release
             if (code == LV_EVENT_RELEASED)
             {
-                add_char_to_input(letters[active_blob_key_letter_index]);
+                perf_hud_mark_input();
+                flush_scheduler_mark_input();
+#if EMOJI_LAYER
+                if (emoji_picker_shown())
+                    add_emoji_to_input(key_index, active_blob_key_letter_index);
+                else
+#endif
+                    add_text_to_input(text ? text : keymap_slot(current_layer, key_index, active_blob_key_letter_index));
             }
-            // Reset visuals after a short delay
-            lv_timer_t *t = lv_timer_create([](lv_timer_t *timer)
-                                            {
-                                                lv_obj_t *target_key = (lv_obj_t *)timer->user_data;
-                                                reset_blob_key_visuals(target_key);
-                                                lv_timer_delete(timer); },
-                                            100, key);
-            lv_timer_set_repeat_count(t, 1);
+            schedule_blob_key_reset(key);
 
             active_blob_key_letter_index = -1; // Reset index
         }
@@ -523,44 +1081,161 @@ static void blob_key_event_cb(lv_event_t *e)
     }
 }
 
+#if TOUCH_ROLLOVER
+static void rollover_key_cb(lv_obj_t *key, const lv_point_t *point, touch_rollover_phase_t phase)
+{
+    // A second finger on a blob key: same letter choice as blob_key_event_cb, typed when it lifts
+    int letter_index = blob_key_letter_index(key, point);
+    if (phase != TOUCH_ROLLOVER_RELEASED)
+    {
+        update_blob_key_visuals(key, letter_index, true);
+        return;
+    }
+
+    int key_index = (int)(intptr_t)lv_obj_get_user_data(key);
+    perf_hud_mark_input();
+    flush_scheduler_mark_input();
+#if EMOJI_LAYER
+    if (emoji_picker_shown())
+        add_emoji_to_input(key_index, letter_index);
+    else
+#endif
+        add_text_to_input(keymap_slot(current_layer, key_index, letter_index));
+    schedule_blob_key_reset(key);
+}
+#endif
+
 static void action_button_event_cb(lv_event_t *e)
 {
     lv_event_code_t code = lv_event_get_code(e);
-    const char *action = (const char *)lv_event_get_user_data(e);
+    int action_key = (int)(intptr_t)lv_event_get_user_data(e);
 
+    // Space: a long press switches to the next keymap. 123 (EMOJI_LAYER): it opens the
+    // emoji picker at the page shown last
+    if (code == LV_EVENT_PRESSED)
+    {
+        action_long_pressed = false;
+    }
+    else if (code == LV_EVENT_LONG_PRESSED)
+    {
+        if (action_key == ACTION_KEY_SPACE)
+        {
+            action_long_pressed = true;
+        }
+#if EMOJI_LAYER
+        else if (action_key == ACTION_KEY_NUMBERS && emoji_page < 0 && emoji_glyphs_count())
+        {
+            action_long_pressed = true;
+        }
+#endif
+    }
     if (code == LV_EVENT_CLICKED)
     {
-        if (strcmp(action, "clear") == 0)
+        perf_hud_mark_input();
+        flush_scheduler_mark_input();
+        if (action_long_pressed)
         {
-            clear_input();
+            // Done once the key is released: the keyboard cache renders every key as
+            // shown, a key still held would stay drawn pressed in its images
+            action_long_pressed = false;
+            if (action_key == ACTION_KEY_SPACE)
+                select_next_keymap();
+#if EMOJI_LAYER
+            else if (action_key == ACTION_KEY_NUMBERS)
+                set_emoji_page(emoji_last_page);
+#endif
+            return;
         }
-        else if (strcmp(action, "accept") == 0)
+#if EMOJI_LAYER
+        if (emoji_page >= 0 && action_key == ACTION_KEY_SHIFT)
         {
-            accept_input();
+            uint32_t pages = (emoji_glyphs_count() + EMOJI_PAGE_SIZE - 1) / EMOJI_PAGE_SIZE;
+            set_emoji_page((emoji_page + 1) % pages);
+            return;
         }
-        else if (strcmp(action, "space") == 0)
+        if (emoji_page >= 0 && action_key == ACTION_KEY_NUMBERS)
         {
+            set_key_layer(current_layer);
+            return;
+        }
+#endif
+        switch (keymap_action(action_key))
+        {
+        case KEYMAP_ACTION_CLEAR:
+            clear_input();
+            break;
+        case KEYMAP_ACTION_ACCEPT:
+            accept_input();
+            break;
+        case KEYMAP_ACTION_SPACE:
             add_char_to_input(' ');
+            break;
+        case KEYMAP_ACTION_LAYER:
+            set_key_layer(keymap_target(current_layer, action_key));
+            break;
+        case KEYMAP_ACTION_NONE:
+            break;
         }
-        // Add shift, numbers later
     }
 }
 
 // --- UI Update Functions ---
 
+static int blob_key_letter_index(lv_obj_t *key, const lv_point_t *point)
+{
+    // Get key's absolute position on screen
+    lv_area_t key_area;
+    lv_obj_get_coords(key, &key_area);
+
+    // Calculate touch position relative to the key's top-left corner
+    lv_coord_t touch_x_rel = point->x - key_area.x1;
+
+    // Determine letter index (0: left, 1: center, 2: right)
+    // Basic thresholding based on key width
+    lv_coord_t key_width = lv_area_get_width(&key_area);
+    lv_coord_t left_thresh = key_width / 3;
+    lv_coord_t right_thresh = 2 * key_width / 3;
+
+    if (touch_x_rel < left_thresh)
+        return 0;
+    if (touch_x_rel > right_thresh)
+        return 2;
+    return 1;
+}
+
+static void schedule_blob_key_reset(lv_obj_t *key)
+{
+    // Reset visuals after a short delay
+    lv_timer_t *t = lv_timer_create([](lv_timer_t *timer)
+                                    {
+                                        lv_obj_t *target_key = (lv_obj_t *)timer->user_data;
+                                        reset_blob_key_visuals(target_key);
+                                        lv_timer_delete(timer); },
+                                    100, key);
+    lv_timer_set_repeat_count(t, 1);
+}
+
 static void update_blob_key_visuals(lv_obj_t *key, int letter_index, bool pressed)
 {
     if (!key)
         return;
 
     // Update container border
-    lv_obj_set_style_border_color(key, pressed ? COLOR_BUTTON_ACTIVE : COLOR_BUTTON, 0);
+    if (pressed)
+        lv_obj_add_state(key, KEY_STATE_ACTIVE);
+    else
+        lv_obj_remove_state(key, KEY_STATE_ACTIVE);
+    // Differs from the cached keyboard image until reset
+    lv_obj_add_state(key, KEYBOARD_CACHE_STATE_LIVE);
+#if LV_COLOR_DEPTH == 8
+    color_l8_set_region_obj(active_key_region, pressed ? key : NULL);
+#endif
 
     // Update letter visuals
     for (uint32_t i = 0; i < lv_obj_get_child_count(key); i++)
     {
         lv_obj_t *child = lv_obj_get_child(key, i);
-        if (lv_obj_check_type(child, &lv_label_class))
+        if (lv_obj_check_type(child, &lv_image_class) || lv_obj_check_type(child, &lv_label_class))
         {
             // Determine the index this label represents (0, 1, or 2) based on its alignment/position
             // This is a bit fragile; storing index in user_data might be better
@@ -592,13 +1267,17 @@ static void reset_blob_key_visuals(lv_obj_t *key)
     if (!key)
         return;
     // Reset container border
-    lv_obj_set_style_border_color(key, COLOR_BUTTON, 0);
+    lv_obj_remove_state(key, KEY_STATE_ACTIVE | KEYBOARD_CACHE_STATE_LIVE);
+#if LV_COLOR_DEPTH == 8
+    if (color_l8_get_region_obj(active_key_region) == key)
+        color_l8_set_region_obj(active_key_region, NULL);
+#endif
 
     // Reset all letter visuals to default (visible, not active)
     for (uint32_t i = 0; i < lv_obj_get_child_count(key); i++)
     {
         lv_obj_t *child = lv_obj_get_child(key, i);
-        if (lv_obj_check_type(child, &lv_label_class))
+        if (lv_obj_check_type(child, &lv_image_class) || lv_obj_check_type(child, &lv_label_class))
         {
             lv_obj_remove_state(child, LV_STATE_USER_1); // Deactivate
             lv_obj_remove_state(child, LV_STATE_USER_2); // Make visible
@@ -606,30 +1285,30 @@ static void reset_blob_key_visuals(lv_obj_t *key)
     }
 }
 
-static void cursor_blink_timer_cb(lv_timer_t *timer)
+#if LV_COLOR_DEPTH == 8
+static void pressed_key_region_cb(lv_event_t *e)
 {
-    // Toggle visibility using add/remove flag based on current state
-    if (lv_obj_has_flag(text_cursor, LV_OBJ_FLAG_HIDDEN))
-    {
-        lv_obj_remove_flag(text_cursor, LV_OBJ_FLAG_HIDDEN);
-    }
-    else
-    {
-        lv_obj_add_flag(text_cursor, LV_OBJ_FLAG_HIDDEN);
-    }
+    // Action keys turn COLOR_BUTTON_ACTIVE while pressed (style_key_pressed)
+    lv_obj_t *key = static_cast<lv_obj_t *>(lv_event_get_target(e));
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_PRESSED)
+        color_l8_set_region_obj(active_key_region, key);
+    else if ((code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) && color_l8_get_region_obj(active_key_region) == key)
+        color_l8_set_region_obj(active_key_region, NULL);
+}
+#endif
 
-    if (lv_obj_has_flag(input_cursor, LV_OBJ_FLAG_HIDDEN))
-    {
-        lv_obj_remove_flag(input_cursor, LV_OBJ_FLAG_HIDDEN);
-    }
-    else
+static void cursor_blink_timer_cb(lv_timer_t *timer)
+{
+    // Only the cursor rectangles are written to the panel, LVGL renders nothing.
+    // Cursor positions are updated where the text changes.
+    static uint32_t last_blink_px = 0;
+    uint32_t blink_px = cursor_overlay_blink();
+    if (blink_px != last_blink_px)
     {
-        lv_obj_add_flag(input_cursor, LV_OBJ_FLAG_HIDDEN);
+        log_d("Cursor blink: %lu px written to the panel", (unsigned long)blink_px);
+        last_blink_px = blink_px;
     }
-
-    // Recalculate cursor positions (needed if text changes)
-    update_text_area_display(); // This implicitly updates text_cursor pos
-    update_input_display();     // This implicitly updates input_cursor pos
 }
 
 static void update_input_display()
@@ -637,8 +1316,12 @@ static void update_input_display()
     lv_label_set_text(input_text_label, input_buffer);
     // Position cursor after the text in the input label
     lv_obj_update_layout(input_text_label); // Ensure label size is calculated
-    // Align cursor relative to the input_text_label itself
-    lv_obj_align_to(input_cursor, input_text_label, LV_ALIGN_OUT_RIGHT_MID, 1, 0); // Position cursor right after text
+    lv_area_t label_area, input_area;
+    lv_obj_get_coords(input_text_label, &label_area);
+    lv_obj_get_coords(lv_obj_get_parent(input_text_label), &input_area);
+    // Position cursor right after text, vertically centered on the label
+    cursor_overlay_move(input_cursor, label_area.x2 + 2,
+                        label_area.y1 + (lv_area_get_height(&label_area) - INPUT_CURSOR_HEIGHT) / 2, &input_area);
 }
 
 static void update_text_area_display()
@@ -648,7 +1331,7 @@ static void update_text_area_display()
 
     lv_point_t pos;
     const char *txt = lv_label_get_text(text_content_label);
-    uint32_t txt_len = strlen(txt);
+    uint32_t txt_len = lv_text_get_encoded_length(txt); // Letters, not bytes: emoji are UTF-8
 
     // Get the position of the character *at* the end of the string
     lv_label_get_letter_pos(text_content_label, txt_len, &pos);
@@ -656,7 +1339,7 @@ static void update_text_area_display()
     // Adjust vertical position based on font line height for better centering
     const lv_font_t *font = lv_obj_get_style_text_font(text_content_label, 0);
     lv_coord_t line_height = lv_font_get_line_height(font);
-    lv_coord_t cursor_height = lv_obj_get_height(text_cursor);
+    lv_coord_t cursor_height = TEXT_CURSOR_HEIGHT;
 
     // If the text ends exactly at a line break, the calculated pos.y might be
     // on the *next* line. We need to detect this or adjust.
@@ -669,23 +1352,45 @@ static void update_text_area_display()
 
     pos.y += (line_height - cursor_height) / 2; // Center vertically on the line
 
-    // Align cursor relative to the text_content_label's top-left
-    lv_obj_align_to(text_cursor, text_content_label, LV_ALIGN_TOP_LEFT, pos.x + 1, pos.y);
+    // Place cursor relative to the text_content_label's top-left, clipped to the text area
+    lv_area_t label_area, text_area;
+    lv_obj_get_coords(text_content_label, &label_area);
+    lv_obj_get_coords(lv_obj_get_parent(text_content_label), &text_area);
+    cursor_overlay_move(text_cursor, label_area.x1 + pos.x + 1, label_area.y1 + pos.y, &text_area);
 }
 
 // --- Action Functions ---
 
 static void add_char_to_input(char c)
 {
+    char text[2] = {c, '\0'};
+    add_text_to_input(text);
+}
+
+static void add_text_to_input(const char *text)
+{
+    boot_trace_first_key();
     size_t len = strlen(input_buffer);
-    if (len < sizeof(input_buffer) - 1)
+    size_t text_len = strlen(text);
+    if (len + text_len < sizeof(input_buffer)) // A UTF-8 character is never cut
     {
-        input_buffer[len] = c;
-        input_buffer[len + 1] = '\0';
+        memcpy(input_buffer + len, text, text_len + 1);
         update_input_display();
     }
 }
 
+#if EMOJI_LAYER
+static void add_emoji_to_input(int key_index, int letter_index)
+{
+    if (emoji_key_codepoints[key_index][letter_index])
+    {
+        char text[5];
+        emoji_glyphs_utf8(emoji_key_codepoints[key_index][letter_index], text);
+        add_text_to_input(text);
+    }
+}
+#endif
+
 static void clear_input()
 {
     input_buffer[0] = '\0';
@@ -696,17 +1401,12 @@ static void accept_input()
 {
     if (strlen(input_buffer) > 0)
     {
-        // Append input buffer to the existing text content label
-        const char *current_text = lv_label_get_text(text_content_label);
-        // Use lv_label_ins_text for potentially better efficiency if available/needed
-        // For simplicity, using strcat here. Be mindful of buffer overflows in real apps.
-        char *new_text = (char *)malloc(strlen(current_text) + strlen(input_buffer) + 1);
-        if (new_text)
+        // Append input buffer to the document
+        if (append_document_text(input_buffer))
         {
-            strcpy(new_text, current_text);
-            strcat(new_text, input_buffer);
-            lv_label_set_text(text_content_label, new_text);
-            free(new_text);
+#if DOC_JOURNAL && !SOAK_TEST
+            doc_journal_append(&doc_journal, input_buffer, strlen(input_buffer));
+#endif
         }
         else
         {
@@ -718,15 +1418,361 @@ static void accept_input()
     }
 }
 
+#if RENDER_BENCH || SOAK_TEST
+// --- Scripted Typing (render benchmark, soak test) ---
+
+static void key_tap_point(lv_obj_t *key, int letter_index, lv_point_t *point)
+{
+    // Middle of the left / center / right third, as blob_key_event_cb splits the key
+    lv_area_t a;
+    lv_obj_get_coords(key, &a);
+    lv_coord_t w = lv_area_get_width(&a);
+    point->x = a.x1 + (letter_index < 0 ? w / 2 : w * (2 * letter_index + 1) / 6);
+    point->y = a.y1 + lv_area_get_height(&a) / 2;
+}
+
+#if RENDER_BENCH
+static bool char_tap_point(char c, lv_point_t *point)
+{
+    if (c == ' ')
+    {
+        key_tap_point(action_keys[ACTION_KEY_SPACE], -1, point);
+        return true;
+    }
+
+    // On the first layer of the keymap
+    for (int i = 0; i < 12; i++)
+        for (int j = 0; j < 3; j++)
+        {
+            const char *letter = keymap_slot(0, i, j);
+            if (letter[0] == c && letter[1] == '\0')
+            {
+                key_tap_point(blob_keys[i], j, point);
+                return true;
+            }
+        }
+
+    return false;
+}
+
+static int build_bench_taps(const char *text, lv_point_t *taps, int max_taps)
+{
+    int count = 0;
+    for (const char *c = text; *c && count < max_taps - 1; c++)
+        if (char_tap_point(*c, &taps[count]))
+            count++;
+
+    // Accept: the text moves to the text area
+    key_tap_point(action_keys[ACTION_KEY_ACCEPT], -1, &taps[count++]);
+    return count;
+}
+#endif
+#endif
+
+#if SOAK_TEST
+static void soak_tap(uint32_t random, lv_point_t *point)
+{
+    // Starting over, like a user with a new document
+    if (document_length() > SOAK_TEST_DOCUMENT_MAX)
+    {
+        set_document_text("");
+        update_text_area_display();
+    }
+
+    // Mostly letters (any third of any key, in whatever layer is shown), then space, layer switches, clear and accept
+    uint32_t pick = random % 100;
+    random /= 100;
+    if (pick < 80)
+        key_tap_point(blob_keys[random % 12], random / 12 % 3, point);
+    else if (pick < 90)
+        key_tap_point(action_keys[ACTION_KEY_SPACE], -1, point);
+    else if (pick < 94)
+        key_tap_point(action_keys[ACTION_KEY_SHIFT], -1, point);
+    else if (pick < 96)
+        key_tap_point(action_keys[ACTION_KEY_NUMBERS], -1, point);
+    else if (pick < 98)
+        key_tap_point(action_keys[ACTION_KEY_CLEAR], -1, point);
+    else
+        key_tap_point(action_keys[ACTION_KEY_ACCEPT], -1, point);
+}
+#endif
+
 // --- Arduino Setup and Loop ---
 
+// Measurements and benchmarks once the UI is complete
+static void run_boot_measurements()
+{
+#if PERF_HUD
+    lv_display_t *disp = lv_display_get_default();
+    // Cost of redrawing one key in both colour states
+    lv_obj_t *key = blob_keys[0];
+    update_blob_key_visuals(key, 1, true);
+    uint32_t pressed_us = perf_measure_redraw_us(key);
+    reset_blob_key_visuals(key);
+    uint32_t released_us = perf_measure_redraw_us(key);
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    log_i("Key redraw: pressed %lu us, released %lu us, LVGL heap peak %lu bytes",
+          (unsigned long)pressed_us, (unsigned long)released_us, (unsigned long)mon.max_used);
+    // Resolving every style of the screen again (as a theme change would), and the heap
+    // the objects hold (local styles included)
+    uint32_t style_start = micros();
+    lv_obj_refresh_style(scr, LV_PART_ANY, LV_STYLE_PROP_ANY);
+    lv_obj_update_layout(scr);
+    uint32_t style_us = micros() - style_start;
+    log_i("Styles: screen refresh %lu us, LVGL heap used %lu bytes", (unsigned long)style_us,
+          (unsigned long)(mon.total_size - mon.free_size));
+#if KEYBOARD_CACHE
+    // Cost of redrawing the whole keyboard from styles and from the cached bitmap
+    keyboard_cache_set_enabled(false);
+    uint32_t live_us = perf_measure_redraw_us(keyboard_area);
+    keyboard_cache_set_enabled(true);
+    uint32_t cached_us = perf_measure_redraw_us(keyboard_area);
+    log_i("Keyboard redraw: live %lu us, cached %lu us", (unsigned long)live_us, (unsigned long)cached_us);
+#endif
+    // Cost of a layer switch: swapping the glyphs, then rendering and flushing what they invalidated.
+    // Through every layer of the keymap and back to the first
+    for (int i = 1; i <= keymap_layer_count(); i++)
+    {
+        uint8_t layer = i % keymap_layer_count();
+        lv_refr_now(disp);
+        flush_hooks_stats_t before = *flush_hooks_get_stats();
+        uint32_t start = micros();
+        set_key_layer(layer);
+        uint32_t switch_us = micros() - start;
+        lv_refr_now(disp);
+        uint32_t frame_us = micros() - start;
+        const flush_hooks_stats_t *after = flush_hooks_get_stats();
+        log_i("Layer switch to %d: update %lu us, on screen %lu us, %lu px in %lu transactions", layer,
+              (unsigned long)switch_us, (unsigned long)frame_us, (unsigned long)((after->bytes - before.bytes) / sizeof(uint16_t)),
+              (unsigned long)(after->transactions - before.transactions));
+    }
+#endif
+
+#if RENDER_BENCH
+    // Same typing session on every board
+    static lv_point_t taps[64];
+    int tap_count = build_bench_taps("the quick brown fox jumps over the lazy dog", taps, 64);
+    render_bench_run(lv_display_get_default(), taps, tap_count);
+#endif
+
+#if SOAK_TEST
+    // Driven from loop()
+    soak_test_start(lv_display_get_default(), soak_tap);
+#endif
+}
+
+// --- Staged UI Construction ---
+// The first frame only needs the status bar, the text area and the key outlines
+// (keyboard_outline_draw_cb); the rest is built in stages from loop(), each one
+// after the display has refreshed with the previous one.
+
+static void build_glyphs()
+{
+#if GLYPH_ATLAS
+    // Pre-render the keyboard glyphs of every layer of the keymap (same font as style_letter_label / style_key)
+    int layers = keymap_layer_count();
+    int chars_count = layers * KEYMAP_KEYS * KEYMAP_SLOTS;
+    int labels_count = layers * KEYMAP_ACTION_KEYS;
+#if EMOJI_LAYER
+    labels_count += sizeof(picker_labels) / sizeof(picker_labels[0]);
+#endif
+    const char **texts = (const char **)malloc((chars_count + labels_count) * sizeof(*texts));
+    if (!texts)
+    {
+        log_e("Failed to allocate memory for the glyph atlas texts");
+        return;
+    }
+    const char **text = texts;
+    for (int layer = 0; layer < layers; layer++)
+        for (int i = 0; i < KEYMAP_KEYS; i++)
+            for (int j = 0; j < KEYMAP_SLOTS; j++)
+                *text++ = keymap_slot(layer, i, j);
+    for (int layer = 0; layer < layers; layer++)
+        for (int i = 0; i < KEYMAP_ACTION_KEYS; i++)
+            *text++ = keymap_label(layer, i);
+#if EMOJI_LAYER
+    for (size_t i = 0; i < sizeof(picker_labels) / sizeof(picker_labels[0]); i++)
+        *text++ = picker_labels[i];
+#endif
+    glyph_atlas_build(UI_FONT_14, texts, chars_count, texts + chars_count, labels_count);
+    free(texts);
+#endif
+}
+
+static void build_document()
+{
+#if DOC_JOURNAL
+    // Text accepted before the last power off (before any key exists, so nothing is accepted meanwhile)
+    char *restored;
+    uint32_t restored_len;
+    if (doc_journal_open(&doc_journal, doc_journal_littlefs_store(), &document, &restored, &restored_len) && restored)
+    {
+        // A warm resume already shows the same text (saved after the last accept)
+        if (!document_resumed)
+        {
+            set_document_text(restored);
+            update_text_area_display();
+        }
+        free(restored);
+    }
+    // Compactions are written in small steps
+    lv_timer_create([](lv_timer_t *) { doc_journal_poll(&doc_journal); }, DOC_JOURNAL_STEP_MS, NULL);
+#endif
+#if DOC_STORE
+    doc_store_report();
+#if DOC_STORE_BENCH
+    doc_store_bench();
+#endif
+#endif
+}
+
+static void build_top_row()
+{
+    create_top_row();
+#if LV_COLOR_DEPTH == 8
+    // Gray input field inside its border
+    color_l8_add_region(lv_obj_get_parent(input_text_label), COLOR_L8_INK, 1);
+#endif
+    update_input_display();
+}
+
+static void finish_ui()
+{
+    finish_keyboard();
+
+#if LV_COLOR_DEPTH == 8
+    // Green pressed key on top
+    active_key_region = color_l8_add_region(NULL, COLOR_BUTTON_ACTIVE_RGB, 0);
+    alt_popup_region = color_l8_add_region(NULL, COLOR_BUTTON_RGB, 0);
+#endif
+
+    // Created once, shown on a long press of a letter
+    alt_popup_init(BLOB_KEY_WIDTH / 2, BLOB_KEY_HEIGHT, UI_FONT_14, COLOR_BUTTON, COLOR_BUTTON_ACTIVE);
+
+#if TOUCH_ROLLOVER
+    // A second finger on a blob key is tracked beside LVGL's pointer
+    // (the touch input device of esp32-smartdisplay is the only one)
+    if (touch_rollover_init(lv_indev_get_next(NULL), rollover_key_cb))
+    {
+        for (int i = 0; i < 12; i++)
+            touch_rollover_add_key(blob_keys[i]);
+    }
+#endif
+#if TOUCH_FILTER
+    // Resistive panels: filtered samples instead of raw readings
+    touch_filter_init(lv_indev_get_next(NULL));
+#endif
+#if TOUCH_TRACE
+    // Records the raw samples of the filter, else what the stages above deliver to LVGL
+    touch_trace_init(lv_indev_get_next(NULL));
+#endif
+
+}
+
+typedef struct
+{
+    const char *name; // Boot trace phase
+    void (*build)();
+    bool on_screen; // Part of the screen a warm resume shows in its first frame
+} ui_stage_t;
+
+static const ui_stage_t ui_stages[] = {
+    {"glyph atlas", build_glyphs, true},
+    {"document", build_document, false},
+    {"top row", build_top_row, true},
+    {"blob row 1", [] { create_blob_row(0); }, true},
+    {"blob row 2", [] { create_blob_row(1); }, true},
+    {"blob row 3", [] { create_blob_row(2); }, true},
+    {"bottom row", create_bottom_row, true},
+    {"ui ready", finish_ui, false},
+};
+#define UI_STAGE_COUNT (sizeof(ui_stages) / sizeof(ui_stages[0]))
+#define UI_STAGES_ALL ((1u << UI_STAGE_COUNT) - 1)
+
+static uint32_t ui_stages_built; // Bit per ui_stages entry
+#if LAZY_UI
+static bool ui_stage_refreshed; // The display refreshed since the last stage
+
+static void ui_stage_refr_cb(lv_event_t *e)
+{
+    ui_stage_refreshed = true;
+}
+#endif
+
+static void build_ui_stage(size_t i)
+{
+    ui_stages[i].build();
+    boot_trace_mark(ui_stages[i].name);
+    ui_stages_built |= 1u << i;
+    if (ui_stages_built == UI_STAGES_ALL)
+    {
+        log_i("UI Initialized (Rotated to %dx%d)", lv_disp_get_hor_res(NULL), lv_disp_get_ver_res(NULL));
+        boot_trace_report();
+#if LAZY_UI
+        lv_display_remove_event_cb_with_user_data(lv_display_get_default(), ui_stage_refr_cb, NULL);
+#endif
+        run_boot_measurements();
+    }
+}
+
+// The first stage not built yet; false when all are
+static bool build_next_ui_stage()
+{
+    for (size_t i = 0; i < UI_STAGE_COUNT; i++)
+    {
+        if (!(ui_stages_built & (1u << i)))
+        {
+            build_ui_stage(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// --- Warm Resume ---
+
+// The screen as it was before the deep sleep (once the keys exist)
+static void apply_ui_state(const ui_state_t *state)
+{
+    if (state->document)
+    {
+        set_document_text(state->document);
+        document_resumed = true;
+    }
+    strncpy(input_buffer, state->input, sizeof(input_buffer) - 1);
+    if (state->layer < keymap_layer_count())
+        set_key_layer(state->layer);
+    update_input_display();
+    update_text_area_display();
+}
+
+#if WARM_RESUME
+static void enter_deep_sleep()
+{
+#if DOC_STORE
+    ui_state_t state = {current_layer, input_buffer, doc_store_text()}; // NULL when longer than the view
+#else
+    ui_state_t state = {current_layer, input_buffer, lv_label_get_text(text_content_label)};
+#endif
+    smartdisplay_lcd_set_backlight(0);
+    warm_resume_sleep(&state);
+}
+#endif
+
 void setup()
 {
+    Serial.begin(115200);
+    ui_state_t resume;
+    bool warm = WARM_RESUME && warm_resume_get(&resume);
 #ifdef ARDUINO_USB_CDC_ON_BOOT
-    delay(5000);
+    // Give the host a moment to open the USB CDC port, without waiting for one that never comes
+    // (nor on a warm resume: the screen comes first)
+    for (uint32_t start = millis(); !warm && !Serial && millis() - start < BOOT_SERIAL_WAIT_MS;)
+        delay(10);
 #endif
-    Serial.begin(115200);
     Serial.setDebugOutput(true);
+    boot_trace_mark("serial");
     log_i("Board: %s", BOARD_NAME);
     log_i("CPU: %s rev%d, CPU Freq: %d Mhz, %d core(s)", ESP.getChipModel(), ESP.getChipRevision(), getCpuFrequencyMhz(), ESP.getChipCores());
     log_i("Free heap: %d bytes", ESP.getFreeHeap());
@@ -734,40 +1780,94 @@ void setup()
     log_i("SDK version: %s", ESP.getSdkVersion());
 
     smartdisplay_init();
+    boot_trace_mark("display");
 
     auto disp = lv_disp_get_default();
     // *** Rotate the display to portrait mode (320x480) ***
     // Use ROTATION_90 or ROTATION_270 depending on how the board is mounted/oriented
     // lv_disp_set_rotation(disp, LV_DISP_ROTATION_90);
 
-    // Initialize styles
-    init_styles();
+    // Hook the panel flush: cursors are composited into the flushed pixels
+    flush_hooks_init(disp);
+    flush_scheduler_init(disp);
+#if LV_COLOR_DEPTH == 8
+    color_l8_init(disp);
+#endif
+    cursor_overlay_init();
+
+#if DRAW_ASM_SELFTEST
+    draw_asm_selftest();
+#endif
+#if LVGL_ARENAS
+    lvgl_arenas_init(disp);
+#if LVGL_ARENAS_SELFTEST
+    lvgl_arenas_selftest();
+#endif
+#endif
+#if EMOJI_LAYER
+    // Before the first frame: the UI fonts fall back to emoji_font
+    emoji_glyphs_init(emoji_glyphs_file_store());
+#if EMOJI_BENCH
+    emoji_glyphs_bench();
+#endif
+#endif
+
+    // The keymap selected last (LittleFS), else the built-in one
+    keymap_init();
+    boot_trace_mark("keymap");
 
     // Create screen - Set size to the *logical* UI dimensions
     scr = lv_obj_create(NULL);
     lv_obj_remove_style_all(scr);              // Use children's background colors
     lv_obj_set_size(scr, UI_WIDTH, UI_HEIGHT); // Use UI dimensions
 
-    // Create UI components
+    // Create UI components; the keys follow in stages
     create_status_bar(scr);
     create_text_area(scr);
     create_keyboard(scr);
 
+#if LV_COLOR_DEPTH == 8
+    // Orange keyboard
+    color_l8_add_region(keyboard_area, COLOR_BUTTON_RGB, 0);
+#endif
+
     // Initialize display content
-    update_input_display();
     update_text_area_display();
 
+    if (warm)
+    {
+        // Every key on screen in the first frame, the rest follows
+        for (size_t i = 0; i < UI_STAGE_COUNT; i++)
+            if (ui_stages[i].on_screen)
+                build_ui_stage(i);
+        apply_ui_state(&resume);
+        boot_trace_mark("resumed state");
+    }
+
     // Start cursor blinking timer
     cursor_timer = lv_timer_create(cursor_blink_timer_cb, 500, NULL); // 500ms interval
 
     // Load the screen
     lv_screen_load(scr);
-
-    log_i("UI Initialized (Rotated to %dx%d)", lv_disp_get_hor_res(disp), lv_disp_get_ver_res(disp));
+    boot_trace_mark("screen");
+    boot_trace_watch_first_frame(disp);
+
+#if LAZY_UI
+    lv_display_add_event_cb(disp, ui_stage_refr_cb, LV_EVENT_REFR_READY, NULL);
+#else
+    while (build_next_ui_stage())
+        ;
+#endif
 }
 
 void loop()
 {
+#if SOAK_TEST
+    // Runs LVGL itself, on a virtual clock
+    if (soak_test_poll())
+        return;
+#endif
+
     auto const now = millis();
     static auto lv_last_tick = now;
 
@@ -778,5 +1878,21 @@ void loop()
     // Handle LVGL tasks
     lv_timer_handler();
 
+#if LAZY_UI
+    if (ui_stage_refreshed && ui_stages_built != UI_STAGES_ALL)
+    {
+        ui_stage_refreshed = false;
+        build_next_ui_stage();
+    }
+#endif
+#if WARM_RESUME
+    if (ui_stages_built == UI_STAGES_ALL && lv_display_get_inactive_time(NULL) > WARM_RESUME_IDLE_MS)
+        enter_deep_sleep();
+#endif
+
+#if TOUCH_TRACE
+    touch_trace_poll_serial(lv_display_get_default());
+#endif
+
     // delay(5); // Usually not needed if lv_timer_handler yields
 }
\ No newline at end of file
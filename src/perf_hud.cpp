@@ -0,0 +1,177 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include "perf_hud.h"
+
+// --- Fields ---
+enum
+{
+    HUD_FIELD_FPS,
+    HUD_FIELD_CPU,
+    HUD_FIELD_MEM,
+    HUD_FIELD_LATENCY,
+    HUD_FIELD_COUNT
+};
+
+static lv_obj_t *hud_fields[HUD_FIELD_COUNT];
+static char hud_text[HUD_FIELD_COUNT][16]; // Static label text, no allocation on update
+static bool hud_active = false;
+
+// --- Counters (window since the last field update) ---
+static uint32_t frame_count;
+static uint32_t render_start_us;
+static uint32_t window_start_ms;
+static uint32_t input_mark_us;   // 0: no keystroke waiting for a flush
+static uint32_t last_latency_us; // Touch-to-flush latency of the last keystroke
+
+// --- Overhead accounting (window since the last report) ---
+static uint32_t overhead_us;
+static uint32_t redrawn_px;
+static uint32_t report_frames;
+static uint32_t report_render_us;
+static uint32_t report_start_ms;
+
+// --- Field Style ---
+// Centered text, from a constant property table: no local style per field
+static const lv_style_const_prop_t style_hud_field_props[] = {
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END};
+static LV_STYLE_CONST_INIT(style_hud_field, style_hud_field_props);
+
+static void hud_display_event_cb(lv_event_t *e)
+{
+    uint32_t t0 = micros();
+    switch (lv_event_get_code(e))
+    {
+    case LV_EVENT_RENDER_START:
+        render_start_us = t0;
+        break;
+    case LV_EVENT_RENDER_READY:
+        frame_count++;
+        report_frames++;
+        report_render_us += t0 - render_start_us;
+        break;
+    case LV_EVENT_FLUSH_FINISH:
+        // The flush has been handed to the panel driver
+        if (input_mark_us != 0)
+        {
+            last_latency_us = t0 - input_mark_us;
+            input_mark_us = 0;
+        }
+        break;
+    default:
+        break;
+    }
+    overhead_us += micros() - t0;
+}
+
+static void set_field(int field, const char *text)
+{
+    // Only touch the label when the text really changed: the label has a fixed
+    // size so this invalidates its own rectangle and nothing else
+    if (strcmp(hud_text[field], text) == 0)
+        return;
+
+    strncpy(hud_text[field], text, sizeof(hud_text[field]) - 1);
+    lv_label_set_text_static(hud_fields[field], hud_text[field]);
+    redrawn_px += lv_obj_get_width(hud_fields[field]) * lv_obj_get_height(hud_fields[field]);
+}
+
+static void hud_update_timer_cb(lv_timer_t *timer)
+{
+    uint32_t t0 = micros();
+    uint32_t now = millis();
+    uint32_t elapsed = now - window_start_ms;
+    if (elapsed == 0)
+        return;
+
+    char text[16];
+
+    lv_snprintf(text, sizeof(text), "%lu fps", (unsigned long)(frame_count * 1000 / elapsed));
+    set_field(HUD_FIELD_FPS, text);
+
+    lv_snprintf(text, sizeof(text), "cpu %lu%%", (unsigned long)(100 - lv_timer_get_idle()));
+    set_field(HUD_FIELD_CPU, text);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    lv_snprintf(text, sizeof(text), "%luk %u%%", (unsigned long)((mon.total_size - mon.free_size) / 1024), mon.frag_pct);
+    set_field(HUD_FIELD_MEM, text);
+
+    if (last_latency_us != 0)
+    {
+        lv_snprintf(text, sizeof(text), "%lu ms", (unsigned long)(last_latency_us / 1000));
+        set_field(HUD_FIELD_LATENCY, text);
+    }
+
+    frame_count = 0;
+    window_start_ms = now;
+    overhead_us += micros() - t0;
+
+    uint32_t report_elapsed = now - report_start_ms;
+    if (report_elapsed >= PERF_HUD_REPORT_MS)
+    {
+        // Overhead of the HUD itself: event hooks + field updates, and the pixels it invalidated
+        uint32_t pct100 = overhead_us * 10 / report_elapsed; // Hundredths of a percent
+        log_i("HUD overhead: %lu us/s (%lu.%02lu%% CPU), %lu px/s redrawn; render avg %lu us/frame",
+              (unsigned long)(overhead_us * 1000 / report_elapsed),
+              (unsigned long)(pct100 / 100), (unsigned long)(pct100 % 100),
+              (unsigned long)(redrawn_px * 1000 / report_elapsed),
+              (unsigned long)(report_frames ? report_render_us / report_frames : 0));
+        overhead_us = 0;
+        redrawn_px = 0;
+        report_frames = 0;
+        report_render_us = 0;
+        report_start_ms = now;
+    }
+}
+
+void perf_hud_create(lv_obj_t *bar)
+{
+    lv_obj_update_layout(bar); // Ensure the bar's content width is calculated
+    const lv_font_t *font = lv_obj_get_style_text_font(bar, 0);
+    lv_coord_t field_width = lv_obj_get_content_width(bar) / HUD_FIELD_COUNT;
+    lv_coord_t field_height = lv_font_get_line_height(font);
+
+    for (int i = 0; i < HUD_FIELD_COUNT; i++)
+    {
+        lv_obj_t *field = lv_label_create(bar);
+        // Fixed size: a text change never resizes the label or moves its neighbours
+        lv_obj_set_size(field, field_width, field_height);
+        lv_label_set_long_mode(field, LV_LABEL_LONG_CLIP);
+        lv_obj_add_style(field, &style_hud_field, 0);
+        lv_obj_align(field, LV_ALIGN_LEFT_MID, i * field_width, 0);
+        hud_text[i][0] = '\0';
+        lv_label_set_text_static(field, hud_text[i]);
+        hud_fields[i] = field;
+    }
+
+    lv_display_t *disp = lv_display_get_default();
+    lv_display_add_event_cb(disp, hud_display_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, hud_display_event_cb, LV_EVENT_RENDER_READY, NULL);
+    lv_display_add_event_cb(disp, hud_display_event_cb, LV_EVENT_FLUSH_FINISH, NULL);
+
+    window_start_ms = report_start_ms = millis();
+    lv_timer_create(hud_update_timer_cb, PERF_HUD_UPDATE_MS, NULL);
+    hud_active = true;
+}
+
+void perf_hud_mark_input()
+{
+    if (!hud_active)
+        return;
+
+    // Never 0, that value means "nothing pending"
+    input_mark_us = micros() | 1;
+}
+
+uint32_t perf_measure_redraw_us(lv_obj_t *obj)
+{
+    lv_display_t *disp = lv_obj_get_display(obj);
+    // Flush whatever is pending so that only obj is measured
+    lv_refr_now(disp);
+
+    lv_obj_invalidate(obj);
+    uint32_t start = micros();
+    lv_refr_now(disp);
+    return micros() - start;
+}
@@ -0,0 +1,114 @@
+#include <Arduino.h>
+#include <lvgl.h>
+// The draw buffers are not part of the public API
+#include "src/display/lv_display_private.h"
+#include "flush_hooks.h"
+#include "render_bench.h"
+
+static lv_point_t tap_point;
+static bool tap_pressed = false;
+static bool running = false;
+
+static uint32_t refr_start_us;
+static bool frame_rendered;
+static uint32_t frames = 0;
+static uint64_t frame_us_total = 0;
+static uint32_t frame_us_max = 0;
+
+static void bench_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    data->point = tap_point;
+    data->state = tap_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static void display_event_cb(lv_event_t *e)
+{
+    if (!running)
+        return;
+
+    switch (lv_event_get_code(e))
+    {
+    case LV_EVENT_REFR_START:
+        refr_start_us = micros();
+        frame_rendered = false;
+        break;
+
+    case LV_EVENT_RENDER_START:
+        frame_rendered = true;
+        break;
+
+    case LV_EVENT_REFR_READY:
+        // Layout, render and flush; refreshes with nothing to draw are not frames
+        if (frame_rendered)
+        {
+            uint32_t us = micros() - refr_start_us;
+            frames++;
+            frame_us_total += us;
+            frame_us_max = LV_MAX(frame_us_max, us);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void run_frames(int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        lv_tick_inc(RENDER_BENCH_FRAME_MS);
+        lv_timer_handler();
+    }
+}
+
+void render_bench_run(lv_display_t *disp, const lv_point_t *taps, int tap_count)
+{
+    static bool hooked = false;
+    if (!hooked)
+    {
+        lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_REFR_START, NULL);
+        lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_RENDER_START, NULL);
+        lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_REFR_READY, NULL);
+        hooked = true;
+    }
+
+    lv_indev_t *indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(indev, bench_read_cb);
+    lv_indev_set_display(indev, disp);
+
+    // Start from a fully drawn screen
+    lv_refr_now(disp);
+    frames = 0;
+    frame_us_total = 0;
+    frame_us_max = 0;
+    flush_hooks_stats_t start = *flush_hooks_get_stats();
+
+    running = true;
+    for (int i = 0; i < tap_count; i++)
+    {
+        tap_point = taps[i];
+        tap_pressed = true;
+        run_frames(RENDER_BENCH_HOLD_FRAMES);
+        tap_pressed = false;
+        run_frames(RENDER_BENCH_IDLE_FRAMES);
+    }
+    running = false;
+
+    lv_indev_delete(indev);
+
+    const flush_hooks_stats_t *end = flush_hooks_get_stats();
+    uint32_t px = (end->bytes - start.bytes) / sizeof(uint16_t);
+    uint32_t draw_buf_size = (disp->buf_1 ? disp->buf_1->data_size : 0) + (disp->buf_2 ? disp->buf_2->data_size : 0);
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    log_i("Render bench: %d taps, %lu frames", tap_count, (unsigned long)frames);
+    log_i("| Board | Resolution | Depth | Avg frame us | Max frame us | Px flushed | Px / key | Draw buffer | LVGL heap used | LVGL heap peak |");
+    log_i("| %s | %ldx%ld | %d | %lu | %lu | %lu | %lu | %lu | %lu | %lu |", BOARD_NAME,
+          (long)lv_display_get_horizontal_resolution(disp), (long)lv_display_get_vertical_resolution(disp), LV_COLOR_DEPTH,
+          (unsigned long)(frames ? frame_us_total / frames : 0), (unsigned long)frame_us_max,
+          (unsigned long)px, (unsigned long)(tap_count ? px / tap_count : 0), (unsigned long)draw_buf_size,
+          (unsigned long)(mon.total_size - mon.free_size), (unsigned long)mon.max_used);
+}
@@ -0,0 +1,182 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include "soak_test.h"
+
+#if SOAK_TEST
+
+#if SOAK_TEST_KEYSTROKES < SOAK_TEST_SAMPLES
+#error "SOAK_TEST_KEYSTROKES must allow SOAK_TEST_SAMPLES samples"
+#endif
+
+typedef struct
+{
+    uint32_t heap_used; // LVGL heap
+    uint8_t frag_pct;
+    uint32_t system_free; // System heap, the draw buffers and malloc'ed strings live there
+    uint32_t keys_per_s;
+} soak_sample_t;
+
+// Worst values of a run of samples, and the throughput
+typedef struct
+{
+    uint32_t heap_floor;
+    uint32_t system_ceiling;
+    uint8_t frag_pct;
+    uint32_t keys_per_s;
+} soak_window_t;
+
+static soak_sample_t samples[SOAK_TEST_SAMPLES];
+static uint32_t sample_count;
+static uint32_t keystrokes;
+static uint32_t sample_start_us;
+static uint32_t random_state;
+static soak_test_tap_cb_t tap;
+static lv_indev_t *indev;
+static lv_point_t tap_point;
+static bool tap_pressed;
+static bool running;
+
+static uint32_t soak_random()
+{
+    // xorshift32, the same session on every run
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static void soak_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    data->point = tap_point;
+    data->state = tap_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static void run_frames(int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        lv_tick_inc(SOAK_TEST_FRAME_MS);
+        lv_timer_handler();
+    }
+}
+
+static void take_sample()
+{
+    uint32_t us = micros() - sample_start_us;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    soak_sample_t *s = &samples[sample_count++];
+    s->heap_used = mon.total_size - mon.free_size;
+    s->frag_pct = mon.frag_pct;
+    s->system_free = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    s->keys_per_s = us ? (uint64_t)SOAK_TEST_SAMPLE_KEYS * 1000000 / us : 0;
+    log_i("Soak test: %7lu keys, LVGL heap %6lu bytes used (fragmentation %u%%), system heap %7lu bytes free, %lu keys/s",
+          (unsigned long)keystrokes, (unsigned long)s->heap_used, s->frag_pct, (unsigned long)s->system_free,
+          (unsigned long)s->keys_per_s);
+    sample_start_us = micros();
+}
+
+static void summarize(uint32_t from, uint32_t to, soak_window_t *w)
+{
+    w->heap_floor = UINT32_MAX;
+    w->system_ceiling = 0;
+    w->frag_pct = 0;
+    uint64_t keys_per_s = 0;
+    for (uint32_t i = from; i < to; i++)
+    {
+        w->heap_floor = LV_MIN(w->heap_floor, samples[i].heap_used);
+        w->system_ceiling = LV_MAX(w->system_ceiling, samples[i].system_free);
+        w->frag_pct = LV_MAX(w->frag_pct, samples[i].frag_pct);
+        keys_per_s += samples[i].keys_per_s;
+    }
+    w->keys_per_s = keys_per_s / (to - from);
+}
+
+// Returns the number of failed checks
+static int report()
+{
+    // A leak raises the floor of what is used: the document and the input come and go
+    uint32_t third = (sample_count - SOAK_TEST_WARMUP_SAMPLES) / 3;
+    soak_window_t first, last;
+    summarize(SOAK_TEST_WARMUP_SAMPLES, SOAK_TEST_WARMUP_SAMPLES + third, &first);
+    summarize(sample_count - third, sample_count, &last);
+
+    int failures = 0;
+    if (last.heap_floor > first.heap_floor + SOAK_TEST_HEAP_SLACK)
+    {
+        log_e("Soak test: LVGL heap floor grew from %lu to %lu bytes", (unsigned long)first.heap_floor,
+              (unsigned long)last.heap_floor);
+        failures++;
+    }
+    if (last.system_ceiling + SOAK_TEST_HEAP_SLACK < first.system_ceiling)
+    {
+        log_e("Soak test: system heap free dropped from %lu to %lu bytes", (unsigned long)first.system_ceiling,
+              (unsigned long)last.system_ceiling);
+        failures++;
+    }
+    if (last.frag_pct > first.frag_pct + SOAK_TEST_FRAG_SLACK_PCT)
+    {
+        log_e("Soak test: fragmentation rose from %u%% to %u%%", first.frag_pct, last.frag_pct);
+        failures++;
+    }
+    if ((uint64_t)last.keys_per_s * 100 < (uint64_t)first.keys_per_s * (100 - SOAK_TEST_RATE_SLACK_PCT))
+    {
+        log_e("Soak test: throughput fell from %lu to %lu keys/s", (unsigned long)first.keys_per_s,
+              (unsigned long)last.keys_per_s);
+        failures++;
+    }
+
+    log_i("Soak test: %s (%d failures), %lu keys; first / last third: LVGL heap floor %lu / %lu bytes, "
+          "system heap free %lu / %lu bytes, fragmentation %u%% / %u%%, %lu / %lu keys/s",
+          failures ? "FAILED" : "passed", failures, (unsigned long)keystrokes, (unsigned long)first.heap_floor,
+          (unsigned long)last.heap_floor, (unsigned long)first.system_ceiling, (unsigned long)last.system_ceiling,
+          first.frag_pct, last.frag_pct, (unsigned long)first.keys_per_s, (unsigned long)last.keys_per_s);
+    return failures;
+}
+
+void soak_test_start(lv_display_t *disp, soak_test_tap_cb_t tap_cb)
+{
+    indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(indev, soak_read_cb);
+    lv_indev_set_display(indev, disp);
+
+    tap = tap_cb;
+    random_state = 0x5eed1234;
+    keystrokes = 0;
+    sample_count = 0;
+    running = true;
+    log_i("Soak test: %lu keystrokes, a sample every %lu", (unsigned long)SOAK_TEST_KEYSTROKES,
+          (unsigned long)SOAK_TEST_SAMPLE_KEYS);
+    sample_start_us = micros();
+}
+
+bool soak_test_poll()
+{
+    if (!running)
+        return false;
+
+    for (int i = 0; i < SOAK_TEST_BATCH && keystrokes < SOAK_TEST_KEYSTROKES; i++)
+    {
+        uint32_t r = soak_random();
+        tap(r, &tap_point);
+        tap_pressed = true;
+        // The high bits, the tap callback uses the low ones
+        run_frames((r >> 24) % SOAK_TEST_LONG_PRESS_EVERY == 0 ? SOAK_TEST_LONG_PRESS_FRAMES : SOAK_TEST_HOLD_FRAMES);
+        tap_pressed = false;
+        run_frames(SOAK_TEST_IDLE_FRAMES);
+
+        keystrokes++;
+        if (keystrokes % SOAK_TEST_SAMPLE_KEYS == 0 && sample_count < SOAK_TEST_SAMPLES)
+            take_sample();
+    }
+
+    if (keystrokes == SOAK_TEST_KEYSTROKES)
+    {
+        running = false;
+        lv_indev_delete(indev);
+        report();
+    }
+    return true;
+}
+#endif
@@ -0,0 +1,247 @@
+#include <Arduino.h>
+#include <atomic>
+#include <esp_timer.h>
+#include <lvgl.h>
+#include "touch_filter.h"
+
+// --- Filter ---
+
+static int32_t median3(int32_t a, int32_t b, int32_t c)
+{
+    return LV_MAX(LV_MIN(a, b), LV_MIN(LV_MAX(a, b), c));
+}
+
+void touch_filter_reset(touch_filter_t *f, int32_t width, int32_t height)
+{
+    memset(f, 0, sizeof(*f));
+    f->width = width;
+    f->height = height;
+}
+
+bool touch_filter_process(touch_filter_t *f, bool pressed, int32_t raw_x, int32_t raw_y, int32_t *x, int32_t *y)
+{
+    f->samples++;
+
+    if (!pressed)
+    {
+        f->press_count = 0;
+        f->jump_count = 0;
+        if (++f->release_count >= TOUCH_FILTER_RELEASE_SAMPLES && f->pressed)
+        {
+            // The next press starts a new median window and low pass
+            f->pressed = false;
+            f->med_count = 0;
+        }
+        else if (!f->pressed)
+        {
+            f->med_count = 0;
+        }
+    }
+    else if (raw_x < 0 || raw_y < 0 || raw_x >= f->width || raw_y >= f->height)
+    {
+        // Off the panel: a misread, neither a press nor a release
+        f->rejected++;
+    }
+    else
+    {
+        int32_t dx = raw_x - f->last_x;
+        int32_t dy = raw_y - f->last_y;
+        bool jump = f->med_count > 0 && dx * dx + dy * dy > TOUCH_FILTER_MAX_JUMP * TOUCH_FILTER_MAX_JUMP;
+        if (jump && ++f->jump_count < TOUCH_FILTER_JUMP_SAMPLES)
+        {
+            f->rejected++;
+        }
+        else
+        {
+            if (jump)
+                f->med_count = 0; // The finger did move that far: restart there
+            f->jump_count = 0;
+            f->release_count = 0;
+            f->last_x = raw_x;
+            f->last_y = raw_y;
+
+            // Median of the last 3 samples (the latest while the window fills)
+            f->med_x[0] = f->med_x[1];
+            f->med_x[1] = f->med_x[2];
+            f->med_x[2] = raw_x;
+            f->med_y[0] = f->med_y[1];
+            f->med_y[1] = f->med_y[2];
+            f->med_y[2] = raw_y;
+            f->med_count = LV_MIN(f->med_count + 1, 3);
+            int32_t mx = f->med_count < 3 ? raw_x : median3(f->med_x[0], f->med_x[1], f->med_x[2]);
+            int32_t my = f->med_count < 3 ? raw_y : median3(f->med_y[0], f->med_y[1], f->med_y[2]);
+
+            // First order low pass in Q4, starting at the first sample
+            if (f->med_count == 1)
+            {
+                f->iir_x = mx << 4;
+                f->iir_y = my << 4;
+            }
+            else
+            {
+                f->iir_x += ((mx << 4) - f->iir_x) * TOUCH_FILTER_IIR_ALPHA / 256;
+                f->iir_y += ((my << 4) - f->iir_y) * TOUCH_FILTER_IIR_ALPHA / 256;
+            }
+
+            if (++f->press_count >= TOUCH_FILTER_PRESS_SAMPLES)
+                f->pressed = true;
+        }
+    }
+
+    *x = (f->iir_x + 8) >> 4;
+    *y = (f->iir_y + 8) >> 4;
+    return f->pressed;
+}
+
+// --- Sample Ring ---
+
+// Raw samples from the sampling timer to the LVGL read callback. One producer and
+// one consumer, each owning one index: no lock between the esp_timer task and LVGL
+typedef struct
+{
+    uint32_t t_ms;
+    int16_t x, y;
+    bool pressed;
+} raw_sample_t;
+
+static raw_sample_t ring[TOUCH_FILTER_RING_SIZE];
+static std::atomic<uint32_t> ring_head(0); // Written by the sampling timer
+static std::atomic<uint32_t> ring_tail(0); // Written by the read callback
+static uint32_t ring_dropped = 0;          // Full ring, LVGL did not read for a while (sampling timer)
+
+static bool ring_push(const raw_sample_t *sample)
+{
+    uint32_t head = ring_head.load(std::memory_order_relaxed);
+    if (head - ring_tail.load(std::memory_order_acquire) >= TOUCH_FILTER_RING_SIZE)
+        return false;
+    ring[head % TOUCH_FILTER_RING_SIZE] = *sample;
+    ring_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+static bool ring_pop(raw_sample_t *sample)
+{
+    uint32_t tail = ring_tail.load(std::memory_order_relaxed);
+    if (tail == ring_head.load(std::memory_order_acquire))
+        return false;
+    *sample = ring[tail % TOUCH_FILTER_RING_SIZE];
+    ring_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// --- Input Device ---
+
+static lv_indev_t *filtered_indev;
+static lv_indev_read_cb_t raw_read_cb;
+static esp_timer_handle_t sample_timer;
+static touch_filter_sample_cb_t sample_cb;
+static touch_filter_t filter;
+static lv_point_t filtered_point;
+static bool filtered_pressed = false;
+
+static uint32_t sample_us_total = 0;
+static uint32_t sample_us_max = 0;
+static uint32_t touch_samples = 0; // Raw samples with a touch
+
+// In the esp_timer task, whatever LVGL is rendering: only the panel is read here.
+// The touch controller is a device of its own on the SPI bus, the driver serializes
+// its transactions with the display's
+static void sample_timer_cb(void *arg)
+{
+    lv_indev_data_t raw = {};
+    raw_read_cb(filtered_indev, &raw);
+    raw_sample_t sample = {(uint32_t)(esp_timer_get_time() / 1000), (int16_t)raw.point.x, (int16_t)raw.point.y,
+                           raw.state == LV_INDEV_STATE_PRESSED};
+    if (!ring_push(&sample))
+        ring_dropped++;
+}
+
+static void filtered_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    // Everything sampled since the last read, in order. A tap shorter than the
+    // read period is still reported once
+    bool press_latched = false;
+    raw_sample_t sample;
+    while (ring_pop(&sample))
+    {
+        if (sample.pressed)
+            touch_samples++;
+        if (sample_cb)
+            sample_cb(sample.t_ms, sample.pressed, sample.x, sample.y);
+
+        int32_t x, y;
+        uint32_t start = micros();
+        bool pressed = touch_filter_process(&filter, sample.pressed, sample.x, sample.y, &x, &y);
+        uint32_t us = micros() - start;
+        sample_us_total += us;
+        sample_us_max = LV_MAX(sample_us_max, us);
+
+        filtered_point.x = x;
+        filtered_point.y = y;
+        if (pressed && !filtered_pressed)
+            press_latched = true;
+        filtered_pressed = pressed;
+    }
+
+    data->point = filtered_point;
+    data->state = filtered_pressed || press_latched ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static void report_timer_cb(lv_timer_t *timer)
+{
+    static uint32_t last_samples = 0;
+    static uint32_t last_rejected = 0;
+    static uint32_t last_touch_samples = 0;
+    static uint32_t last_dropped = 0;
+    if (touch_samples == last_touch_samples)
+        return;
+
+    uint32_t n = filter.samples - last_samples;
+    uint32_t dropped = ring_dropped;
+    log_i("Touch filter: %lu samples (%lu touched), %lu rejected, %lu dropped, %lu ns/sample, max %lu us",
+          (unsigned long)n, (unsigned long)(touch_samples - last_touch_samples), (unsigned long)(filter.rejected - last_rejected),
+          (unsigned long)(dropped - last_dropped), (unsigned long)(n ? (uint64_t)sample_us_total * 1000 / n : 0),
+          (unsigned long)sample_us_max);
+
+    last_samples = filter.samples;
+    last_rejected = filter.rejected;
+    last_touch_samples = touch_samples;
+    last_dropped = dropped;
+    sample_us_total = 0;
+    sample_us_max = 0;
+}
+
+void touch_filter_init(lv_indev_t *indev)
+{
+    raw_read_cb = indev ? lv_indev_get_read_cb(indev) : NULL;
+    if (!raw_read_cb)
+    {
+        log_w("Touch filter: no touch input device");
+        return;
+    }
+
+    lv_display_t *disp = lv_indev_get_display(indev);
+    touch_filter_reset(&filter, lv_display_get_horizontal_resolution(disp), lv_display_get_vertical_resolution(disp));
+    filtered_indev = indev;
+
+    const esp_timer_create_args_t args = {
+        .callback = sample_timer_cb,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "touch_sample",
+        .skip_unhandled_events = true,
+    };
+    if (esp_timer_create(&args, &sample_timer) != ESP_OK ||
+        esp_timer_start_periodic(sample_timer, TOUCH_FILTER_SAMPLE_MS * 1000) != ESP_OK)
+    {
+        log_w("Touch filter: no sampling timer");
+        return;
+    }
+    lv_indev_set_read_cb(indev, filtered_read_cb);
+    lv_timer_create(report_timer_cb, TOUCH_FILTER_REPORT_MS, NULL);
+}
+
+void touch_filter_set_sample_cb(touch_filter_sample_cb_t cb)
+{
+    sample_cb = cb;
+}
@@ -0,0 +1,169 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include <esp_lcd_touch.h>
+#include "touch_rollover.h"
+
+#if TOUCH_ROLLOVER && CONFIG_ESP_LCD_TOUCH_MAX_POINTS < 2
+#error "TOUCH_ROLLOVER needs a touch driver keeping more than one point (CONFIG_ESP_LCD_TOUCH_MAX_POINTS)"
+#endif
+
+typedef struct
+{
+    bool down;
+    bool primary;  // Reported to LVGL as the pointer
+    bool matched;  // Found again in the current read
+    lv_point_t point;
+    lv_obj_t *key; // Non-primary contacts: the key it landed on, NULL when ignored
+} contact_t;
+
+static contact_t contacts[TOUCH_ROLLOVER_MAX_CONTACTS];
+static lv_point_t primary_point; // Kept after the primary lifts, LVGL releases there
+
+static esp_lcd_touch_handle_t touch_handle;
+static touch_rollover_cb_t key_cb;
+static lv_obj_t *keys[TOUCH_ROLLOVER_MAX_KEYS];
+static int key_count = 0;
+
+static lv_obj_t *key_at(const lv_point_t *point)
+{
+    for (int i = 0; i < key_count; i++)
+    {
+        lv_area_t a;
+        lv_obj_get_coords(keys[i], &a);
+        if (lv_area_is_point_on(&a, point, 0))
+            return keys[i];
+    }
+
+    return NULL;
+}
+
+static bool primary_down()
+{
+    for (int i = 0; i < TOUCH_ROLLOVER_MAX_CONTACTS; i++)
+        if (contacts[i].down && contacts[i].primary)
+            return true;
+    return false;
+}
+
+static void track(const lv_point_t *points, int count)
+{
+    // The controller reports no identities and may reorder its points: every
+    // contact continues at the nearest unclaimed point within the match radius
+    bool claimed[TOUCH_ROLLOVER_MAX_CONTACTS] = {};
+    for (int i = 0; i < TOUCH_ROLLOVER_MAX_CONTACTS; i++)
+    {
+        contact_t *c = &contacts[i];
+        c->matched = false;
+        if (!c->down)
+            continue;
+
+        int best = -1;
+        int32_t best_d2 = TOUCH_ROLLOVER_MATCH_RADIUS * TOUCH_ROLLOVER_MATCH_RADIUS + 1;
+        for (int j = 0; j < count; j++)
+        {
+            int32_t dx = points[j].x - c->point.x;
+            int32_t dy = points[j].y - c->point.y;
+            if (!claimed[j] && dx * dx + dy * dy < best_d2)
+            {
+                best = j;
+                best_d2 = dx * dx + dy * dy;
+            }
+        }
+
+        if (best < 0)
+            continue;
+        claimed[best] = true;
+        c->matched = true;
+        c->point = points[best];
+        if (c->primary)
+            primary_point = c->point;
+        else if (c->key)
+            key_cb(c->key, &c->point, TOUCH_ROLLOVER_MOVED);
+    }
+
+    // Lifted fingers; the primary is released by LVGL in this read
+    bool had_primary = primary_down();
+    for (int i = 0; i < TOUCH_ROLLOVER_MAX_CONTACTS; i++)
+    {
+        contact_t *c = &contacts[i];
+        if (!c->down || c->matched)
+            continue;
+
+        c->down = false;
+        if (!c->primary && c->key)
+            key_cb(c->key, &c->point, TOUCH_ROLLOVER_RELEASED);
+    }
+
+    // New fingers. One only becomes the primary when LVGL saw no contact before this
+    // read, otherwise the pointer would jump without a release
+    for (int j = 0; j < count; j++)
+    {
+        if (claimed[j])
+            continue;
+
+        contact_t *c = NULL;
+        for (int i = 0; i < TOUCH_ROLLOVER_MAX_CONTACTS && !c; i++)
+            if (!contacts[i].down)
+                c = &contacts[i];
+        if (!c)
+            break;
+
+        c->primary = !had_primary && !primary_down(); // Before c is down, with the flag of its last finger
+        c->down = true;
+        c->point = points[j];
+        c->key = NULL;
+        if (c->primary)
+        {
+            primary_point = c->point;
+            continue;
+        }
+
+        c->key = key_at(&c->point);
+        if (c->key)
+            key_cb(c->key, &c->point, TOUCH_ROLLOVER_PRESSED);
+    }
+}
+
+static void rollover_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    lv_point_t points[TOUCH_ROLLOVER_MAX_CONTACTS];
+    int count = 0;
+    if (esp_lcd_touch_read_data(touch_handle) == ESP_OK)
+    {
+        uint16_t x[TOUCH_ROLLOVER_MAX_CONTACTS], y[TOUCH_ROLLOVER_MAX_CONTACTS], strength[TOUCH_ROLLOVER_MAX_CONTACTS];
+        uint8_t n = 0;
+        esp_lcd_touch_get_coordinates(touch_handle, x, y, strength, &n, TOUCH_ROLLOVER_MAX_CONTACTS);
+        for (count = 0; count < n; count++)
+        {
+            points[count].x = x[count];
+            points[count].y = y[count];
+        }
+    }
+
+    track(points, count);
+
+    data->point = primary_point;
+    data->state = primary_down() ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+bool touch_rollover_init(lv_indev_t *indev, touch_rollover_cb_t cb)
+{
+    // esp32-smartdisplay keeps the esp_lcd_touch handle in the user data of its indev
+    esp_lcd_touch_handle_t handle = indev ? (esp_lcd_touch_handle_t)lv_indev_get_user_data(indev) : NULL;
+    if (!handle)
+    {
+        log_w("Touch rollover: no touch controller, single pointer only");
+        return false;
+    }
+
+    touch_handle = handle;
+    key_cb = cb;
+    lv_indev_set_read_cb(indev, rollover_read_cb);
+    return true;
+}
+
+void touch_rollover_add_key(lv_obj_t *key)
+{
+    if (key_count < TOUCH_ROLLOVER_MAX_KEYS)
+        keys[key_count++] = key;
+}
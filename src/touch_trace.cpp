@@ -0,0 +1,480 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <lvgl.h>
+#include "touch_filter.h"
+#include "touch_trace.h"
+
+// Record flags; a keyframe carries the absolute time (u32) and point (2 x i16),
+// other records the varint milliseconds since the previous record and, if moved,
+// the zigzag varint dx and dy
+#define RECORD_PRESSED 0x01
+#define RECORD_MOVED 0x02
+#define RECORD_KEYFRAME 0x80
+#define RECORD_MAX_BYTES 16
+
+#define FILE_MAGIC "TTRC"
+#define FILE_VERSION 2          // Raw samples, filtered in a replay
+#define FILE_VERSION_FILTERED 1 // Samples as LVGL read them
+
+typedef struct
+{
+    uint32_t t_ms;
+    lv_point_t point;
+    bool pressed;
+} sample_t;
+
+static uint8_t slots[TOUCH_TRACE_SLOTS][TOUCH_TRACE_SLOT_SIZE];
+static int first_slot = 0; // Oldest
+static int slot_count = 0;
+static uint32_t sample_count = 0;
+static bool ring_filtered = false; // Loaded from a trace of filtered samples
+
+// Recorder
+static lv_indev_read_cb_t raw_read_cb;
+static bool recording = false;
+static sample_t last; // Last recorded sample, the base of the deltas
+#if TOUCH_FILTER
+static uint8_t released_run = TOUCH_FILTER_RELEASE_SAMPLES; // Released samples recorded in a row
+#endif
+
+// Replay
+static sample_t replay_sample;
+
+// --- Encoding ---
+
+static uint8_t *put_varint(uint8_t *p, uint32_t v)
+{
+    while (v >= 0x80)
+    {
+        *p++ = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+static const uint8_t *get_varint(const uint8_t *p, const uint8_t *end, uint32_t *v)
+{
+    *v = 0;
+    for (int shift = 0; p < end && shift < 35; shift += 7)
+    {
+        uint8_t b = *p++;
+        *v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+            return p;
+    }
+    return NULL;
+}
+
+static uint32_t zigzag(int32_t v) { return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+static int32_t unzigzag(uint32_t v) { return (int32_t)(v >> 1) ^ -(int32_t)(v & 1); }
+
+static uint8_t *put_keyframe(uint8_t *p, const sample_t *s)
+{
+    *p++ = RECORD_KEYFRAME | (s->pressed ? RECORD_PRESSED : 0);
+    memcpy(p, &s->t_ms, 4);
+    int16_t xy[2] = {(int16_t)s->point.x, (int16_t)s->point.y};
+    memcpy(p + 4, xy, 4);
+    return p + 8;
+}
+
+static uint8_t *put_delta(uint8_t *p, const sample_t *s, const sample_t *prev)
+{
+    bool moved = s->point.x != prev->point.x || s->point.y != prev->point.y;
+    *p++ = (moved ? RECORD_MOVED : 0) | (s->pressed ? RECORD_PRESSED : 0);
+    p = put_varint(p, s->t_ms - prev->t_ms);
+    if (moved)
+    {
+        p = put_varint(p, zigzag(s->point.x - prev->point.x));
+        p = put_varint(p, zigzag(s->point.y - prev->point.y));
+    }
+    return p;
+}
+
+// Decode the record at p into s (the previous sample on input); NULL when malformed
+static const uint8_t *get_record(const uint8_t *p, const uint8_t *end, sample_t *s)
+{
+    uint8_t flags = *p++;
+    s->pressed = flags & RECORD_PRESSED;
+    if (flags & RECORD_KEYFRAME)
+    {
+        if (end - p < 8)
+            return NULL;
+        int16_t xy[2];
+        memcpy(&s->t_ms, p, 4);
+        memcpy(xy, p + 4, 4);
+        s->point.x = xy[0];
+        s->point.y = xy[1];
+        return p + 8;
+    }
+
+    uint32_t dt, dx, dy;
+    if (!(p = get_varint(p, end, &dt)))
+        return NULL;
+    s->t_ms += dt;
+    if (flags & RECORD_MOVED)
+    {
+        if (!(p = get_varint(p, end, &dx)) || !(p = get_varint(p, end, &dy)))
+            return NULL;
+        s->point.x += unzigzag(dx);
+        s->point.y += unzigzag(dy);
+    }
+    return p;
+}
+
+// --- Ring ---
+
+static uint8_t *slot_at(int i)
+{
+    return slots[(first_slot + i) % TOUCH_TRACE_SLOTS];
+}
+
+static void record(const sample_t *s)
+{
+    uint8_t buf[RECORD_MAX_BYTES];
+    uint8_t *slot = slot_count ? slot_at(slot_count - 1) : NULL;
+    uint32_t len = put_delta(buf, s, &last) - buf;
+    if (!slot || slot[0] + len > TOUCH_TRACE_SLOT_SIZE)
+    {
+        // New slot, dropping the oldest when the ring is full
+        if (slot_count == TOUCH_TRACE_SLOTS)
+            first_slot = (first_slot + 1) % TOUCH_TRACE_SLOTS;
+        else
+            slot_count++;
+        slot = slot_at(slot_count - 1);
+        slot[0] = 1;
+        len = put_keyframe(buf, s) - buf;
+    }
+
+    memcpy(slot + slot[0], buf, len);
+    slot[0] += len;
+    last = *s;
+    sample_count++;
+}
+
+#if !TOUCH_FILTER
+static void trace_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    raw_read_cb(indev, data);
+    if (!recording)
+        return;
+
+    // Only changes are kept: a press, a release and the moves in between
+    sample_t s = {millis(), data->point, data->state == LV_INDEV_STATE_PRESSED};
+    if (s.pressed != last.pressed || (s.pressed && (s.point.x != last.point.x || s.point.y != last.point.y)))
+        record(&s);
+}
+#else
+// Every raw sample of a touch, and the released ones until the filter's release
+// debounce: past that, more of them leave the filter as it is
+static void raw_sample_cb(uint32_t t_ms, bool pressed, int32_t x, int32_t y)
+{
+    if (!recording || (!pressed && released_run >= TOUCH_FILTER_RELEASE_SAMPLES))
+        return;
+
+    released_run = pressed ? 0 : released_run + 1;
+    // A released sample has no point, the last one costs nothing
+    sample_t s = {t_ms, pressed ? lv_point_t{x, y} : last.point, pressed};
+    record(&s);
+}
+#endif
+
+void touch_trace_init(lv_indev_t *indev)
+{
+    raw_read_cb = indev ? lv_indev_get_read_cb(indev) : NULL;
+    if (!raw_read_cb)
+    {
+        log_w("Touch trace: no touch input device");
+        return;
+    }
+
+#if TOUCH_FILTER
+    // The samples before the filter
+    touch_filter_set_sample_cb(raw_sample_cb);
+#else
+    lv_indev_set_read_cb(indev, trace_read_cb);
+#endif
+    recording = true;
+    log_i("Touch trace: recording into %d bytes of RAM", TOUCH_TRACE_SLOTS * TOUCH_TRACE_SLOT_SIZE);
+}
+
+void touch_trace_clear()
+{
+    first_slot = 0;
+    slot_count = 0;
+    sample_count = 0;
+    ring_filtered = false;
+    memset(&last, 0, sizeof(last));
+#if TOUCH_FILTER
+    released_run = TOUCH_FILTER_RELEASE_SAMPLES;
+#endif
+}
+
+// --- Replay ---
+
+bool touch_trace_decode(int32_t width, int32_t height, touch_trace_sample_cb_t cb, void *user_data)
+{
+#if TOUCH_FILTER
+    // A fresh filter, as at boot
+    static touch_filter_t filter;
+    touch_filter_reset(&filter, width, height);
+#endif
+    sample_t s = {};
+    for (int i = 0; i < slot_count; i++)
+    {
+        const uint8_t *slot = slot_at(i);
+        const uint8_t *end = slot + slot[0];
+        for (const uint8_t *p = slot + 1; p < end;)
+        {
+            if (!(p = get_record(p, end, &s)))
+                return false;
+
+            lv_indev_data_t data = {};
+            data.point = s.point;
+            data.state = s.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+#if TOUCH_FILTER
+            if (!ring_filtered)
+            {
+                int32_t x, y;
+                bool pressed = touch_filter_process(&filter, s.pressed, s.point.x, s.point.y, &x, &y);
+                data.point.x = x;
+                data.point.y = y;
+                data.state = pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+            }
+#endif
+            cb(s.t_ms, &data, user_data);
+        }
+    }
+    return true;
+}
+
+static void replay_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    data->point = replay_sample.point;
+    data->state = replay_sample.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+typedef struct
+{
+    lv_indev_t *indev;
+    uint32_t samples;
+    uint32_t first_ms, last_ms;
+} replay_t;
+
+static void replay_sample_cb(uint32_t t_ms, const lv_indev_data_t *data, void *user_data)
+{
+    replay_t *replay = (replay_t *)user_data;
+    if (replay->samples == 0)
+        replay->first_ms = replay->last_ms = t_ms;
+
+    // Virtual clock: timers and refreshes due before the sample run first
+    lv_tick_inc(t_ms - replay->last_ms);
+    lv_timer_handler();
+    replay_sample.t_ms = t_ms;
+    replay_sample.point = data->point;
+    replay_sample.pressed = data->state == LV_INDEV_STATE_PRESSED;
+    lv_indev_read(replay->indev);
+    replay->samples++;
+    replay->last_ms = t_ms;
+}
+
+uint32_t touch_trace_replay(lv_display_t *disp)
+{
+    if (!slot_count)
+    {
+        log_w("Touch trace: nothing to replay");
+        return 0;
+    }
+
+    // Only the trace touches the screen meanwhile
+    bool was_recording = recording;
+    recording = false;
+    lv_indev_t *indevs[4];
+    int indev_count = 0;
+    for (lv_indev_t *i = lv_indev_get_next(NULL); i && indev_count < 4; i = lv_indev_get_next(i))
+    {
+        lv_indev_enable(i, false);
+        indevs[indev_count++] = i;
+    }
+
+    // Read only when a sample is due, not by LVGL's read timer
+    replay_t replay = {};
+    replay.indev = lv_indev_create();
+    lv_indev_set_type(replay.indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_mode(replay.indev, LV_INDEV_MODE_EVENT);
+    lv_indev_set_read_cb(replay.indev, replay_read_cb);
+    lv_indev_set_display(replay.indev, disp);
+
+    uint32_t start = micros();
+    bool ok = touch_trace_decode(lv_display_get_horizontal_resolution(disp), lv_display_get_vertical_resolution(disp),
+                                 replay_sample_cb, &replay);
+
+    // End released, let the key timers and the last frame run
+    replay_sample.pressed = false;
+    lv_indev_read(replay.indev);
+    for (int i = 0; i < 10; i++)
+    {
+        lv_tick_inc(LV_DEF_REFR_PERIOD);
+        lv_timer_handler();
+    }
+    uint32_t wall_ms = (micros() - start) / 1000;
+
+    lv_indev_delete(replay.indev);
+    for (int i = 0; i < indev_count; i++)
+        lv_indev_enable(indevs[i], true);
+    recording = was_recording;
+
+    uint32_t trace_ms = replay.last_ms - replay.first_ms;
+    if (!ok)
+        log_e("Touch trace: malformed record after %lu samples", (unsigned long)replay.samples);
+    log_i("Touch trace replay: %lu samples, %lu ms of input replayed in %lu ms (x%lu)",
+          (unsigned long)replay.samples, (unsigned long)trace_ms, (unsigned long)wall_ms,
+          (unsigned long)(wall_ms ? trace_ms / wall_ms : 0));
+    return replay.samples;
+}
+
+// --- Storage ---
+
+static void log_size()
+{
+    uint32_t bytes = 0;
+    for (int i = 0; i < slot_count; i++)
+        bytes += slot_at(i)[0] - 1;
+    log_i("Touch trace: %lu samples in %lu bytes (%lu.%02lu bytes/sample), %d of %d slots",
+          (unsigned long)sample_count, (unsigned long)bytes,
+          (unsigned long)(sample_count ? bytes / sample_count : 0),
+          (unsigned long)(sample_count ? bytes * 100 / sample_count % 100 : 0), slot_count, TOUCH_TRACE_SLOTS);
+}
+
+bool touch_trace_save(const char *path)
+{
+    if (!LittleFS.begin(true))
+    {
+        log_e("Touch trace: no LittleFS partition");
+        return false;
+    }
+
+    File file = LittleFS.open(path, "w");
+    if (!file)
+    {
+        log_e("Touch trace: cannot write %s", path);
+        return false;
+    }
+
+    uint8_t header[8] = {FILE_MAGIC[0], FILE_MAGIC[1], FILE_MAGIC[2], FILE_MAGIC[3],
+                         (uint8_t)(ring_filtered ? FILE_VERSION_FILTERED : FILE_VERSION), TOUCH_TRACE_SLOT_SIZE};
+    uint16_t count = slot_count;
+    memcpy(header + 6, &count, 2);
+    bool ok = file.write(header, sizeof(header)) == sizeof(header);
+    for (int i = 0; i < slot_count && ok; i++)
+        ok = file.write(slot_at(i), TOUCH_TRACE_SLOT_SIZE) == TOUCH_TRACE_SLOT_SIZE;
+    file.close();
+
+    if (!ok)
+        log_e("Touch trace: writing %s failed", path);
+    else
+        log_size();
+    return ok;
+}
+
+bool touch_trace_load(const char *path)
+{
+    if (!LittleFS.begin(true))
+    {
+        log_e("Touch trace: no LittleFS partition");
+        return false;
+    }
+
+    File file = LittleFS.open(path, "r");
+    uint8_t header[8];
+    if (!file || file.read(header, sizeof(header)) != sizeof(header) || memcmp(header, FILE_MAGIC, 4) ||
+        (header[4] != FILE_VERSION && header[4] != FILE_VERSION_FILTERED) || header[5] != TOUCH_TRACE_SLOT_SIZE)
+    {
+        log_e("Touch trace: %s is not a trace", path);
+        return false;
+    }
+
+    uint16_t count;
+    memcpy(&count, header + 6, 2);
+    touch_trace_clear();
+    // A longer trace keeps its last slots, as the ring would
+    for (int i = 0; i < count; i++)
+    {
+        uint8_t *slot = slots[i % TOUCH_TRACE_SLOTS];
+        if (file.read(slot, TOUCH_TRACE_SLOT_SIZE) != TOUCH_TRACE_SLOT_SIZE || slot[0] < 1 ||
+            slot[0] > TOUCH_TRACE_SLOT_SIZE)
+        {
+            log_e("Touch trace: %s is truncated or damaged", path);
+            touch_trace_clear();
+            return false;
+        }
+    }
+    file.close();
+    slot_count = LV_MIN(count, TOUCH_TRACE_SLOTS);
+    first_slot = count > TOUCH_TRACE_SLOTS ? count % TOUCH_TRACE_SLOTS : 0;
+    ring_filtered = header[4] == FILE_VERSION_FILTERED;
+
+    // Every record decodes, counted. Recording goes on after the loaded samples: the
+    // next delta is from the last one
+    for (int i = 0; i < slot_count; i++)
+    {
+        const uint8_t *slot = slot_at(i);
+        const uint8_t *end = slot + slot[0];
+        for (const uint8_t *p = slot + 1; p < end; sample_count++)
+        {
+            if (!(p = get_record(p, end, &last)))
+            {
+                log_e("Touch trace: %s has a malformed record in slot %d", path, i);
+                touch_trace_clear();
+                return false;
+            }
+        }
+    }
+#if TOUCH_FILTER
+    released_run = last.pressed ? 0 : TOUCH_FILTER_RELEASE_SAMPLES;
+#endif
+    log_size();
+    return true;
+}
+
+void touch_trace_dump()
+{
+    // Lines of "TT <slot> <hex>", reassembled on the host
+    log_size();
+    for (int i = 0; i < slot_count; i++)
+    {
+        const uint8_t *slot = slot_at(i);
+        Serial.printf("TT %d ", i);
+        for (int j = 0; j < slot[0]; j++)
+            Serial.printf("%02x", slot[j]);
+        Serial.println();
+    }
+}
+
+void touch_trace_poll_serial(lv_display_t *disp)
+{
+    if (!Serial.available())
+        return;
+
+    switch (Serial.read())
+    {
+    case 'r':
+        touch_trace_replay(disp);
+        break;
+    case 's':
+        touch_trace_save(TOUCH_TRACE_PATH);
+        break;
+    case 'l':
+        if (touch_trace_load(TOUCH_TRACE_PATH))
+            touch_trace_replay(disp);
+        break;
+    case 'd':
+        touch_trace_dump();
+        break;
+    case 'c':
+        touch_trace_clear();
+        break;
+    default:
+        break;
+    }
+}
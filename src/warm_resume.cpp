@@ -0,0 +1,113 @@
+#include <Arduino.h>
+#include <esp_rom_crc.h>
+#include <esp_sleep.h>
+#include <esp_system.h>
+#include "warm_resume.h"
+
+#define SNAPSHOT_MAGIC 0x31524d57 // "WMR1"
+#define DOCUMENT_NONE 0xFFFF
+
+// Followed by the input and the document, each NUL terminated
+typedef struct __attribute__((packed))
+{
+    uint32_t magic;
+    uint16_t len; // Payload bytes
+    uint8_t layer;
+    uint8_t input_len;
+    uint16_t document_len; // DOCUMENT_NONE: not stored
+    uint32_t crc;          // Of the header up to here and the payload
+} snapshot_header_t;
+
+// --- Encoding ---
+
+static uint32_t snapshot_crc(const snapshot_header_t *header, const uint8_t *payload)
+{
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t *)header, offsetof(snapshot_header_t, crc));
+    return esp_rom_crc32_le(crc, payload, header->len);
+}
+
+uint32_t ui_snapshot_encode(const ui_state_t *state, uint8_t *buf, uint32_t size)
+{
+    size_t input_len = strlen(state->input);
+    size_t document_len = state->document ? strlen(state->document) : 0;
+    uint32_t input_size = sizeof(snapshot_header_t) + input_len + 1;
+    if (input_len > UINT8_MAX || input_size + 1 > size)
+        return 0;
+
+    snapshot_header_t header = {};
+    header.magic = SNAPSHOT_MAGIC;
+    header.layer = state->layer;
+    header.input_len = input_len;
+    uint8_t *payload = buf + sizeof(header);
+    memcpy(payload, state->input, input_len + 1);
+    if (state->document && document_len < DOCUMENT_NONE && input_size + document_len + 1 <= size)
+    {
+        header.document_len = document_len;
+        memcpy(payload + input_len + 1, state->document, document_len + 1);
+    }
+    else
+    {
+        // The journal has it
+        header.document_len = DOCUMENT_NONE;
+        payload[input_len + 1] = '\0';
+        document_len = 0;
+    }
+    header.len = input_len + 1 + document_len + 1;
+    header.crc = snapshot_crc(&header, payload);
+    memcpy(buf, &header, sizeof(header));
+    return sizeof(header) + header.len;
+}
+
+bool ui_snapshot_decode(const uint8_t *buf, uint32_t size, ui_state_t *state)
+{
+    snapshot_header_t header;
+    if (size < sizeof(header))
+        return false;
+    memcpy(&header, buf, sizeof(header));
+    const uint8_t *payload = buf + sizeof(header);
+    uint32_t document_size = header.document_len == DOCUMENT_NONE ? 1 : header.document_len + 1;
+    if (header.magic != SNAPSHOT_MAGIC || header.len > size - sizeof(header) ||
+        header.len != header.input_len + 1 + document_size || snapshot_crc(&header, payload) != header.crc)
+        return false;
+    if (payload[header.input_len] != '\0' || payload[header.len - 1] != '\0')
+        return false;
+
+    state->layer = header.layer;
+    state->input = (const char *)payload;
+    state->document = header.document_len == DOCUMENT_NONE ? NULL : (const char *)payload + header.input_len + 1;
+    return true;
+}
+
+// --- Deep Sleep ---
+
+// Not cleared by the startup code, kept powered in deep sleep
+RTC_NOINIT_ATTR static uint8_t rtc_snapshot[WARM_RESUME_SNAPSHOT_SIZE];
+
+bool warm_resume_get(ui_state_t *state)
+{
+    // After a power on, RTC memory holds garbage (that might even pass the checks)
+    if (esp_reset_reason() != ESP_RST_DEEPSLEEP)
+        return false;
+    if (!ui_snapshot_decode(rtc_snapshot, sizeof(rtc_snapshot), state))
+    {
+        log_w("Warm resume: no valid snapshot, cold boot");
+        return false;
+    }
+    log_i("Warm resume: layer %d, %u input bytes, document %s", state->layer, (unsigned)strlen(state->input),
+          state->document ? "in the snapshot" : "from the journal");
+    return true;
+}
+
+void warm_resume_sleep(const ui_state_t *state)
+{
+    uint32_t start = micros();
+    uint32_t size = ui_snapshot_encode(state, rtc_snapshot, sizeof(rtc_snapshot));
+    if (size == 0)
+        memset(rtc_snapshot, 0, sizeof(snapshot_header_t));
+    log_i("Warm resume: %lu byte snapshot in %lu us, deep sleep until the BOOT button",
+          (unsigned long)size, (unsigned long)(micros() - start));
+    Serial.flush();
+
+    esp_sleep_enable_ext0_wakeup(WARM_RESUME_WAKE_GPIO, 0);
+    esp_deep_sleep_start();
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+// Host stand-in for the Arduino core: the time base, the log macros, the heap and
+// a serial port that prints to stdout and never receives anything
+
+#include <esp_heap_caps.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static inline uint32_t micros()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static inline uint32_t millis()
+{
+    return micros() / 1000;
+}
+
+// RTC memory is plain RAM on the host
+#define RTC_NOINIT_ATTR
+
+#define log_e(format, ...) printf("[E] " format "\n", ##__VA_ARGS__)
+#define log_w(format, ...) printf("[W] " format "\n", ##__VA_ARGS__)
+#define log_i(format, ...) printf("[I] " format "\n", ##__VA_ARGS__)
+#define log_d(format, ...) \
+    do                     \
+    {                      \
+    } while (0)
+
+#ifdef __cplusplus
+class HostSerial
+{
+public:
+    int available() { return 0; }
+    int read() { return -1; }
+    void flush() { fflush(stdout); }
+    void println() { putchar('\n'); }
+    void println(const char *s) { puts(s); }
+
+    void printf(const char *format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        vprintf(format, args);
+        va_end(args);
+    }
+};
+
+inline HostSerial Serial;
+#endif
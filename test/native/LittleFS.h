@@ -0,0 +1,91 @@
+#pragma once
+
+// Host stand-in for the Arduino LittleFS: the files of a fresh temporary directory,
+// created by the first begin(). littlefs_host_path() gives the host path of a file
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+
+class File
+{
+public:
+    File(FILE *f = NULL) : f(f) {}
+    explicit operator bool() const { return f != NULL; }
+
+    size_t read(uint8_t *buf, size_t size) { return f ? fread(buf, 1, size, f) : 0; }
+    size_t write(const uint8_t *buf, size_t size) { return f ? fwrite(buf, 1, size, f) : 0; }
+    bool seek(uint32_t pos) { return f && fseek(f, pos, SEEK_SET) == 0; }
+    size_t position() const { return f ? ftell(f) : 0; }
+
+    size_t size() const
+    {
+        if (!f)
+            return 0;
+        long pos = ftell(f);
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, pos, SEEK_SET);
+        return size;
+    }
+
+    void flush()
+    {
+        if (f)
+            fflush(f);
+    }
+
+    void close()
+    {
+        if (f)
+            fclose(f);
+        f = NULL;
+    }
+
+private:
+    FILE *f;
+};
+
+class LittleFSHost
+{
+public:
+    bool begin(bool format_on_fail = false)
+    {
+        if (root.empty())
+        {
+            char dir[] = "/tmp/littlefs-XXXXXX";
+            if (!mkdtemp(dir))
+                return false;
+            root = dir;
+        }
+        return true;
+    }
+
+    std::string path(const char *path) const { return root + path; }
+
+    // "r", "w" and "a" as the Arduino core; files are binary
+    File open(const char *path, const char *mode = "r")
+    {
+        if (root.empty())
+            return File();
+        std::string m = std::string(mode) + "b";
+        return File(fopen(this->path(path).c_str(), m.c_str()));
+    }
+
+    bool exists(const char *path) { return !root.empty() && access(this->path(path).c_str(), F_OK) == 0; }
+    bool remove(const char *path) { return !root.empty() && ::remove(this->path(path).c_str()) == 0; }
+    bool rename(const char *from, const char *to) { return !root.empty() && ::rename(path(from).c_str(), path(to).c_str()) == 0; }
+
+private:
+    std::string root;
+};
+
+inline LittleFSHost LittleFS;
+
+static inline std::string littlefs_host_path(const char *path)
+{
+    return LittleFS.path(path);
+}
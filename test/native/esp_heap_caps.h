@@ -0,0 +1,38 @@
+#pragma once
+
+// Host stand-in for the capability aware heap of ESP-IDF: one heap that has
+// every capability. Tests in C++ make it fail from the N-th allocation on
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+#ifdef __cplusplus
+inline int32_t heap_caps_fail_after = -1; // Allocations that still succeed, < 0: all of them
+#define HEAP_CAPS_HOST_FAILS() (heap_caps_fail_after == 0 || (heap_caps_fail_after > 0 && !--heap_caps_fail_after))
+#else
+#define HEAP_CAPS_HOST_FAILS() 0
+#endif
+
+static inline void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return HEAP_CAPS_HOST_FAILS() ? NULL : malloc(size);
+}
+
+static inline void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return HEAP_CAPS_HOST_FAILS() ? NULL : realloc(ptr, size);
+}
+
+static inline void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+// Host stand-in for the touch controller driver: a controller reports the points a
+// test puts in it, up to CONFIG_ESP_LCD_TOUCH_MAX_POINTS, on every read
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK 0
+#endif
+
+#ifndef CONFIG_ESP_LCD_TOUCH_MAX_POINTS
+#define CONFIG_ESP_LCD_TOUCH_MAX_POINTS 1
+#endif
+
+typedef struct esp_lcd_touch_s
+{
+    uint8_t count;
+    uint16_t x[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+    uint16_t y[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+} esp_lcd_touch_t;
+
+typedef esp_lcd_touch_t *esp_lcd_touch_handle_t;
+
+static inline esp_err_t esp_lcd_touch_read_data(esp_lcd_touch_handle_t tp)
+{
+    return ESP_OK;
+}
+
+static inline bool esp_lcd_touch_get_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength,
+                                                 uint8_t *point_num, uint8_t max_point_num)
+{
+    *point_num = tp->count < max_point_num ? tp->count : max_point_num;
+    for (uint8_t i = 0; i < *point_num; i++)
+    {
+        x[i] = tp->x[i];
+        y[i] = tp->y[i];
+        if (strength)
+            strength[i] = 1;
+    }
+    return *point_num > 0;
+}
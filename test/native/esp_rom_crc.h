@@ -0,0 +1,19 @@
+#pragma once
+
+// Host stand-in for the CRC routines of the ESP32 ROM: the reflected CRC-32
+// (polynomial 0xEDB88320), as zlib's crc32()
+
+#include <stddef.h>
+#include <stdint.h>
+
+static inline uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+    crc = ~crc;
+    while (len--)
+    {
+        crc ^= *buf++;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
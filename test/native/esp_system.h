@@ -0,0 +1,26 @@
+#pragma once
+
+// Host stand-in for the reset reason of ESP-IDF: a power on, unless a test says
+// otherwise through esp_reset_reason_host
+
+typedef enum
+{
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO,
+} esp_reset_reason_t;
+
+inline esp_reset_reason_t esp_reset_reason_host = ESP_RST_POWERON;
+
+static inline esp_reset_reason_t esp_reset_reason(void)
+{
+    return esp_reset_reason_host;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+// Host stand-in for the ESP-IDF high resolution timer: periodic timers do not run
+// by themselves, a test fires them with esp_timer_host_fire where one period passed
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef struct esp_timer *esp_timer_handle_t;
+typedef void (*esp_timer_cb_t)(void *arg);
+
+typedef enum
+{
+    ESP_TIMER_TASK,
+} esp_timer_dispatch_t;
+
+typedef struct
+{
+    esp_timer_cb_t callback;
+    void *arg;
+    esp_timer_dispatch_t dispatch_method;
+    const char *name;
+    bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+static inline int64_t esp_timer_get_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#define ESP_TIMER_HOST_TIMERS 8
+
+struct esp_timer
+{
+    esp_timer_cb_t callback;
+    void *arg;
+    bool running;
+};
+
+// One set of timers for the program; in C, one per source file
+#ifdef __cplusplus
+#define ESP_TIMER_HOST_STORAGE inline
+#else
+#define ESP_TIMER_HOST_STORAGE static
+#endif
+ESP_TIMER_HOST_STORAGE struct esp_timer esp_timer_host_timers[ESP_TIMER_HOST_TIMERS];
+ESP_TIMER_HOST_STORAGE int esp_timer_host_count;
+
+static inline esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *timer)
+{
+    if (esp_timer_host_count == ESP_TIMER_HOST_TIMERS)
+        return ESP_FAIL;
+    *timer = &esp_timer_host_timers[esp_timer_host_count++];
+    (*timer)->callback = args->callback;
+    (*timer)->arg = args->arg;
+    (*timer)->running = false;
+    return ESP_OK;
+}
+
+static inline esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us)
+{
+    timer->running = true;
+    return ESP_OK;
+}
+
+// One period of every started timer
+static inline void esp_timer_host_fire(void)
+{
+    for (int i = 0; i < esp_timer_host_count; i++)
+        if (esp_timer_host_timers[i].running)
+            esp_timer_host_timers[i].callback(esp_timer_host_timers[i].arg);
+}
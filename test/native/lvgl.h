@@ -0,0 +1,323 @@
+#pragma once
+
+// Host stand-in for the few LVGL declarations the natively tested sources use.
+// There is no display: the functions that would need one report none, and a test
+// fills the invalidated areas of src/display/lv_display_private.h itself. An input
+// device only holds its read callback, which lv_indev_read calls, and its user data
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#define LV_DEF_REFR_PERIOD 33
+
+#define LV_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define LV_MAX(a, b) ((a) > (b) ? (a) : (b))
+
+typedef enum
+{
+    LV_RESULT_INVALID = 0,
+    LV_RESULT_OK,
+} lv_result_t;
+
+typedef struct
+{
+    int32_t x, y;
+} lv_point_t;
+
+typedef struct
+{
+    int32_t x1, y1, x2, y2;
+} lv_area_t;
+
+typedef struct _lv_obj_t lv_obj_t;
+typedef struct _lv_display_t lv_display_t;
+typedef struct _lv_indev_t lv_indev_t;
+typedef struct _lv_timer_t lv_timer_t;
+typedef void (*lv_timer_cb_t)(lv_timer_t *timer);
+
+typedef enum
+{
+    LV_INDEV_STATE_RELEASED = 0,
+    LV_INDEV_STATE_PRESSED,
+} lv_indev_state_t;
+
+typedef struct
+{
+    lv_point_t point;
+    uint32_t key;
+    uint32_t btn_id;
+    int16_t enc_diff;
+    lv_indev_state_t state;
+    bool continue_reading;
+} lv_indev_data_t;
+
+typedef void (*lv_indev_read_cb_t)(lv_indev_t *indev, lv_indev_data_t *data);
+
+struct _lv_indev_t
+{
+    lv_indev_read_cb_t read_cb;
+    void *user_data;
+};
+
+// An object is only where it is: tests place them by their coordinates
+struct _lv_obj_t
+{
+    lv_area_t coords;
+};
+
+typedef enum
+{
+    LV_EVENT_ALL = 0,
+    LV_EVENT_REFR_START = 43,
+    LV_EVENT_REFR_READY,
+    LV_EVENT_RENDER_START = 45,
+    LV_EVENT_RENDER_READY,
+} lv_event_code_t;
+
+// Built by the tests themselves, as no display sends events
+typedef struct _lv_event_t
+{
+    lv_event_code_t code;
+    void *param;
+    void *user_data;
+    void *target;
+} lv_event_t;
+
+typedef void (*lv_event_cb_t)(lv_event_t *e);
+
+typedef enum
+{
+    LV_COLOR_FORMAT_UNKNOWN = 0,
+    LV_COLOR_FORMAT_A8 = 0x0E,
+} lv_color_format_t;
+
+#define LV_IMAGE_HEADER_MAGIC 0x19
+
+typedef struct
+{
+    uint32_t magic : 8;
+    uint32_t cf : 8;
+    uint32_t flags : 16;
+    uint32_t w : 16;
+    uint32_t h : 16;
+    uint32_t stride : 16;
+    uint32_t reserved_2 : 16;
+} lv_image_header_t;
+
+typedef struct
+{
+    lv_image_header_t header;
+    uint32_t data_size;
+    const uint8_t *data;
+} lv_image_dsc_t;
+
+typedef struct _lv_font_t lv_font_t;
+
+typedef struct
+{
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint8_t bpp;
+    const lv_font_t *resolved_font;
+} lv_font_glyph_dsc_t;
+
+struct _lv_font_t
+{
+    bool (*get_glyph_dsc)(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter, uint32_t letter_next);
+    int32_t line_height;
+    int32_t base_line;
+    const lv_font_t *fallback;
+    void *user_data;
+};
+
+typedef const void *(*lv_imgfont_get_path_cb_t)(const lv_font_t *font, uint32_t unicode, uint32_t unicode_next,
+                                                int32_t *offset_y, void *user_data);
+
+typedef void *lv_mem_pool_t;
+
+typedef struct
+{
+    size_t total_size;
+    size_t free_cnt;
+    size_t free_size;
+    size_t free_biggest_size;
+    size_t used_cnt;
+    size_t max_used;
+    uint8_t used_pct;
+    uint8_t frag_pct;
+} lv_mem_monitor_t;
+
+typedef enum
+{
+    LV_INDEV_TYPE_NONE,
+    LV_INDEV_TYPE_POINTER,
+} lv_indev_type_t;
+
+typedef enum
+{
+    LV_INDEV_MODE_NONE,
+    LV_INDEV_MODE_TIMER,
+    LV_INDEV_MODE_EVENT,
+} lv_indev_mode_t;
+
+static inline lv_event_code_t lv_event_get_code(lv_event_t *e)
+{
+    return e->code;
+}
+
+static inline void *lv_event_get_target(lv_event_t *e)
+{
+    return e->target;
+}
+
+static inline int32_t lv_area_get_width(const lv_area_t *area)
+{
+    return area->x2 - area->x1 + 1;
+}
+
+static inline int32_t lv_area_get_height(const lv_area_t *area)
+{
+    return area->y2 - area->y1 + 1;
+}
+
+static inline uint32_t lv_area_get_size(const lv_area_t *area)
+{
+    return (uint32_t)lv_area_get_width(area) * (uint32_t)lv_area_get_height(area);
+}
+
+static inline bool lv_area_is_point_on(const lv_area_t *area, const lv_point_t *point, int32_t radius)
+{
+    return point->x >= area->x1 && point->x <= area->x2 && point->y >= area->y1 && point->y <= area->y2;
+}
+
+static inline void lv_obj_get_coords(const lv_obj_t *obj, lv_area_t *coords)
+{
+    *coords = obj->coords;
+}
+
+static inline void lv_obj_update_layout(const lv_obj_t *obj)
+{
+}
+
+static inline lv_obj_t *lv_display_get_screen_active(lv_display_t *disp)
+{
+    return NULL;
+}
+
+static inline lv_obj_t *lv_display_get_layer_top(lv_display_t *disp)
+{
+    return NULL;
+}
+
+static inline lv_obj_t *lv_display_get_layer_sys(lv_display_t *disp)
+{
+    return NULL;
+}
+
+static inline void lv_display_add_event_cb(lv_display_t *disp, lv_event_cb_t event_cb, lv_event_code_t filter, void *user_data)
+{
+}
+
+static inline void lv_image_cache_drop(const void *src)
+{
+}
+
+// No image fonts: the tests call the path callback themselves
+static inline lv_font_t *lv_imgfont_create(uint16_t height, lv_imgfont_get_path_cb_t path_cb, void *user_data)
+{
+    return NULL;
+}
+
+static inline void lv_tick_inc(uint32_t tick_period)
+{
+}
+
+static inline uint32_t lv_timer_handler(void)
+{
+    return 0;
+}
+
+static inline lv_timer_t *lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void *user_data)
+{
+    return NULL;
+}
+
+static inline lv_indev_t *lv_indev_create(void)
+{
+    return (lv_indev_t *)calloc(1, sizeof(lv_indev_t));
+}
+
+static inline void lv_indev_delete(lv_indev_t *indev)
+{
+    free(indev);
+}
+
+static inline lv_indev_t *lv_indev_get_next(lv_indev_t *indev)
+{
+    return NULL;
+}
+
+static inline void lv_indev_enable(lv_indev_t *indev, bool enable)
+{
+}
+
+static inline void lv_indev_set_type(lv_indev_t *indev, lv_indev_type_t indev_type)
+{
+}
+
+static inline void lv_indev_set_mode(lv_indev_t *indev, lv_indev_mode_t mode)
+{
+}
+
+static inline void lv_indev_set_display(lv_indev_t *indev, lv_display_t *disp)
+{
+}
+
+static inline void lv_indev_read(lv_indev_t *indev)
+{
+    lv_indev_data_t data = {};
+    if (indev && indev->read_cb)
+        indev->read_cb(indev, &data);
+}
+
+static inline void *lv_indev_get_user_data(const lv_indev_t *indev)
+{
+    return indev ? indev->user_data : NULL;
+}
+
+static inline void lv_indev_set_user_data(lv_indev_t *indev, void *user_data)
+{
+    if (indev)
+        indev->user_data = user_data;
+}
+
+static inline lv_indev_read_cb_t lv_indev_get_read_cb(lv_indev_t *indev)
+{
+    return indev ? indev->read_cb : NULL;
+}
+
+static inline void lv_indev_set_read_cb(lv_indev_t *indev, lv_indev_read_cb_t read_cb)
+{
+    if (indev)
+        indev->read_cb = read_cb;
+}
+
+static inline lv_display_t *lv_indev_get_display(const lv_indev_t *indev)
+{
+    return NULL;
+}
+
+static inline int32_t lv_display_get_horizontal_resolution(const lv_display_t *disp)
+{
+    return 0;
+}
+
+static inline int32_t lv_display_get_vertical_resolution(const lv_display_t *disp)
+{
+    return 0;
+}
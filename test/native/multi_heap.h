@@ -0,0 +1,195 @@
+#pragma once
+
+// Host stand-in for ESP-IDF's multi_heap: a first fit heap in the registered region,
+// its blocks in address order and free neighbours merged. It is not TLSF, so its
+// fragmentation is not the board's; what is tested on it is who allocates where
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MULTI_HEAP_HOST_ALIGN(size) (((size) + 7) & ~(size_t)7)
+
+typedef struct
+{
+    size_t size; // Header included
+    size_t free;
+} multi_heap_host_block_t;
+
+typedef struct multi_heap_host
+{
+    multi_heap_host_block_t *first;
+    uint8_t *end;
+    size_t minimum_free_bytes;
+} *multi_heap_handle_t;
+
+typedef struct
+{
+    size_t total_free_bytes;
+    size_t total_allocated_bytes;
+    size_t largest_free_block;
+    size_t minimum_free_bytes;
+    size_t allocated_blocks;
+    size_t free_blocks;
+    size_t total_blocks;
+} multi_heap_info_t;
+
+#define MULTI_HEAP_HOST_HEADER MULTI_HEAP_HOST_ALIGN(sizeof(multi_heap_host_block_t))
+#define MULTI_HEAP_HOST_MIN_SPLIT (MULTI_HEAP_HOST_HEADER + 8)
+
+static inline multi_heap_host_block_t *multi_heap_host_next(multi_heap_handle_t heap, multi_heap_host_block_t *b)
+{
+    multi_heap_host_block_t *next = (multi_heap_host_block_t *)((uint8_t *)b + b->size);
+    return (uint8_t *)next < heap->end ? next : NULL;
+}
+
+static inline void multi_heap_get_info(multi_heap_handle_t heap, multi_heap_info_t *info)
+{
+    memset(info, 0, sizeof(*info));
+    for (multi_heap_host_block_t *b = heap->first; b; b = multi_heap_host_next(heap, b))
+    {
+        size_t payload = b->size - MULTI_HEAP_HOST_HEADER;
+        info->total_blocks++;
+        if (b->free)
+        {
+            info->total_free_bytes += payload;
+            info->free_blocks++;
+            if (payload > info->largest_free_block)
+                info->largest_free_block = payload;
+        }
+        else
+        {
+            info->total_allocated_bytes += payload;
+            info->allocated_blocks++;
+        }
+    }
+    info->minimum_free_bytes = heap->minimum_free_bytes;
+}
+
+static inline void multi_heap_host_track(multi_heap_handle_t heap)
+{
+    multi_heap_info_t info;
+    multi_heap_get_info(heap, &info);
+    if (info.total_free_bytes < heap->minimum_free_bytes)
+        heap->minimum_free_bytes = info.total_free_bytes;
+}
+
+// Merges every run of free blocks
+static inline void multi_heap_host_merge(multi_heap_handle_t heap)
+{
+    for (multi_heap_host_block_t *b = heap->first; b; b = multi_heap_host_next(heap, b))
+    {
+        multi_heap_host_block_t *next;
+        while (b->free && (next = multi_heap_host_next(heap, b)) && next->free)
+            b->size += next->size;
+    }
+}
+
+static inline multi_heap_handle_t multi_heap_register(void *start, size_t size)
+{
+    uint8_t *base = (uint8_t *)MULTI_HEAP_HOST_ALIGN((uintptr_t)start);
+    uint8_t *end = (uint8_t *)(((uintptr_t)start + size) & ~(uintptr_t)7);
+    size_t bookkeeping = MULTI_HEAP_HOST_ALIGN(sizeof(struct multi_heap_host));
+    if (end < base || (size_t)(end - base) < bookkeeping + MULTI_HEAP_HOST_MIN_SPLIT)
+        return NULL;
+    multi_heap_handle_t heap = (multi_heap_handle_t)base;
+    heap->first = (multi_heap_host_block_t *)(base + bookkeeping);
+    heap->first->size = end - (uint8_t *)heap->first;
+    heap->first->free = 1;
+    heap->end = end;
+    heap->minimum_free_bytes = heap->first->size - MULTI_HEAP_HOST_HEADER;
+    return heap;
+}
+
+static inline void *multi_heap_malloc(multi_heap_handle_t heap, size_t size)
+{
+    if (!size)
+        return NULL;
+    size_t need = MULTI_HEAP_HOST_HEADER + MULTI_HEAP_HOST_ALIGN(size);
+    for (multi_heap_host_block_t *b = heap->first; b; b = multi_heap_host_next(heap, b))
+    {
+        if (!b->free || b->size < need)
+            continue;
+        if (b->size - need >= MULTI_HEAP_HOST_MIN_SPLIT)
+        {
+            multi_heap_host_block_t *rest = (multi_heap_host_block_t *)((uint8_t *)b + need);
+            rest->size = b->size - need;
+            rest->free = 1;
+            b->size = need;
+        }
+        b->free = 0;
+        multi_heap_host_track(heap);
+        return (uint8_t *)b + MULTI_HEAP_HOST_HEADER;
+    }
+    return NULL;
+}
+
+static inline void multi_heap_free(multi_heap_handle_t heap, void *p)
+{
+    if (!p)
+        return;
+    ((multi_heap_host_block_t *)((uint8_t *)p - MULTI_HEAP_HOST_HEADER))->free = 1;
+    multi_heap_host_merge(heap);
+}
+
+static inline size_t multi_heap_get_allocated_size(multi_heap_handle_t heap, void *p)
+{
+    return ((multi_heap_host_block_t *)((uint8_t *)p - MULTI_HEAP_HOST_HEADER))->size - MULTI_HEAP_HOST_HEADER;
+}
+
+// In place when the block, with a free block after it, is large enough
+static inline void *multi_heap_realloc(multi_heap_handle_t heap, void *p, size_t size)
+{
+    if (!p)
+        return multi_heap_malloc(heap, size);
+    if (!size)
+    {
+        multi_heap_free(heap, p);
+        return NULL;
+    }
+    multi_heap_host_block_t *b = (multi_heap_host_block_t *)((uint8_t *)p - MULTI_HEAP_HOST_HEADER);
+    size_t need = MULTI_HEAP_HOST_HEADER + MULTI_HEAP_HOST_ALIGN(size);
+    multi_heap_host_block_t *next = multi_heap_host_next(heap, b);
+    if (b->size < need && next && next->free && b->size + next->size >= need)
+        b->size += next->size;
+    if (b->size >= need)
+    {
+        if (b->size - need >= MULTI_HEAP_HOST_MIN_SPLIT)
+        {
+            multi_heap_host_block_t *rest = (multi_heap_host_block_t *)((uint8_t *)b + need);
+            rest->size = b->size - need;
+            rest->free = 1;
+            b->size = need;
+            multi_heap_host_merge(heap);
+        }
+        multi_heap_host_track(heap);
+        return p;
+    }
+
+    void *q = multi_heap_malloc(heap, size);
+    if (!q)
+        return NULL;
+    memcpy(q, p, b->size - MULTI_HEAP_HOST_HEADER);
+    multi_heap_free(heap, p);
+    return q;
+}
+
+// The blocks tile the region and no two free ones are neighbours
+static inline bool multi_heap_check(multi_heap_handle_t heap, bool print_errors)
+{
+    bool prev_free = false;
+    multi_heap_host_block_t *b = heap->first;
+    for (; b; b = multi_heap_host_next(heap, b))
+    {
+        if (b->size < MULTI_HEAP_HOST_HEADER || b->size % 8 || (uint8_t *)b + b->size > heap->end || (prev_free && b->free))
+        {
+            if (print_errors)
+                printf("multi_heap: bad block at %p\n", (void *)b);
+            return false;
+        }
+        prev_free = b->free;
+    }
+    return true;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+// Host stand-in for the display internals the flush stages reach into: the list of
+// invalidated areas of the next refresh
+
+#include <lvgl.h>
+
+#define LV_INV_BUF_SIZE 32
+
+struct _lv_display_t
+{
+    lv_area_t inv_areas[LV_INV_BUF_SIZE];
+    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+    uint32_t inv_p;
+};
@@ -0,0 +1,128 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include <unity.h>
+
+// The boot trace is built here from its source on a virtual clock, with the panel
+// transactions of flush_hooks counted by the test, so the time to the first frame
+// and to the first keystroke come out exactly
+#define micros model_micros
+
+static uint32_t now_us;
+
+static uint32_t model_micros()
+{
+    return now_us;
+}
+
+#include "../../src/boot_trace.cpp"
+
+static flush_hooks_stats_t stats;
+
+const flush_hooks_stats_t *flush_hooks_get_stats()
+{
+    return &stats;
+}
+
+// LVGL finished a refresh, having sent transactions panel transactions
+static void refresh(uint32_t transactions)
+{
+    stats.transactions += transactions;
+    lv_event_t e = {};
+    e.code = LV_EVENT_REFR_READY;
+    first_frame_event_cb(&e);
+}
+
+// When the phase was marked, UINT32_MAX: never
+static uint32_t phase_us(const char *name)
+{
+    for (int i = 0; i < phase_count; i++)
+        if (strcmp(phases[i].name, name) == 0)
+            return phases[i].us;
+    return UINT32_MAX;
+}
+
+void setUp(void)
+{
+    now_us = 0;
+    memset(&stats, 0, sizeof(stats));
+    phase_count = 0;
+    first_frame_done = false;
+    first_key_done = false;
+}
+
+void tearDown(void)
+{
+}
+
+// The phases of setup() as main.cpp marks them, then the first frame and keystroke
+static void test_boot_sequence(void)
+{
+    now_us = 310000;
+    boot_trace_mark("serial");
+    now_us = 480000;
+    boot_trace_mark("display");
+    now_us = 520000;
+    boot_trace_mark("keymap");
+    now_us = 610000;
+    boot_trace_mark("screen");
+    boot_trace_watch_first_frame(NULL);
+
+    // The first refresh after the screen was built sends pixels
+    now_us = 655000;
+    refresh(6);
+    now_us = 2400000;
+    boot_trace_first_key();
+
+    static const char *const names[] = {"serial", "display", "keymap", "screen", "first frame", "first key"};
+    static const uint32_t times[] = {310000, 480000, 520000, 610000, 655000, 2400000};
+    TEST_ASSERT_EQUAL(6, phase_count);
+    for (int i = 0; i < 6; i++)
+    {
+        TEST_ASSERT_EQUAL_STRING(names[i], phases[i].name);
+        TEST_ASSERT_EQUAL(times[i], phases[i].us);
+    }
+    TEST_ASSERT_EQUAL(45000, phase_us("first frame") - phase_us("screen"));
+}
+
+// Refreshes with nothing to draw finish too: the frame is the first one with pixels
+// sent after the watch started
+static void test_first_frame_needs_pixels(void)
+{
+    stats.transactions = 3; // Sent before the watch, e.g. clearing the panel
+    boot_trace_watch_first_frame(NULL);
+    now_us = 1000;
+    refresh(0);
+    now_us = 2000;
+    refresh(0);
+    TEST_ASSERT_EQUAL(UINT32_MAX, phase_us("first frame"));
+    now_us = 3000;
+    refresh(1);
+    TEST_ASSERT_EQUAL(3000, phase_us("first frame"));
+    now_us = 4000;
+    refresh(2);
+    TEST_ASSERT_EQUAL(1, phase_count);
+}
+
+// Only the first keystroke is marked (and reports); the marks stop at the last phase
+static void test_first_key_once(void)
+{
+    now_us = 5000;
+    boot_trace_first_key();
+    now_us = 6000;
+    boot_trace_first_key();
+    TEST_ASSERT_EQUAL(1, phase_count);
+    TEST_ASSERT_EQUAL(5000, phase_us("first key"));
+
+    for (int i = 0; i < BOOT_TRACE_MAX_PHASES + 4; i++)
+        boot_trace_mark("stage");
+    TEST_ASSERT_EQUAL(BOOT_TRACE_MAX_PHASES, phase_count);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_boot_sequence);
+    RUN_TEST(test_first_frame_needs_pixels);
+    RUN_TEST(test_first_key_once);
+    return UNITY_END();
+}
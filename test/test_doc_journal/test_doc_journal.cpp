@@ -0,0 +1,226 @@
+#include <LittleFS.h>
+#include <unity.h>
+#include "doc_journal.h"
+
+#define ACCEPTS 300
+#define DOC_MAX 4096 // Each session's document, a few compactions long
+
+// The LittleFS store on host files, with the power cut in one of its writes or removals
+static const doc_journal_store_t *files;
+static bool powered;
+static int32_t ops_left;   // Writes and removals before the one that is cut, < 0: never
+static uint32_t cut_bytes; // Written by the append that is cut
+static uint32_t ops;       // Writes and removals since the last erase
+static uint32_t rng_state;
+
+static int32_t cut_size(int seg) { return files->size(seg); }
+
+static int32_t cut_read(int seg, uint32_t offset, void *buf, uint32_t len)
+{
+    return files->read(seg, offset, buf, len);
+}
+
+// False when the power is cut at this operation
+static bool power_op()
+{
+    if (!powered)
+        return false;
+    ops++;
+    if (ops_left == 0)
+        powered = false;
+    else if (ops_left > 0)
+        ops_left--;
+    return powered;
+}
+
+static int32_t cut_append(int seg, const void *buf, uint32_t len)
+{
+    if (!powered)
+        return -1;
+    if (power_op())
+        return files->append(seg, buf, len);
+    // A cut in the middle leaves the first bytes written
+    len = len < cut_bytes ? len : cut_bytes;
+    return len ? files->append(seg, buf, len) : -1;
+}
+
+static bool cut_remove(int seg)
+{
+    return power_op() && files->remove(seg);
+}
+
+static const doc_journal_store_t cut_store = {cut_size, cut_read, cut_append, cut_remove};
+
+static char doc[DOC_MAX + 1];
+static uint32_t doc_len() { return strlen(doc); }
+static bool doc_read(uint32_t offset, char *buf, uint32_t len)
+{
+    memcpy(buf, doc + offset, len);
+    return true;
+}
+static const doc_journal_text_t doc_text = {doc_len, doc_read};
+
+// xorshift32, so every run of the test cuts at the same points
+static uint32_t rng(uint32_t min, uint32_t max)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return min + rng_state % (max - min);
+}
+
+static void erase_segments()
+{
+    powered = true;
+    ops_left = -1;
+    ops = 0;
+    files->remove(0);
+    files->remove(1);
+    doc[0] = '\0';
+}
+
+// Types words until the power is cut, polling the journal as the timer would.
+// Returns the document bytes known to be on flash
+static uint32_t type_words(doc_journal_t *j)
+{
+    uint32_t durable = 0;
+    for (int i = 0; i < ACCEPTS && powered; i++)
+    {
+        // A word of 1..40 letters
+        char word[41];
+        int n = rng(1, 41);
+        for (int c = 0; c < n; c++)
+            word[c] = 'a' + (i + c) % 26;
+        word[n] = '\0';
+        if (strlen(doc) + n > DOC_MAX)
+            break;
+        strcat(doc, word);
+        if (doc_journal_append(j, word, n))
+            durable = strlen(doc);
+        for (int p = 0; p < 4; p++)
+            doc_journal_poll(j);
+    }
+    return durable;
+}
+
+// Opens the journal and types the same session of words into it. Returns the
+// document bytes known to be on flash
+static uint32_t run_session()
+{
+    doc_journal_t j;
+    char *text;
+    uint32_t len;
+    uint32_t durable = 0;
+    rng_state = 7;
+    if (doc_journal_open(&j, &cut_store, &doc_text, &text, &len))
+        durable = type_words(&j);
+    free(text);
+    return durable;
+}
+
+void setUp()
+{
+    files = doc_journal_littlefs_store();
+    TEST_ASSERT_NOT_NULL(files);
+    erase_segments();
+}
+
+void tearDown()
+{
+    erase_segments();
+}
+
+static void test_restores_without_power_cut()
+{
+    doc_journal_t j;
+    char *text;
+    uint32_t len;
+    TEST_ASSERT_TRUE(doc_journal_open(&j, &cut_store, &doc_text, &text, &len));
+    TEST_ASSERT_NULL(text);
+
+    rng_state = 1;
+    uint32_t durable = type_words(&j);
+    TEST_ASSERT_EQUAL(strlen(doc), durable);
+    TEST_ASSERT_TRUE(j.stats.compactions > 0);
+
+    doc_journal_t restored;
+    TEST_ASSERT_TRUE(doc_journal_open(&restored, &cut_store, &doc_text, &text, &len));
+    TEST_ASSERT_NOT_NULL(text);
+    TEST_ASSERT_EQUAL(strlen(doc), len);
+    TEST_ASSERT_EQUAL_MEMORY(doc, text, len);
+    free(text);
+}
+
+static void test_appends_after_restore()
+{
+    doc_journal_t j;
+    char *text;
+    uint32_t len;
+    TEST_ASSERT_TRUE(doc_journal_open(&j, &cut_store, &doc_text, &text, &len));
+    TEST_ASSERT_TRUE(doc_journal_append(&j, "first ", 6));
+    strcpy(doc, "first ");
+
+    TEST_ASSERT_TRUE(doc_journal_open(&j, &cut_store, &doc_text, &text, &len));
+    TEST_ASSERT_EQUAL(6, len);
+    free(text);
+    TEST_ASSERT_TRUE(doc_journal_append(&j, "second", 6));
+    strcat(doc, "second");
+
+    TEST_ASSERT_TRUE(doc_journal_open(&j, &cut_store, &doc_text, &text, &len));
+    TEST_ASSERT_EQUAL(12, len);
+    TEST_ASSERT_EQUAL_MEMORY("first second", text, len);
+    free(text);
+}
+
+// The power is cut in each write and removal of a session in turn, a cut write
+// leaving part of its bytes: the next boot restores all durable text, and nothing
+// that was never typed
+static void test_restores_after_power_cuts()
+{
+    run_session();
+    uint32_t session_ops = ops;
+
+    for (uint32_t cut = 0; cut < session_ops; cut++)
+    {
+        erase_segments();
+        ops_left = cut;
+        cut_bytes = cut * 37 % DOC_JOURNAL_PAGE_SIZE;
+        uint32_t durable = run_session();
+        char *text;
+        uint32_t len;
+
+        // Power back, with an empty document as at boot
+        static char typed[DOC_MAX + 1];
+        strcpy(typed, doc);
+        doc[0] = '\0';
+        powered = true;
+        ops_left = -1;
+        doc_journal_t restored;
+        TEST_ASSERT_TRUE(doc_journal_open(&restored, &cut_store, &doc_text, &text, &len));
+        uint32_t restored_len = text ? len : 0;
+        TEST_ASSERT_TRUE(restored_len >= durable);
+        TEST_ASSERT_TRUE(restored_len <= strlen(typed));
+        if (text)
+            TEST_ASSERT_EQUAL_MEMORY(typed, text, restored_len);
+        free(text);
+
+        // The repaired journal takes appends again and restores them
+        TEST_ASSERT_TRUE(doc_journal_append(&restored, "z", 1));
+        doc_journal_t again;
+        TEST_ASSERT_TRUE(doc_journal_open(&again, &cut_store, &doc_text, &text, &len));
+        TEST_ASSERT_NOT_NULL(text);
+        TEST_ASSERT_EQUAL(restored_len + 1, len);
+        TEST_ASSERT_EQUAL_MEMORY(typed, text, restored_len);
+        TEST_ASSERT_EQUAL('z', text[restored_len]);
+        free(text);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_restores_without_power_cut);
+    RUN_TEST(test_appends_after_restore);
+    RUN_TEST(test_restores_after_power_cuts);
+    return UNITY_END();
+}
@@ -0,0 +1,641 @@
+#pragma once
+
+// LZ4 blocks of the reference compressor (lz4 1.9.4: 'lz4 -1' and 'lz4 -12', the
+// block taken out of its frame) and of doc_store_compress, each checked to
+// decompress to its text with 'lz4 -d' when it was generated.
+// prose: 2 kB of the README. runs: runs of one byte and of a 3 byte pattern
+// (overlapping matches), literal runs of 300 bytes, matches longer than 270 bytes
+
+static const uint8_t prose_text[] = {
+    0x23, 0x23, 0x20, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+    0x0a, 0x0a, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x66, 0x65, 0x61, 0x74, 0x75,
+    0x72, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67,
+    0x73, 0x60, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x69,
+    0x6f, 0x2e, 0x69, 0x6e, 0x69, 0x60, 0x3a, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x2d, 0x44, 0x20, 0x50,
+    0x45, 0x52, 0x46, 0x5f, 0x48, 0x55, 0x44, 0x3d, 0x31, 0x60, 0x3a, 0x20, 0x72, 0x65, 0x70, 0x6c,
+    0x61, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x62,
+    0x61, 0x72, 0x20, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x20, 0x48, 0x55, 0x44, 0x20, 0x73,
+    0x68, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x46, 0x50, 0x53, 0x2c, 0x20, 0x43, 0x50, 0x55, 0x20,
+    0x6c, 0x6f, 0x61, 0x64, 0x2c, 0x20, 0x4c, 0x56, 0x47, 0x4c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20,
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x2f, 0x20, 0x66, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x61,
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x74,
+    0x65, 0x6e, 0x63, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x73, 0x74,
+    0x20, 0x6b, 0x65, 0x79, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c,
+    0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6c, 0x75, 0x73, 0x68,
+    0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x48, 0x55, 0x44, 0x27, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20,
+    0x6f, 0x76, 0x65, 0x72, 0x68, 0x65, 0x61, 0x64, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6f,
+    0x72, 0x74, 0x65, 0x64, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x35, 0x20, 0x73, 0x65, 0x63,
+    0x6f, 0x6e, 0x64, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x69,
+    0x61, 0x6c, 0x20, 0x6c, 0x6f, 0x67, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x72, 0x65, 0x64, 0x72, 0x61, 0x77, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61,
+    0x20, 0x6b, 0x65, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6c,
+    0x6f, 0x75, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6d, 0x65,
+    0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x62, 0x6f, 0x6f, 0x74, 0x2e, 0x0a,
+    0x2d, 0x20, 0x60, 0x2d, 0x44, 0x20, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f, 0x41, 0x54, 0x4c, 0x41,
+    0x53, 0x3d, 0x30, 0x60, 0x3a, 0x20, 0x64, 0x72, 0x61, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b,
+    0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x65, 0x6e,
+    0x67, 0x69, 0x6e, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x2d, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x65, 0x64,
+    0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x61, 0x74, 0x6c, 0x61, 0x73, 0x20, 0x28, 0x66, 0x6f,
+    0x72, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x69, 0x73, 0x6f, 0x6e, 0x29, 0x2e, 0x0a, 0x2d,
+    0x20, 0x60, 0x2d, 0x44, 0x20, 0x44, 0x52, 0x41, 0x57, 0x5f, 0x41, 0x53, 0x4d, 0x5f, 0x53, 0x45,
+    0x4c, 0x46, 0x54, 0x45, 0x53, 0x54, 0x3d, 0x31, 0x60, 0x3a, 0x20, 0x61, 0x74, 0x20, 0x62, 0x6f,
+    0x6f, 0x74, 0x2c, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x65,
+    0x63, 0x74, 0x6f, 0x72, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x20, 0x2f, 0x20,
+    0x69, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65,
+    0x6c, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c,
+    0x56, 0x47, 0x4c, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6e,
+    0x64, 0x65, 0x72, 0x65, 0x72, 0x20, 0x62, 0x69, 0x74, 0x2d, 0x66, 0x6f, 0x72, 0x2d, 0x62, 0x69,
+    0x74, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x6c, 0x61, 0x69, 0x6e, 0x20,
+    0x43, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x6f, 0x67, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x20, 0x6f,
+    0x66, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x76, 0x65, 0x63, 0x74,
+    0x6f, 0x72, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x28, 0x50, 0x49, 0x45, 0x29, 0x20, 0x69, 0x73,
+    0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20,
+    0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x53, 0x50, 0x33, 0x32, 0x2d, 0x53, 0x33, 0x20,
+    0x62, 0x6f, 0x61, 0x72, 0x64, 0x73, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65,
+    0x72, 0x73, 0x20, 0x75, 0x73, 0x65, 0x20, 0x33, 0x32, 0x20, 0x62, 0x69, 0x74, 0x20, 0x73, 0x74,
+    0x6f, 0x72, 0x65, 0x73, 0x2e, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f,
+    0x70, 0x61, 0x71, 0x75, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x75, 0x6e, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x52, 0x47, 0x42,
+    0x35, 0x36, 0x35, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x64, 0x3b, 0x20, 0x62, 0x6c, 0x65,
+    0x6e, 0x64, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x41, 0x38, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x4c,
+    0x56, 0x47, 0x4c, 0x27, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x73, 0x2e,
+    0x0a, 0x2d, 0x20, 0x60, 0x2d, 0x44, 0x20, 0x4b, 0x45, 0x59, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5f,
+    0x43, 0x41, 0x43, 0x48, 0x45, 0x3d, 0x31, 0x60, 0x3a, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72,
+    0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x69, 0x64, 0x6c, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64,
+    0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x50, 0x53, 0x52,
+    0x41, 0x4d, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65,
+    0x64, 0x72, 0x61, 0x77, 0x20, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x64,
+    0x20, 0x6b, 0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e,
+    0x73, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x72, 0x6f,
+    0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x6f, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x6e, 0x3b,
+    0x20, 0x61, 0x20, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20,
+    0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x73, 0x77, 0x61, 0x70, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+    0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x28, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6d, 0x6f, 0x6a, 0x69,
+    0x20, 0x70, 0x69, 0x63, 0x6b, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65,
+    0x72, 0x65, 0x64, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x20, 0x70, 0x65, 0x72, 0x20, 0x70, 0x61,
+    0x67, 0x65, 0x29, 0x2e, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x20, 0x6b, 0x65, 0x79, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20,
+    0x6f, 0x72, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73,
+    0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x69,
+    0x73, 0x20, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x2e, 0x20, 0x42, 0x6f,
+    0x61, 0x72, 0x64, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x50, 0x53, 0x52,
+    0x41, 0x4d, 0x20, 0x66, 0x61, 0x6c, 0x6c, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74, 0x6f, 0x20,
+    0x64, 0x72, 0x61, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x62,
+    0x6f, 0x61, 0x72, 0x64, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x2e, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20,
+    0x60, 0x50, 0x45, 0x52, 0x46, 0x5f, 0x48, 0x55, 0x44, 0x60, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x75, 0x6c, 0x6c, 0x20, 0x6b, 0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x72, 0x65, 0x64,
+    0x72, 0x61, 0x77, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x6f, 0x67, 0x67,
+    0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x62, 0x6f, 0x6f, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x61, 0x6e, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x0a, 0x2d, 0x20, 0x60, 0x2d, 0x44, 0x20, 0x46, 0x4c, 0x55,
+    0x53, 0x48, 0x5f, 0x53, 0x43, 0x48, 0x45, 0x44, 0x55, 0x4c, 0x45, 0x52, 0x3d, 0x30, 0x60, 0x3a,
+    0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x4c, 0x56, 0x47, 0x4c, 0x27, 0x73, 0x20, 0x6f, 0x77, 0x6e,
+    0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x6e, 0x76, 0x61,
+    0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x72, 0x65, 0x61, 0x73, 0x20, 0x69, 0x6e,
+    0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x65, 0x72, 0x67, 0x69, 0x6e, 0x67,
+    0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x62, 0x79, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x65, 0x64,
+    0x20, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x20, 0x63, 0x6f, 0x73, 0x74, 0x20, 0x28, 0x60, 0x46, 0x4c,
+    0x55, 0x53, 0x48, 0x5f, 0x53, 0x43, 0x48, 0x45, 0x44, 0x55, 0x4c, 0x45, 0x52, 0x5f, 0x54, 0x58,
+    0x5f, 0x4f, 0x56, 0x45, 0x52, 0x48, 0x45, 0x41, 0x44, 0x5f, 0x42, 0x59, 0x54, 0x45, 0x53, 0x60,
+    0x29, 0x2e, 0x20, 0x42, 0x79, 0x74, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x72, 0x61,
+    0x6e, 0x73, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x74,
+    0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x2c, 0x20, 0x70, 0x65, 0x72,
+    0x20, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x65, 0x72, 0x20, 0x6b,
+    0x65, 0x79, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x65, 0x64, 0x20, 0x62, 0x75, 0x73, 0x20, 0x74, 0x69,
+    0x6d, 0x65, 0x20, 0x28, 0x60, 0x46, 0x4c, 0x55, 0x53, 0x48, 0x5f, 0x53, 0x43, 0x48, 0x45, 0x44,
+    0x55, 0x4c, 0x45, 0x52, 0x5f, 0x42, 0x55, 0x53, 0x5f, 0x48, 0x5a, 0x60, 0x2c, 0x20, 0x60, 0x46,
+    0x4c, 0x55, 0x53, 0x48, 0x5f, 0x53, 0x43, 0x48, 0x45, 0x44, 0x55, 0x4c, 0x45, 0x52, 0x5f, 0x54,
+    0x58, 0x5f, 0x4f, 0x56, 0x45, 0x52, 0x48, 0x45, 0x41, 0x44, 0x5f, 0x55, 0x53, 0x60, 0x29, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x6c, 0x6f, 0x67, 0x67, 0x65, 0x64, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+    0x20, 0x35, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65,
+    0x72, 0x20, 0x77, 0x61, 0x79, 0x2e, 0x0a, 0x2d, 0x20, 0x60, 0x2d, 0x44, 0x20, 0x4c, 0x56, 0x5f,
+    0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f, 0x44, 0x45, 0x50, 0x54, 0x48, 0x3d, 0x38, 0x60, 0x3a, 0x20,
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x38, 0x20, 0x62, 0x69, 0x74, 0x20,
+    0x67, 0x72, 0x61, 0x79, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x73, 0x20, 0x28, 0x68, 0x61, 0x6c,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x72, 0x61, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x6e, 0x64,
+    0x65, 0x72, 0x20, 0x62, 0x61, 0x6e, 0x64, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x61, 0x6e,
+    0x64, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x61, 0x6e, 0x65, 0x6c, 0x27, 0x73, 0x20, 0x52, 0x47, 0x42, 0x35, 0x36, 0x35, 0x20, 0x69,
+    0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x20, 0x70, 0x61, 0x74, 0x68,
+    0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x20,
+    0x74, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x69, 0x6e, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x6f, 0x72,
+    0x61, 0x6e, 0x67, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65,
+    0x73, 0x73, 0x65, 0x64, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x2e, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x64, 0x72, 0x61, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20,
+};
+
+static const uint8_t prose_lz4_fast[] = {
+    0xf1, 0x04, 0x23, 0x23, 0x20, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f,
+    0x6e, 0x73, 0x0a, 0x0a, 0x4f, 0x09, 0x00, 0xf0, 0x10, 0x61, 0x6c, 0x20, 0x66, 0x65, 0x61, 0x74,
+    0x75, 0x72, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x62, 0x33, 0x00, 0xf1, 0x3f, 0x5f, 0x66, 0x6c, 0x61,
+    0x67, 0x73, 0x60, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d,
+    0x69, 0x6f, 0x2e, 0x69, 0x6e, 0x69, 0x60, 0x3a, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x2d, 0x44, 0x20,
+    0x50, 0x45, 0x52, 0x46, 0x5f, 0x48, 0x55, 0x44, 0x3d, 0x31, 0x60, 0x3a, 0x20, 0x72, 0x65, 0x70,
+    0x6c, 0x61, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+    0x62, 0x61, 0x72, 0x20, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x7e, 0x00, 0x02, 0x5f, 0x00, 0xf1,
+    0x2c, 0x61, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x20, 0x48, 0x55, 0x44, 0x20, 0x73, 0x68, 0x6f, 0x77,
+    0x69, 0x6e, 0x67, 0x20, 0x46, 0x50, 0x53, 0x2c, 0x20, 0x43, 0x50, 0x55, 0x20, 0x6c, 0x6f, 0x61,
+    0x64, 0x2c, 0x20, 0x4c, 0x56, 0x47, 0x4c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20, 0x75, 0x73, 0x65,
+    0x64, 0x20, 0x2f, 0x20, 0x66, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x47, 0x00, 0x41, 0x20,
+    0x61, 0x6e, 0x64, 0x65, 0x00, 0xa3, 0x6c, 0x61, 0x74, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6f, 0x66,
+    0x0f, 0x00, 0xf1, 0x17, 0x73, 0x74, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65,
+    0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0x20, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x7b, 0x00, 0xf0, 0x03, 0x27, 0x73,
+    0x20, 0x6f, 0x77, 0x6e, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x68, 0x65, 0x61, 0x64, 0x20, 0x69, 0x73,
+    0xc0, 0x00, 0xf1, 0x09, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20,
+    0x35, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x6f, 0x6e, 0x60, 0x00, 0xb5, 0x73,
+    0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x6c, 0x6f, 0x67, 0x2c, 0x83, 0x00, 0xb0, 0x72, 0x65, 0x64,
+    0x72, 0x61, 0x77, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x87, 0x00, 0x10, 0x61, 0x80, 0x00, 0x00, 0x32,
+    0x01, 0xb1, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x0c, 0x01, 0x20,
+    0x65, 0x73, 0x62, 0x00, 0xf3, 0x02, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x20, 0x61,
+    0x74, 0x20, 0x62, 0x6f, 0x6f, 0x74, 0x2e, 0x47, 0x01, 0xf2, 0x01, 0x47, 0x4c, 0x59, 0x50, 0x48,
+    0x5f, 0x41, 0x54, 0x4c, 0x41, 0x53, 0x3d, 0x30, 0x60, 0x3a, 0x20, 0x54, 0x00, 0x20, 0x68, 0x65,
+    0x4e, 0x00, 0xc3, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x41,
+    0x01, 0x00, 0x61, 0x01, 0xf0, 0x01, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x65, 0x6e, 0x67, 0x69, 0x6e,
+    0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0xc4, 0x00, 0x03, 0x08, 0x01, 0x90, 0x70, 0x72, 0x65, 0x2d,
+    0x72, 0x65, 0x6e, 0x64, 0x65, 0x6a, 0x00, 0xf4, 0x0d, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x61,
+    0x74, 0x6c, 0x61, 0x73, 0x20, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72,
+    0x69, 0x73, 0x6f, 0x6e, 0x29, 0x7f, 0x00, 0xf1, 0x02, 0x44, 0x52, 0x41, 0x57, 0x5f, 0x41, 0x53,
+    0x4d, 0x5f, 0x53, 0x45, 0x4c, 0x46, 0x54, 0x45, 0x53, 0x54, 0xcf, 0x01, 0x03, 0xa4, 0x00, 0x71,
+    0x2c, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x8f, 0x00, 0xf2, 0x15, 0x76, 0x65, 0x63, 0x74, 0x6f,
+    0x72, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x20, 0x2f, 0x20, 0x69, 0x6d, 0x61,
+    0x67, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x73, 0xb3,
+    0x01, 0x21, 0x62, 0x79, 0x31, 0x00, 0x01, 0xc9, 0x01, 0x50, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x65,
+    0x02, 0x03, 0x95, 0x00, 0xf0, 0x02, 0x72, 0x20, 0x62, 0x69, 0x74, 0x2d, 0x66, 0x6f, 0x72, 0x2d,
+    0x62, 0x69, 0x74, 0x20, 0x61, 0x67, 0x61, 0xc0, 0x00, 0xe1, 0x20, 0x70, 0x6c, 0x61, 0x69, 0x6e,
+    0x20, 0x43, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x73, 0x60, 0x01, 0x31, 0x6c, 0x6f, 0x67, 0x45, 0x00,
+    0xa0, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x63, 0x01, 0x00, 0x5a, 0x01,
+    0x02, 0xc6, 0x01, 0x02, 0x8e, 0x00, 0xb0, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x28, 0x50, 0x49,
+    0x45, 0x29, 0x63, 0x01, 0xa0, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0xd1,
+    0x02, 0x04, 0xbb, 0x01, 0x91, 0x45, 0x53, 0x50, 0x33, 0x32, 0x2d, 0x53, 0x33, 0x20, 0x4e, 0x01,
+    0x21, 0x73, 0x3b, 0x58, 0x00, 0x30, 0x6f, 0x74, 0x68, 0x53, 0x01, 0x60, 0x75, 0x73, 0x65, 0x20,
+    0x33, 0x32, 0x94, 0x00, 0xa0, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x2e, 0x20, 0x4f, 0x45,
+    0x00, 0x00, 0x66, 0x01, 0x62, 0x6f, 0x70, 0x61, 0x71, 0x75, 0x65, 0xed, 0x00, 0x04, 0x76, 0x02,
+    0x40, 0x75, 0x6e, 0x62, 0x6c, 0x5e, 0x01, 0x88, 0x64, 0x20, 0x52, 0x47, 0x42, 0x35, 0x36, 0x35,
+    0x04, 0x01, 0x02, 0xe6, 0x00, 0x01, 0x07, 0x03, 0x31, 0x64, 0x3b, 0x20, 0x28, 0x00, 0x02, 0xcc,
+    0x00, 0x22, 0x41, 0x38, 0x8a, 0x01, 0x02, 0x6e, 0x03, 0x00, 0xe0, 0x01, 0x41, 0x6e, 0x20, 0x62,
+    0x79, 0xe9, 0x02, 0x03, 0x8a, 0x02, 0x01, 0xf8, 0x00, 0x04, 0x92, 0x01, 0xe1, 0x4b, 0x45, 0x59,
+    0x42, 0x4f, 0x41, 0x52, 0x44, 0x5f, 0x43, 0x41, 0x43, 0x48, 0x45, 0x8f, 0x01, 0x02, 0x3d, 0x01,
+    0xb0, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x0d, 0x01, 0x00, 0xa4,
+    0x00, 0x37, 0x69, 0x64, 0x6c, 0x29, 0x02, 0x30, 0x6f, 0x6e, 0x63, 0x11, 0x02, 0xa0, 0x74, 0x6f,
+    0x20, 0x61, 0x20, 0x50, 0x53, 0x52, 0x41, 0x4d, 0xd9, 0x00, 0x31, 0x6d, 0x61, 0x70, 0x52, 0x01,
+    0x03, 0xae, 0x02, 0x80, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0xec, 0x02, 0x05, 0x62,
+    0x02, 0x30, 0x72, 0x65, 0x67, 0x21, 0x04, 0x00, 0x96, 0x00, 0x00, 0xcf, 0x01, 0x00, 0x96, 0x03,
+    0x41, 0x66, 0x72, 0x6f, 0x6d, 0x2a, 0x01, 0x03, 0x43, 0x00, 0x03, 0x60, 0x02, 0x02, 0x7e, 0x00,
+    0x00, 0xbb, 0x03, 0x43, 0x6e, 0x3b, 0x20, 0x61, 0x8d, 0x00, 0x62, 0x73, 0x77, 0x69, 0x74, 0x63,
+    0x68, 0x7f, 0x01, 0x58, 0x73, 0x77, 0x61, 0x70, 0x73, 0x39, 0x00, 0x10, 0x28, 0xa8, 0x00, 0xc0,
+    0x65, 0x6d, 0x6f, 0x6a, 0x69, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x65, 0x72, 0xaa, 0x01, 0x02, 0xd1,
+    0x00, 0x00, 0x0d, 0x03, 0x00, 0x02, 0x02, 0xa3, 0x20, 0x70, 0x65, 0x72, 0x20, 0x70, 0x61, 0x67,
+    0x65, 0x29, 0x7f, 0x01, 0x02, 0x4b, 0x03, 0x40, 0x74, 0x68, 0x61, 0x74, 0x2d, 0x00, 0x40, 0x70,
+    0x72, 0x65, 0x73, 0x0b, 0x04, 0x12, 0x6f, 0x79, 0x00, 0x00, 0x9e, 0x00, 0x00, 0xda, 0x03, 0x50,
+    0x73, 0x65, 0x6c, 0x65, 0x63, 0xc7, 0x00, 0x02, 0x20, 0x03, 0x00, 0x2a, 0x00, 0x02, 0x5c, 0x01,
+    0x00, 0x62, 0x04, 0x30, 0x2e, 0x20, 0x42, 0x3c, 0x03, 0x02, 0x35, 0x03, 0x33, 0x6f, 0x75, 0x74,
+    0x10, 0x01, 0x70, 0x66, 0x61, 0x6c, 0x6c, 0x20, 0x62, 0x61, 0xd3, 0x02, 0x11, 0x6f, 0x6a, 0x03,
+    0x00, 0x4d, 0x00, 0x00, 0xa1, 0x00, 0x05, 0x0b, 0x01, 0x02, 0x3d, 0x00, 0x11, 0x57, 0x0b, 0x05,
+    0x04, 0xe2, 0x04, 0x11, 0x60, 0xd0, 0x00, 0x46, 0x66, 0x75, 0x6c, 0x6c, 0x95, 0x03, 0x03, 0x4f,
+    0x01, 0x01, 0xfd, 0x03, 0x20, 0x69, 0x73, 0x19, 0x04, 0x10, 0x67, 0xcf, 0x00, 0x02, 0xdc, 0x03,
+    0x02, 0xab, 0x03, 0x00, 0x35, 0x02, 0x00, 0x54, 0x05, 0x00, 0x7f, 0x00, 0x00, 0x64, 0x00, 0x54,
+    0x63, 0x61, 0x63, 0x68, 0x65, 0xe6, 0x01, 0xf1, 0x00, 0x46, 0x4c, 0x55, 0x53, 0x48, 0x5f, 0x53,
+    0x43, 0x48, 0x45, 0x44, 0x55, 0x4c, 0x45, 0x52, 0xfb, 0x03, 0x48, 0x6b, 0x65, 0x65, 0x70, 0x17,
+    0x02, 0x40, 0x6a, 0x6f, 0x69, 0x6e, 0xa1, 0x00, 0x29, 0x6f, 0x66, 0xb7, 0x01, 0x58, 0x61, 0x72,
+    0x65, 0x61, 0x73, 0xf9, 0x03, 0x40, 0x6d, 0x65, 0x72, 0x67, 0x28, 0x00, 0x40, 0x74, 0x68, 0x65,
+    0x6d, 0xc4, 0x01, 0x40, 0x6d, 0x6f, 0x64, 0x65, 0xd1, 0x05, 0xdb, 0x70, 0x61, 0x6e, 0x65, 0x6c,
+    0x20, 0x63, 0x6f, 0x73, 0x74, 0x20, 0x28, 0x60, 0x71, 0x00, 0xf2, 0x0b, 0x5f, 0x54, 0x58, 0x5f,
+    0x4f, 0x56, 0x45, 0x52, 0x48, 0x45, 0x41, 0x44, 0x5f, 0x42, 0x59, 0x54, 0x45, 0x53, 0x60, 0x29,
+    0x2e, 0x20, 0x42, 0x79, 0x74, 0x65, 0xb5, 0x02, 0x70, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x61, 0x63,
+    0x74, 0x05, 0x00, 0x6b, 0x01, 0x20, 0x6e, 0x74, 0x32, 0x01, 0x00, 0xc6, 0x00, 0x01, 0x55, 0x00,
+    0x11, 0x2c, 0xb3, 0x01, 0x51, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x5d, 0x02, 0x00, 0xc1, 0x01, 0x05,
+    0x7e, 0x05, 0x06, 0x22, 0x05, 0x04, 0x89, 0x00, 0x32, 0x62, 0x75, 0x73, 0x27, 0x05, 0x0e, 0x87,
+    0x00, 0x9d, 0x42, 0x55, 0x53, 0x5f, 0x48, 0x5a, 0x60, 0x2c, 0x20, 0x1a, 0x00, 0x08, 0xa1, 0x00,
+    0x41, 0x55, 0x53, 0x60, 0x29, 0xac, 0x06, 0x03, 0x68, 0x01, 0x0c, 0xa6, 0x05, 0x20, 0x65, 0x69,
+    0xd0, 0x03, 0x44, 0x20, 0x77, 0x61, 0x79, 0x60, 0x01, 0xf6, 0x01, 0x4c, 0x56, 0x5f, 0x43, 0x4f,
+    0x4c, 0x4f, 0x52, 0x5f, 0x44, 0x45, 0x50, 0x54, 0x48, 0x3d, 0x38, 0x46, 0x03, 0x40, 0x69, 0x6e,
+    0x20, 0x38, 0x19, 0x03, 0x90, 0x20, 0x67, 0x72, 0x61, 0x79, 0x20, 0x6c, 0x65, 0x76, 0xb9, 0x04,
+    0x42, 0x28, 0x68, 0x61, 0x6c, 0x53, 0x03, 0x00, 0x44, 0x02, 0x95, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x20, 0x62, 0x0f, 0x01, 0x02, 0xb1, 0x02, 0xb1, 0x20, 0x62, 0x61, 0x6e, 0x64, 0x77,
+    0x69, 0x64, 0x74, 0x68, 0x29, 0xf7, 0x00, 0x30, 0x65, 0x78, 0x70, 0xe5, 0x01, 0x08, 0x1a, 0x01,
+    0x25, 0x27, 0x73, 0x1b, 0x04, 0x02, 0x3a, 0x06, 0x01, 0x7b, 0x06, 0x02, 0xa9, 0x04, 0x03, 0xcd,
+    0x04, 0x00, 0xe7, 0x04, 0x50, 0x6b, 0x75, 0x70, 0x20, 0x74, 0xa6, 0x04, 0x00, 0x2c, 0x03, 0x50,
+    0x61, 0x74, 0x20, 0x74, 0x69, 0x62, 0x01, 0x08, 0xf6, 0x05, 0x52, 0x6f, 0x72, 0x61, 0x6e, 0x67,
+    0x5e, 0x01, 0x01, 0x77, 0x01, 0x03, 0x05, 0x03, 0x92, 0x6b, 0x65, 0x79, 0x20, 0x67, 0x72, 0x65,
+    0x65, 0x6e, 0x08, 0x05, 0x41, 0x73, 0x70, 0x6c, 0x69, 0x1b, 0x05, 0x00, 0x24, 0x00, 0x06, 0xbb,
+    0x00, 0x50, 0x72, 0x20, 0x69, 0x73, 0x20,
+};
+
+static const uint8_t prose_lz4_hc[] = {
+    0xf1, 0x04, 0x23, 0x23, 0x20, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f,
+    0x6e, 0x73, 0x0a, 0x0a, 0x4f, 0x09, 0x00, 0xf0, 0x10, 0x61, 0x6c, 0x20, 0x66, 0x65, 0x61, 0x74,
+    0x75, 0x72, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x62, 0x33, 0x00, 0xf1, 0x3f, 0x5f, 0x66, 0x6c, 0x61,
+    0x67, 0x73, 0x60, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d,
+    0x69, 0x6f, 0x2e, 0x69, 0x6e, 0x69, 0x60, 0x3a, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x2d, 0x44, 0x20,
+    0x50, 0x45, 0x52, 0x46, 0x5f, 0x48, 0x55, 0x44, 0x3d, 0x31, 0x60, 0x3a, 0x20, 0x72, 0x65, 0x70,
+    0x6c, 0x61, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+    0x62, 0x61, 0x72, 0x20, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x7e, 0x00, 0x02, 0x5f, 0x00, 0xf1,
+    0x2c, 0x61, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x20, 0x48, 0x55, 0x44, 0x20, 0x73, 0x68, 0x6f, 0x77,
+    0x69, 0x6e, 0x67, 0x20, 0x46, 0x50, 0x53, 0x2c, 0x20, 0x43, 0x50, 0x55, 0x20, 0x6c, 0x6f, 0x61,
+    0x64, 0x2c, 0x20, 0x4c, 0x56, 0x47, 0x4c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20, 0x75, 0x73, 0x65,
+    0x64, 0x20, 0x2f, 0x20, 0x66, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x47, 0x00, 0x41, 0x20,
+    0x61, 0x6e, 0x64, 0x65, 0x00, 0xa3, 0x6c, 0x61, 0x74, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6f, 0x66,
+    0x0f, 0x00, 0xf1, 0x17, 0x73, 0x74, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65,
+    0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0x20, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x7b, 0x00, 0xf0, 0x03, 0x27, 0x73,
+    0x20, 0x6f, 0x77, 0x6e, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x68, 0x65, 0x61, 0x64, 0x20, 0x69, 0x73,
+    0xc0, 0x00, 0xf2, 0x09, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20,
+    0x35, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x6f, 0x6e, 0xd4, 0x00, 0xa5, 0x65,
+    0x72, 0x69, 0x61, 0x6c, 0x20, 0x6c, 0x6f, 0x67, 0x2c, 0x83, 0x00, 0xb0, 0x72, 0x65, 0x64, 0x72,
+    0x61, 0x77, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x87, 0x00, 0x10, 0x61, 0x80, 0x00, 0x00, 0x32, 0x01,
+    0xb1, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x0c, 0x01, 0x20, 0x65,
+    0x73, 0x62, 0x00, 0xf3, 0x02, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x20, 0x61, 0x74,
+    0x20, 0x62, 0x6f, 0x6f, 0x74, 0x2e, 0x47, 0x01, 0xf2, 0x01, 0x47, 0x4c, 0x59, 0x50, 0x48, 0x5f,
+    0x41, 0x54, 0x4c, 0x41, 0x53, 0x3d, 0x30, 0x60, 0x3a, 0x20, 0x54, 0x00, 0x20, 0x68, 0x65, 0x4e,
+    0x00, 0xc3, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x41, 0x01,
+    0x00, 0x1a, 0x00, 0xf0, 0x01, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x65, 0x6e, 0x67, 0x69, 0x6e, 0x65,
+    0x20, 0x69, 0x6e, 0x73, 0x74, 0xc4, 0x00, 0x03, 0x08, 0x01, 0x90, 0x70, 0x72, 0x65, 0x2d, 0x72,
+    0x65, 0x6e, 0x64, 0x65, 0x6a, 0x00, 0xf4, 0x0d, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x61, 0x74,
+    0x6c, 0x61, 0x73, 0x20, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x69,
+    0x73, 0x6f, 0x6e, 0x29, 0x7f, 0x00, 0xf1, 0x02, 0x44, 0x52, 0x41, 0x57, 0x5f, 0x41, 0x53, 0x4d,
+    0x5f, 0x53, 0x45, 0x4c, 0x46, 0x54, 0x45, 0x53, 0x54, 0xcf, 0x01, 0x03, 0xa4, 0x00, 0x71, 0x2c,
+    0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5a, 0x00, 0xf2, 0x15, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72,
+    0x69, 0x7a, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x20, 0x2f, 0x20, 0x69, 0x6d, 0x61, 0x67,
+    0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x73, 0xb3, 0x01,
+    0x21, 0x62, 0x79, 0x31, 0x00, 0x01, 0xc9, 0x01, 0x50, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x65, 0x02,
+    0x03, 0x95, 0x00, 0xf0, 0x02, 0x72, 0x20, 0x62, 0x69, 0x74, 0x2d, 0x66, 0x6f, 0x72, 0x2d, 0x62,
+    0x69, 0x74, 0x20, 0x61, 0x67, 0x61, 0xc0, 0x00, 0xe0, 0x20, 0x70, 0x6c, 0x61, 0x69, 0x6e, 0x20,
+    0x43, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x73, 0x60, 0x01, 0x00, 0x69, 0x01, 0x01, 0x45, 0x00, 0xa0,
+    0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0xe2, 0x00, 0x00, 0x5a, 0x01, 0x02,
+    0xc6, 0x01, 0x02, 0x8e, 0x00, 0xd0, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x28, 0x50, 0x49, 0x45,
+    0x29, 0x20, 0x69, 0xac, 0x01, 0x80, 0x6c, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0xd1, 0x02,
+    0x04, 0xbb, 0x01, 0x91, 0x45, 0x53, 0x50, 0x33, 0x32, 0x2d, 0x53, 0x33, 0x20, 0x4e, 0x01, 0x21,
+    0x73, 0x3b, 0x15, 0x00, 0x51, 0x6f, 0x74, 0x68, 0x65, 0x72, 0xb0, 0x00, 0x40, 0x20, 0x33, 0x32,
+    0x20, 0x8c, 0x00, 0x90, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x2e, 0x20, 0x4f, 0x45, 0x00, 0x01,
+    0x23, 0x00, 0x52, 0x70, 0x61, 0x71, 0x75, 0x65, 0xed, 0x00, 0x04, 0xf3, 0x01, 0x40, 0x75, 0x6e,
+    0x62, 0x6c, 0xc9, 0x00, 0x88, 0x64, 0x20, 0x52, 0x47, 0x42, 0x35, 0x36, 0x35, 0x04, 0x01, 0x02,
+    0xe6, 0x00, 0x01, 0x07, 0x03, 0x31, 0x64, 0x3b, 0x20, 0x28, 0x00, 0x02, 0xcc, 0x00, 0x22, 0x41,
+    0x38, 0x8a, 0x01, 0x02, 0x6e, 0x03, 0x00, 0xe0, 0x01, 0x10, 0x6e, 0x24, 0x01, 0x00, 0x20, 0x01,
+    0x03, 0x8a, 0x02, 0x01, 0xf8, 0x00, 0x04, 0x92, 0x01, 0xe3, 0x4b, 0x45, 0x59, 0x42, 0x4f, 0x41,
+    0x52, 0x44, 0x5f, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5e, 0x03, 0x00, 0x3d, 0x01, 0xb4, 0x20, 0x65,
+    0x61, 0x63, 0x68, 0x20, 0x6c, 0x61, 0x79, 0x65, 0x72, 0xef, 0x01, 0x37, 0x69, 0x64, 0x6c, 0x29,
+    0x02, 0x30, 0x6f, 0x6e, 0x63, 0x11, 0x02, 0xa0, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x50, 0x53, 0x52,
+    0x41, 0x4d, 0xd9, 0x00, 0x31, 0x6d, 0x61, 0x70, 0x86, 0x00, 0x03, 0xae, 0x02, 0x80, 0x69, 0x6e,
+    0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0xec, 0x02, 0x05, 0x39, 0x00, 0x31, 0x72, 0x65, 0x67, 0xa3,
+    0x03, 0x21, 0x62, 0x79, 0xcb, 0x00, 0x00, 0x96, 0x03, 0x41, 0x66, 0x72, 0x6f, 0x6d, 0x63, 0x00,
+    0x03, 0x43, 0x00, 0x05, 0x68, 0x03, 0x00, 0x7e, 0x00, 0x00, 0xbb, 0x03, 0x44, 0x6e, 0x3b, 0x20,
+    0x61, 0x0f, 0x00, 0x52, 0x77, 0x69, 0x74, 0x63, 0x68, 0x7f, 0x01, 0x58, 0x73, 0x77, 0x61, 0x70,
+    0x73, 0x39, 0x00, 0x10, 0x28, 0x0c, 0x00, 0xc2, 0x65, 0x6d, 0x6f, 0x6a, 0x69, 0x20, 0x70, 0x69,
+    0x63, 0x6b, 0x65, 0x72, 0x6f, 0x03, 0x03, 0xa3, 0x02, 0x01, 0x02, 0x02, 0x30, 0x20, 0x70, 0x65,
+    0xcb, 0x01, 0x33, 0x67, 0x65, 0x29, 0x7f, 0x01, 0x02, 0x4b, 0x03, 0x70, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x69, 0x73, 0xd4, 0x02, 0x10, 0x73, 0x58, 0x02, 0x25, 0x6f, 0x72, 0x34, 0x04, 0x00, 0xda,
+    0x03, 0x74, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x20, 0x03, 0x00, 0x2a, 0x00, 0x02, 0x5c,
+    0x01, 0x00, 0x62, 0x04, 0x31, 0x2e, 0x20, 0x42, 0xee, 0x01, 0x01, 0x35, 0x03, 0x33, 0x6f, 0x75,
+    0x74, 0x10, 0x01, 0x70, 0x66, 0x61, 0x6c, 0x6c, 0x20, 0x62, 0x61, 0xd3, 0x02, 0x11, 0x6f, 0x2e,
+    0x00, 0x00, 0x4d, 0x00, 0x0a, 0x6d, 0x03, 0x01, 0x3d, 0x00, 0x11, 0x57, 0x0b, 0x05, 0x04, 0xe2,
+    0x04, 0x12, 0x60, 0x76, 0x03, 0x38, 0x75, 0x6c, 0x6c, 0x33, 0x01, 0x06, 0xfd, 0x03, 0x20, 0x69,
+    0x73, 0xb0, 0x02, 0x16, 0x67, 0xdc, 0x03, 0x03, 0xec, 0x04, 0x25, 0x6e, 0x64, 0x7f, 0x00, 0x00,
+    0x41, 0x00, 0x54, 0x63, 0x61, 0x63, 0x68, 0x65, 0xe6, 0x01, 0xf1, 0x00, 0x46, 0x4c, 0x55, 0x53,
+    0x48, 0x5f, 0x53, 0x43, 0x48, 0x45, 0x44, 0x55, 0x4c, 0x45, 0x52, 0xfb, 0x03, 0x48, 0x6b, 0x65,
+    0x65, 0x70, 0x17, 0x02, 0x40, 0x6a, 0x6f, 0x69, 0x6e, 0xa1, 0x00, 0x28, 0x6f, 0x66, 0xb7, 0x01,
+    0x00, 0x46, 0x02, 0x28, 0x61, 0x73, 0xf9, 0x03, 0x43, 0x6d, 0x65, 0x72, 0x67, 0xc9, 0x00, 0x10,
+    0x6d, 0xc4, 0x01, 0x40, 0x6d, 0x6f, 0x64, 0x65, 0xd1, 0x05, 0xdb, 0x70, 0x61, 0x6e, 0x65, 0x6c,
+    0x20, 0x63, 0x6f, 0x73, 0x74, 0x20, 0x28, 0x60, 0x71, 0x00, 0xf0, 0x09, 0x5f, 0x54, 0x58, 0x5f,
+    0x4f, 0x56, 0x45, 0x52, 0x48, 0x45, 0x41, 0x44, 0x5f, 0x42, 0x59, 0x54, 0x45, 0x53, 0x60, 0x29,
+    0x2e, 0x20, 0x42, 0x79, 0xae, 0x04, 0x01, 0xee, 0x02, 0x62, 0x72, 0x61, 0x6e, 0x73, 0x61, 0x63,
+    0xbb, 0x05, 0x40, 0x73, 0x65, 0x6e, 0x74, 0x32, 0x01, 0x01, 0x62, 0x04, 0x00, 0x55, 0x00, 0x10,
+    0x2c, 0xb3, 0x01, 0x00, 0x9a, 0x05, 0x21, 0x6d, 0x65, 0x2e, 0x00, 0x00, 0x0e, 0x00, 0x05, 0x7e,
+    0x05, 0x06, 0x22, 0x05, 0x04, 0x89, 0x00, 0x32, 0x62, 0x75, 0x73, 0x2a, 0x01, 0x0e, 0x87, 0x00,
+    0x9f, 0x42, 0x55, 0x53, 0x5f, 0x48, 0x5a, 0x60, 0x2c, 0x20, 0xa1, 0x00, 0x0a, 0x41, 0x55, 0x53,
+    0x60, 0x29, 0x3e, 0x03, 0x03, 0x68, 0x01, 0x0c, 0xa6, 0x05, 0x20, 0x65, 0x69, 0xd0, 0x03, 0x44,
+    0x20, 0x77, 0x61, 0x79, 0x60, 0x01, 0xf5, 0x01, 0x4c, 0x56, 0x5f, 0x43, 0x4f, 0x4c, 0x4f, 0x52,
+    0x5f, 0x44, 0x45, 0x50, 0x54, 0x48, 0x3d, 0x38, 0x46, 0x03, 0x00, 0xa2, 0x05, 0x11, 0x38, 0xf2,
+    0x03, 0x80, 0x67, 0x72, 0x61, 0x79, 0x20, 0x6c, 0x65, 0x76, 0xb9, 0x04, 0x42, 0x28, 0x68, 0x61,
+    0x6c, 0xe2, 0x02, 0x01, 0xd7, 0x01, 0x40, 0x62, 0x75, 0x66, 0x66, 0xac, 0x04, 0x05, 0x0f, 0x01,
+    0x03, 0x3c, 0x00, 0xa1, 0x62, 0x61, 0x6e, 0x64, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x16, 0x00,
+    0x31, 0x65, 0x78, 0x70, 0xeb, 0x00, 0x07, 0x1a, 0x01, 0x25, 0x27, 0x73, 0x1b, 0x04, 0x02, 0x7f,
+    0x04, 0x01, 0x7b, 0x06, 0x02, 0xa9, 0x04, 0x03, 0xcd, 0x04, 0x00, 0xef, 0x03, 0x50, 0x6b, 0x75,
+    0x70, 0x20, 0x74, 0xa6, 0x04, 0x12, 0x73, 0xe7, 0x02, 0x4a, 0x74, 0x69, 0x6e, 0x74, 0x89, 0x02,
+    0x65, 0x6f, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x4b, 0x01, 0x04, 0x05, 0x03, 0x00, 0x19, 0x03, 0x52,
+    0x67, 0x72, 0x65, 0x65, 0x6e, 0x08, 0x05, 0x41, 0x73, 0x70, 0x6c, 0x69, 0x1b, 0x05, 0x0a, 0xbb,
+    0x00, 0x50, 0x72, 0x20, 0x69, 0x73, 0x20,
+};
+
+static const uint8_t prose_ours[] = {
+    0xf1, 0x04, 0x23, 0x23, 0x20, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f,
+    0x6e, 0x73, 0x0a, 0x0a, 0x4f, 0x09, 0x00, 0xf0, 0x10, 0x61, 0x6c, 0x20, 0x66, 0x65, 0x61, 0x74,
+    0x75, 0x72, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x60, 0x62, 0x33, 0x00, 0xf1, 0x3f, 0x5f, 0x66, 0x6c, 0x61,
+    0x67, 0x73, 0x60, 0x20, 0x69, 0x6e, 0x20, 0x60, 0x70, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d,
+    0x69, 0x6f, 0x2e, 0x69, 0x6e, 0x69, 0x60, 0x3a, 0x0a, 0x0a, 0x2d, 0x20, 0x60, 0x2d, 0x44, 0x20,
+    0x50, 0x45, 0x52, 0x46, 0x5f, 0x48, 0x55, 0x44, 0x3d, 0x31, 0x60, 0x3a, 0x20, 0x72, 0x65, 0x70,
+    0x6c, 0x61, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+    0x62, 0x61, 0x72, 0x20, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x7e, 0x00, 0x02, 0x5f, 0x00, 0xf0,
+    0x2d, 0x61, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x20, 0x48, 0x55, 0x44, 0x20, 0x73, 0x68, 0x6f, 0x77,
+    0x69, 0x6e, 0x67, 0x20, 0x46, 0x50, 0x53, 0x2c, 0x20, 0x43, 0x50, 0x55, 0x20, 0x6c, 0x6f, 0x61,
+    0x64, 0x2c, 0x20, 0x4c, 0x56, 0x47, 0x4c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20, 0x75, 0x73, 0x65,
+    0x64, 0x20, 0x2f, 0x20, 0x66, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x47, 0x00, 0x41,
+    0x20, 0x61, 0x6e, 0x64, 0x65, 0x00, 0xa3, 0x6c, 0x61, 0x74, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6f,
+    0x66, 0x0f, 0x00, 0xf1, 0x17, 0x73, 0x74, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x74, 0x72, 0x6f, 0x6b,
+    0x65, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x7b, 0x00, 0xf0, 0x03, 0x27,
+    0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x68, 0x65, 0x61, 0x64, 0x20, 0x69,
+    0x73, 0xc0, 0x00, 0xf1, 0x09, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+    0x20, 0x35, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x6f, 0x6e, 0x60, 0x00, 0xb5,
+    0x73, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x6c, 0x6f, 0x67, 0x2c, 0x83, 0x00, 0xb0, 0x72, 0x65,
+    0x64, 0x72, 0x61, 0x77, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x87, 0x00, 0x10, 0x61, 0x80, 0x00, 0x00,
+    0x32, 0x01, 0xb1, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x0c, 0x01,
+    0x20, 0x65, 0x73, 0x62, 0x00, 0xf3, 0x02, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x20,
+    0x61, 0x74, 0x20, 0x62, 0x6f, 0x6f, 0x74, 0x2e, 0x47, 0x01, 0xf2, 0x01, 0x47, 0x4c, 0x59, 0x50,
+    0x48, 0x5f, 0x41, 0x54, 0x4c, 0x41, 0x53, 0x3d, 0x30, 0x60, 0x3a, 0x20, 0x54, 0x00, 0x20, 0x68,
+    0x65, 0x4e, 0x00, 0xd2, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72,
+    0x73, 0x41, 0x01, 0x00, 0x61, 0x01, 0xf0, 0x01, 0x66, 0x6f, 0x6e, 0x74, 0x20, 0x65, 0x6e, 0x67,
+    0x69, 0x6e, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0xc4, 0x00, 0x03, 0x08, 0x01, 0x90, 0x70, 0x72,
+    0x65, 0x2d, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x6a, 0x00, 0xf4, 0x0d, 0x67, 0x6c, 0x79, 0x70, 0x68,
+    0x20, 0x61, 0x74, 0x6c, 0x61, 0x73, 0x20, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6d, 0x70,
+    0x61, 0x72, 0x69, 0x73, 0x6f, 0x6e, 0x29, 0x7f, 0x00, 0xf1, 0x02, 0x44, 0x52, 0x41, 0x57, 0x5f,
+    0x41, 0x53, 0x4d, 0x5f, 0x53, 0x45, 0x4c, 0x46, 0x54, 0x45, 0x53, 0x54, 0xcf, 0x01, 0x03, 0xa4,
+    0x00, 0x71, 0x2c, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x8f, 0x00, 0xf2, 0x15, 0x76, 0x65, 0x63,
+    0x74, 0x6f, 0x72, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x20, 0x2f, 0x20, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c,
+    0x73, 0xb3, 0x01, 0x21, 0x62, 0x79, 0x31, 0x00, 0x01, 0xc9, 0x01, 0x50, 0x73, 0x6f, 0x66, 0x74,
+    0x77, 0x65, 0x02, 0x03, 0x95, 0x00, 0xf0, 0x02, 0x72, 0x20, 0x62, 0x69, 0x74, 0x2d, 0x66, 0x6f,
+    0x72, 0x2d, 0x62, 0x69, 0x74, 0x20, 0x61, 0x67, 0x61, 0xc0, 0x00, 0xe1, 0x20, 0x70, 0x6c, 0x61,
+    0x69, 0x6e, 0x20, 0x43, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x73, 0x60, 0x01, 0x31, 0x6c, 0x6f, 0x67,
+    0x45, 0x00, 0xa0, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x63, 0x01, 0x00,
+    0x5a, 0x01, 0x02, 0xc6, 0x01, 0x02, 0x8e, 0x00, 0xb0, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x28,
+    0x50, 0x49, 0x45, 0x29, 0x63, 0x01, 0xa0, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69,
+    0x6c, 0xd1, 0x02, 0x04, 0xbb, 0x01, 0x91, 0x45, 0x53, 0x50, 0x33, 0x32, 0x2d, 0x53, 0x33, 0x20,
+    0x4e, 0x01, 0x21, 0x73, 0x3b, 0x58, 0x00, 0x30, 0x6f, 0x74, 0x68, 0x53, 0x01, 0x60, 0x75, 0x73,
+    0x65, 0x20, 0x33, 0x32, 0x94, 0x00, 0xa0, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x2e, 0x20,
+    0x4f, 0x45, 0x00, 0x00, 0x66, 0x01, 0x71, 0x6f, 0x70, 0x61, 0x71, 0x75, 0x65, 0x20, 0xed, 0x00,
+    0x13, 0x61, 0x76, 0x02, 0x40, 0x75, 0x6e, 0x62, 0x6c, 0x5e, 0x01, 0x88, 0x64, 0x20, 0x52, 0x47,
+    0x42, 0x35, 0x36, 0x35, 0x04, 0x01, 0x02, 0xe6, 0x00, 0x81, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x64,
+    0x3b, 0x20, 0x28, 0x00, 0x02, 0xcc, 0x00, 0x31, 0x41, 0x38, 0x20, 0x8a, 0x01, 0x02, 0x6e, 0x03,
+    0x00, 0xe0, 0x01, 0x41, 0x6e, 0x20, 0x62, 0x79, 0xe9, 0x02, 0x03, 0x8a, 0x02, 0x01, 0xf8, 0x00,
+    0x04, 0x92, 0x01, 0xe1, 0x4b, 0x45, 0x59, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5f, 0x43, 0x41, 0x43,
+    0x48, 0x45, 0x8f, 0x01, 0x02, 0x3d, 0x01, 0xb0, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6c, 0x61,
+    0x79, 0x65, 0x72, 0x0d, 0x01, 0x00, 0xa4, 0x00, 0x37, 0x69, 0x64, 0x6c, 0x29, 0x02, 0x30, 0x6f,
+    0x6e, 0x63, 0x11, 0x02, 0xa0, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x50, 0x53, 0x52, 0x41, 0x4d, 0xd9,
+    0x00, 0x40, 0x6d, 0x61, 0x70, 0x20, 0xbf, 0x00, 0x03, 0xae, 0x02, 0x80, 0x69, 0x6e, 0x76, 0x61,
+    0x6c, 0x69, 0x64, 0x61, 0xec, 0x02, 0x14, 0x6b, 0x62, 0x02, 0x30, 0x72, 0x65, 0x67, 0x21, 0x04,
+    0x00, 0x96, 0x00, 0x00, 0xcf, 0x01, 0x81, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x2a,
+    0x01, 0x12, 0x62, 0x43, 0x00, 0x03, 0x60, 0x02, 0x02, 0x7e, 0x00, 0x00, 0xbb, 0x03, 0x43, 0x6e,
+    0x3b, 0x20, 0x61, 0x8d, 0x00, 0x71, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x7f, 0x01, 0x58,
+    0x73, 0x77, 0x61, 0x70, 0x73, 0x39, 0x00, 0x10, 0x28, 0xa8, 0x00, 0xc0, 0x65, 0x6d, 0x6f, 0x6a,
+    0x69, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x65, 0x72, 0xaa, 0x01, 0x02, 0xd1, 0x00, 0x40, 0x65, 0x64,
+    0x20, 0x61, 0x02, 0x02, 0xa3, 0x20, 0x70, 0x65, 0x72, 0x20, 0x70, 0x61, 0x67, 0x65, 0x29, 0x7f,
+    0x01, 0x02, 0x4b, 0x03, 0x40, 0x74, 0x68, 0x61, 0x74, 0x2d, 0x00, 0x92, 0x70, 0x72, 0x65, 0x73,
+    0x73, 0x65, 0x64, 0x20, 0x6f, 0x79, 0x00, 0x00, 0x9e, 0x00, 0x90, 0x69, 0x74, 0x73, 0x20, 0x73,
+    0x65, 0x6c, 0x65, 0x63, 0xc7, 0x00, 0x02, 0x20, 0x03, 0x00, 0x2a, 0x00, 0x02, 0x5c, 0x01, 0x00,
+    0x62, 0x04, 0x30, 0x2e, 0x20, 0x42, 0x3c, 0x03, 0x02, 0x35, 0x03, 0x33, 0x6f, 0x75, 0x74, 0x10,
+    0x01, 0x70, 0x66, 0x61, 0x6c, 0x6c, 0x20, 0x62, 0x61, 0xd3, 0x02, 0x11, 0x6f, 0x6a, 0x03, 0x00,
+    0x4d, 0x00, 0x19, 0x74, 0x6d, 0x03, 0x10, 0x69, 0x3d, 0x00, 0x11, 0x57, 0x0b, 0x05, 0x13, 0x50,
+    0xe2, 0x04, 0x11, 0x60, 0xd0, 0x00, 0x46, 0x66, 0x75, 0x6c, 0x6c, 0x95, 0x03, 0x03, 0x4f, 0x01,
+    0x01, 0xfd, 0x03, 0x20, 0x69, 0x73, 0x19, 0x04, 0x10, 0x67, 0xcf, 0x00, 0x02, 0xdc, 0x03, 0x20,
+    0x20, 0x77, 0x40, 0x00, 0x31, 0x61, 0x6e, 0x64, 0x09, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x64, 0x00,
+    0x54, 0x63, 0x61, 0x63, 0x68, 0x65, 0xe6, 0x01, 0xf1, 0x00, 0x46, 0x4c, 0x55, 0x53, 0x48, 0x5f,
+    0x53, 0x43, 0x48, 0x45, 0x44, 0x55, 0x4c, 0x45, 0x52, 0xfb, 0x03, 0x48, 0x6b, 0x65, 0x65, 0x70,
+    0x17, 0x02, 0x40, 0x6a, 0x6f, 0x69, 0x6e, 0xa1, 0x00, 0x38, 0x6f, 0x66, 0x20, 0xb7, 0x01, 0x60,
+    0x61, 0x72, 0x65, 0x61, 0x73, 0x20, 0x39, 0x03, 0x03, 0xf9, 0x03, 0x40, 0x6d, 0x65, 0x72, 0x67,
+    0x28, 0x00, 0x40, 0x74, 0x68, 0x65, 0x6d, 0xc4, 0x01, 0x40, 0x6d, 0x6f, 0x64, 0x65, 0xd1, 0x05,
+    0xdb, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x20, 0x63, 0x6f, 0x73, 0x74, 0x20, 0x28, 0x60, 0x71, 0x00,
+    0xf1, 0x0c, 0x5f, 0x54, 0x58, 0x5f, 0x4f, 0x56, 0x45, 0x52, 0x48, 0x45, 0x41, 0x44, 0x5f, 0x42,
+    0x59, 0x54, 0x45, 0x53, 0x60, 0x29, 0x2e, 0x20, 0x42, 0x79, 0x74, 0x65, 0x73, 0x2f, 0x02, 0x70,
+    0x74, 0x72, 0x61, 0x6e, 0x73, 0x61, 0x63, 0x74, 0x05, 0x60, 0x73, 0x20, 0x73, 0x65, 0x6e, 0x74,
+    0x32, 0x01, 0x41, 0x74, 0x68, 0x65, 0x20, 0x55, 0x00, 0x11, 0x2c, 0xb3, 0x01, 0x51, 0x66, 0x72,
+    0x61, 0x6d, 0x65, 0x2e, 0x00, 0x00, 0xc1, 0x01, 0x05, 0x7e, 0x05, 0x11, 0x2c, 0x13, 0x00, 0x00,
+    0x2c, 0x00, 0x04, 0x89, 0x00, 0x32, 0x62, 0x75, 0x73, 0x27, 0x05, 0x1d, 0x28, 0x87, 0x00, 0x9d,
+    0x42, 0x55, 0x53, 0x5f, 0x48, 0x5a, 0x60, 0x2c, 0x20, 0x1a, 0x00, 0x08, 0xa1, 0x00, 0x50, 0x55,
+    0x53, 0x60, 0x29, 0x20, 0x61, 0x03, 0x12, 0x6c, 0x68, 0x01, 0x48, 0x65, 0x76, 0x65, 0x72, 0xa6,
+    0x05, 0x20, 0x65, 0x69, 0xd0, 0x03, 0x44, 0x20, 0x77, 0x61, 0x79, 0x60, 0x01, 0xf5, 0x02, 0x4c,
+    0x56, 0x5f, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f, 0x44, 0x45, 0x50, 0x54, 0x48, 0x3d, 0x38, 0x60,
+    0x46, 0x03, 0x40, 0x69, 0x6e, 0x20, 0x38, 0x19, 0x03, 0x90, 0x20, 0x67, 0x72, 0x61, 0x79, 0x20,
+    0x6c, 0x65, 0x76, 0xb9, 0x04, 0x51, 0x28, 0x68, 0x61, 0x6c, 0x66, 0xe7, 0x01, 0x00, 0x44, 0x02,
+    0x95, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x62, 0x0f, 0x01, 0x20, 0x72, 0x65, 0x54,
+    0x05, 0xb1, 0x20, 0x62, 0x61, 0x6e, 0x64, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0xe4, 0x00, 0x30,
+    0x65, 0x78, 0x70, 0xe5, 0x01, 0x17, 0x74, 0x1a, 0x01, 0x52, 0x27, 0x73, 0x20, 0x52, 0x47, 0x1b,
+    0x04, 0x11, 0x6e, 0x50, 0x00, 0x01, 0x7b, 0x06, 0x02, 0xa9, 0x04, 0x12, 0x74, 0xcd, 0x04, 0xd0,
+    0x20, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2c, 0x03, 0x50,
+    0x61, 0x74, 0x20, 0x74, 0x69, 0x62, 0x01, 0x18, 0x68, 0xcd, 0x03, 0x42, 0x72, 0x61, 0x6e, 0x67,
+    0x5e, 0x01, 0x00, 0x4b, 0x01, 0x22, 0x70, 0x72, 0x05, 0x03, 0x92, 0x6b, 0x65, 0x79, 0x20, 0x67,
+    0x72, 0x65, 0x65, 0x6e, 0x08, 0x05, 0x7c, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x6f, 0xbb, 0x00,
+    0x50, 0x72, 0x20, 0x69, 0x73, 0x20,
+};
+
+static const uint8_t runs_text[] = {
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61,
+    0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62,
+    0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+    0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61,
+    0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62,
+    0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+    0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61,
+    0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62,
+    0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+    0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61,
+    0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62,
+    0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+    0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61,
+    0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62,
+    0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+    0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61,
+    0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62,
+    0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+    0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61,
+    0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62,
+    0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+    0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61,
+    0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62,
+    0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+    0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61,
+    0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62,
+    0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63,
+    0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0x61,
+    0x62, 0x63, 0x6f, 0x6a, 0x6b, 0x77, 0x74, 0x7a, 0x63, 0x62, 0x75, 0x78, 0x62, 0x6a, 0x71, 0x77,
+    0x6b, 0x73, 0x74, 0x6c, 0x61, 0x72, 0x69, 0x68, 0x74, 0x76, 0x66, 0x66, 0x79, 0x77, 0x68, 0x6b,
+    0x6b, 0x66, 0x77, 0x62, 0x68, 0x77, 0x6d, 0x68, 0x6f, 0x74, 0x70, 0x67, 0x64, 0x64, 0x74, 0x6b,
+    0x6e, 0x69, 0x64, 0x68, 0x6b, 0x79, 0x79, 0x71, 0x69, 0x6d, 0x75, 0x6c, 0x6b, 0x6a, 0x63, 0x7a,
+    0x69, 0x63, 0x6d, 0x67, 0x70, 0x63, 0x71, 0x67, 0x7a, 0x69, 0x75, 0x6d, 0x76, 0x67, 0x76, 0x71,
+    0x6a, 0x6d, 0x66, 0x76, 0x77, 0x78, 0x6e, 0x72, 0x62, 0x65, 0x76, 0x64, 0x77, 0x68, 0x64, 0x79,
+    0x73, 0x6a, 0x6d, 0x79, 0x70, 0x73, 0x79, 0x6f, 0x6e, 0x68, 0x67, 0x6e, 0x6f, 0x76, 0x63, 0x61,
+    0x72, 0x6e, 0x72, 0x69, 0x6b, 0x73, 0x6a, 0x70, 0x73, 0x70, 0x66, 0x6f, 0x6b, 0x78, 0x6b, 0x68,
+    0x78, 0x77, 0x79, 0x62, 0x77, 0x7a, 0x6e, 0x7a, 0x68, 0x7a, 0x61, 0x6c, 0x6e, 0x77, 0x7a, 0x6a,
+    0x61, 0x79, 0x67, 0x76, 0x77, 0x78, 0x68, 0x62, 0x66, 0x7a, 0x66, 0x69, 0x75, 0x7a, 0x71, 0x7a,
+    0x72, 0x76, 0x6b, 0x70, 0x75, 0x6e, 0x77, 0x75, 0x70, 0x6d, 0x72, 0x63, 0x6a, 0x6a, 0x72, 0x64,
+    0x6b, 0x77, 0x66, 0x74, 0x68, 0x6d, 0x74, 0x78, 0x6e, 0x78, 0x69, 0x75, 0x6e, 0x63, 0x74, 0x79,
+    0x6f, 0x70, 0x62, 0x6c, 0x65, 0x73, 0x6d, 0x6a, 0x6b, 0x61, 0x69, 0x61, 0x79, 0x74, 0x66, 0x61,
+    0x69, 0x76, 0x74, 0x73, 0x67, 0x64, 0x68, 0x6e, 0x78, 0x6a, 0x74, 0x74, 0x66, 0x69, 0x62, 0x73,
+    0x6d, 0x78, 0x78, 0x76, 0x68, 0x73, 0x75, 0x64, 0x75, 0x74, 0x6c, 0x74, 0x69, 0x70, 0x63, 0x62,
+    0x6c, 0x67, 0x78, 0x73, 0x72, 0x6f, 0x7a, 0x65, 0x69, 0x79, 0x6b, 0x61, 0x7a, 0x74, 0x72, 0x75,
+    0x61, 0x71, 0x66, 0x74, 0x6c, 0x78, 0x71, 0x72, 0x66, 0x6d, 0x66, 0x78, 0x6e, 0x76, 0x74, 0x77,
+    0x62, 0x75, 0x66, 0x77, 0x6c, 0x75, 0x6f, 0x71, 0x61, 0x67, 0x73, 0x69, 0x6f, 0x7a, 0x6a, 0x72,
+    0x6c, 0x78, 0x62, 0x75, 0x71, 0x61, 0x75, 0x72, 0x6e, 0x76, 0x74, 0x61, 0x64, 0x69, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x6f, 0x6a, 0x6b, 0x77, 0x74, 0x7a,
+    0x63, 0x62, 0x75, 0x78, 0x62, 0x6a, 0x71, 0x77, 0x6b, 0x73, 0x74, 0x6c, 0x61, 0x72, 0x69, 0x68,
+    0x74, 0x76, 0x66, 0x66, 0x79, 0x77, 0x68, 0x6b, 0x6b, 0x66, 0x77, 0x62, 0x68, 0x77, 0x6d, 0x68,
+    0x6f, 0x74, 0x70, 0x67, 0x64, 0x64, 0x74, 0x6b, 0x6e, 0x69, 0x64, 0x68, 0x6b, 0x79, 0x79, 0x71,
+    0x69, 0x6d, 0x75, 0x6c, 0x6b, 0x6a, 0x63, 0x7a, 0x69, 0x63, 0x6d, 0x67, 0x70, 0x63, 0x71, 0x67,
+    0x7a, 0x69, 0x75, 0x6d, 0x76, 0x67, 0x76, 0x71, 0x6a, 0x6d, 0x66, 0x76, 0x77, 0x78, 0x6e, 0x72,
+    0x62, 0x65, 0x76, 0x64, 0x77, 0x68, 0x64, 0x79, 0x73, 0x6a, 0x6d, 0x79, 0x70, 0x73, 0x79, 0x6f,
+    0x6e, 0x68, 0x67, 0x6e, 0x6f, 0x76, 0x63, 0x61, 0x72, 0x6e, 0x72, 0x69, 0x6b, 0x73, 0x6a, 0x70,
+    0x73, 0x70, 0x66, 0x6f, 0x6b, 0x78, 0x6b, 0x68, 0x78, 0x77, 0x79, 0x62, 0x77, 0x7a, 0x6e, 0x7a,
+    0x68, 0x7a, 0x61, 0x6c, 0x6e, 0x77, 0x7a, 0x6a, 0x61, 0x79, 0x67, 0x76, 0x77, 0x78, 0x68, 0x62,
+    0x66, 0x7a, 0x66, 0x69, 0x75, 0x7a, 0x71, 0x7a, 0x72, 0x76, 0x6b, 0x70, 0x75, 0x6e, 0x77, 0x75,
+    0x70, 0x6d, 0x72, 0x63, 0x6a, 0x6a, 0x72, 0x64, 0x6b, 0x77, 0x66, 0x74, 0x68, 0x6d, 0x74, 0x78,
+    0x6e, 0x78, 0x69, 0x75, 0x6e, 0x63, 0x74, 0x79, 0x6f, 0x70, 0x62, 0x6c, 0x65, 0x73, 0x6d, 0x6a,
+    0x6b, 0x61, 0x69, 0x61, 0x79, 0x74, 0x66, 0x61, 0x69, 0x76, 0x74, 0x73, 0x67, 0x64, 0x68, 0x6e,
+    0x78, 0x6a, 0x74, 0x74, 0x66, 0x69, 0x62, 0x73, 0x6d, 0x78, 0x78, 0x76, 0x68, 0x73, 0x75, 0x64,
+    0x75, 0x74, 0x6c, 0x74, 0x69, 0x70, 0x63, 0x62, 0x6c, 0x67, 0x78, 0x73, 0x72, 0x6f, 0x7a, 0x65,
+    0x69, 0x79, 0x6b, 0x61, 0x7a, 0x74, 0x72, 0x75, 0x61, 0x71, 0x66, 0x74, 0x6c, 0x78, 0x71, 0x72,
+    0x66, 0x6d, 0x66, 0x78, 0x6e, 0x76, 0x74, 0x77, 0x62, 0x75, 0x66, 0x77, 0x6c, 0x75, 0x6f, 0x71,
+    0x61, 0x67, 0x73, 0x69, 0x6f, 0x7a, 0x6a, 0x72, 0x6c, 0x78, 0x62, 0x75, 0x71, 0x61, 0x75, 0x72,
+    0x6e, 0x76, 0x74, 0x61, 0x64, 0x69, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78,
+    0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79,
+    0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a,
+    0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78,
+    0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79,
+    0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a,
+    0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78,
+    0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79,
+    0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a,
+    0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78,
+    0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79,
+    0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a,
+    0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78,
+    0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79,
+    0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a,
+    0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78,
+    0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79,
+    0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a,
+    0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78, 0x79, 0x7a, 0x78,
+};
+
+static const uint8_t runs_lz4_fast[] = {
+    0x1f, 0x3d, 0x01, 0x00, 0xff, 0x7d, 0x3f, 0x61, 0x62, 0x63, 0x03, 0x00, 0xff, 0xad, 0xff, 0xff,
+    0x1f, 0x6f, 0x6a, 0x6b, 0x77, 0x74, 0x7a, 0x63, 0x62, 0x75, 0x78, 0x62, 0x6a, 0x71, 0x77, 0x6b,
+    0x73, 0x74, 0x6c, 0x61, 0x72, 0x69, 0x68, 0x74, 0x76, 0x66, 0x66, 0x79, 0x77, 0x68, 0x6b, 0x6b,
+    0x66, 0x77, 0x62, 0x68, 0x77, 0x6d, 0x68, 0x6f, 0x74, 0x70, 0x67, 0x64, 0x64, 0x74, 0x6b, 0x6e,
+    0x69, 0x64, 0x68, 0x6b, 0x79, 0x79, 0x71, 0x69, 0x6d, 0x75, 0x6c, 0x6b, 0x6a, 0x63, 0x7a, 0x69,
+    0x63, 0x6d, 0x67, 0x70, 0x63, 0x71, 0x67, 0x7a, 0x69, 0x75, 0x6d, 0x76, 0x67, 0x76, 0x71, 0x6a,
+    0x6d, 0x66, 0x76, 0x77, 0x78, 0x6e, 0x72, 0x62, 0x65, 0x76, 0x64, 0x77, 0x68, 0x64, 0x79, 0x73,
+    0x6a, 0x6d, 0x79, 0x70, 0x73, 0x79, 0x6f, 0x6e, 0x68, 0x67, 0x6e, 0x6f, 0x76, 0x63, 0x61, 0x72,
+    0x6e, 0x72, 0x69, 0x6b, 0x73, 0x6a, 0x70, 0x73, 0x70, 0x66, 0x6f, 0x6b, 0x78, 0x6b, 0x68, 0x78,
+    0x77, 0x79, 0x62, 0x77, 0x7a, 0x6e, 0x7a, 0x68, 0x7a, 0x61, 0x6c, 0x6e, 0x77, 0x7a, 0x6a, 0x61,
+    0x79, 0x67, 0x76, 0x77, 0x78, 0x68, 0x62, 0x66, 0x7a, 0x66, 0x69, 0x75, 0x7a, 0x71, 0x7a, 0x72,
+    0x76, 0x6b, 0x70, 0x75, 0x6e, 0x77, 0x75, 0x70, 0x6d, 0x72, 0x63, 0x6a, 0x6a, 0x72, 0x64, 0x6b,
+    0x77, 0x66, 0x74, 0x68, 0x6d, 0x74, 0x78, 0x6e, 0x78, 0x69, 0x75, 0x6e, 0x63, 0x74, 0x79, 0x6f,
+    0x70, 0x62, 0x6c, 0x65, 0x73, 0x6d, 0x6a, 0x6b, 0x61, 0x69, 0x61, 0x79, 0x74, 0x66, 0x61, 0x69,
+    0x76, 0x74, 0x73, 0x67, 0x64, 0x68, 0x6e, 0x78, 0x6a, 0x74, 0x74, 0x66, 0x69, 0x62, 0x73, 0x6d,
+    0x78, 0x78, 0x76, 0x68, 0x73, 0x75, 0x64, 0x75, 0x74, 0x6c, 0x74, 0x69, 0x70, 0x63, 0x62, 0x6c,
+    0x67, 0x78, 0x73, 0x72, 0x6f, 0x7a, 0x65, 0x69, 0x79, 0x6b, 0x61, 0x7a, 0x74, 0x72, 0x75, 0x61,
+    0x71, 0x66, 0x74, 0x6c, 0x78, 0x71, 0x72, 0x66, 0x6d, 0x66, 0x78, 0x6e, 0x76, 0x74, 0x77, 0x62,
+    0x75, 0x66, 0x77, 0x6c, 0x75, 0x6f, 0x71, 0x61, 0x67, 0x73, 0x69, 0x6f, 0x7a, 0x6a, 0x72, 0x6c,
+    0x78, 0x62, 0x75, 0x71, 0x61, 0x75, 0x72, 0x6e, 0x76, 0x74, 0x61, 0x64, 0x69, 0x3d, 0x7f, 0x04,
+    0xff, 0x19, 0x0f, 0x58, 0x02, 0xff, 0x1a, 0x3f, 0x78, 0x79, 0x7a, 0x03, 0x00, 0xff, 0x10, 0x50,
+    0x7a, 0x78, 0x79, 0x7a, 0x78,
+};
+
+static const uint8_t runs_lz4_hc[] = {
+    0x1f, 0x3d, 0x01, 0x00, 0xff, 0x7d, 0x3f, 0x61, 0x62, 0x63, 0x03, 0x00, 0xff, 0xad, 0xff, 0xff,
+    0x1e, 0x6f, 0x6a, 0x6b, 0x77, 0x74, 0x7a, 0x63, 0x62, 0x75, 0x78, 0x62, 0x6a, 0x71, 0x77, 0x6b,
+    0x73, 0x74, 0x6c, 0x61, 0x72, 0x69, 0x68, 0x74, 0x76, 0x66, 0x66, 0x79, 0x77, 0x68, 0x6b, 0x6b,
+    0x66, 0x77, 0x62, 0x68, 0x77, 0x6d, 0x68, 0x6f, 0x74, 0x70, 0x67, 0x64, 0x64, 0x74, 0x6b, 0x6e,
+    0x69, 0x64, 0x68, 0x6b, 0x79, 0x79, 0x71, 0x69, 0x6d, 0x75, 0x6c, 0x6b, 0x6a, 0x63, 0x7a, 0x69,
+    0x63, 0x6d, 0x67, 0x70, 0x63, 0x71, 0x67, 0x7a, 0x69, 0x75, 0x6d, 0x76, 0x67, 0x76, 0x71, 0x6a,
+    0x6d, 0x66, 0x76, 0x77, 0x78, 0x6e, 0x72, 0x62, 0x65, 0x76, 0x64, 0x77, 0x68, 0x64, 0x79, 0x73,
+    0x6a, 0x6d, 0x79, 0x70, 0x73, 0x79, 0x6f, 0x6e, 0x68, 0x67, 0x6e, 0x6f, 0x76, 0x63, 0x61, 0x72,
+    0x6e, 0x72, 0x69, 0x6b, 0x73, 0x6a, 0x70, 0x73, 0x70, 0x66, 0x6f, 0x6b, 0x78, 0x6b, 0x68, 0x78,
+    0x77, 0x79, 0x62, 0x77, 0x7a, 0x6e, 0x7a, 0x68, 0x7a, 0x61, 0x6c, 0x6e, 0x77, 0x7a, 0x6a, 0x61,
+    0x79, 0x67, 0x76, 0x77, 0x78, 0x68, 0x62, 0x66, 0x7a, 0x66, 0x69, 0x75, 0x7a, 0x71, 0x7a, 0x72,
+    0x76, 0x6b, 0x70, 0x75, 0x6e, 0x77, 0x75, 0x70, 0x6d, 0x72, 0x63, 0x6a, 0x6a, 0x72, 0x64, 0x6b,
+    0x77, 0x66, 0x74, 0x68, 0x6d, 0x74, 0x78, 0x6e, 0x78, 0x69, 0x75, 0x6e, 0x63, 0x74, 0x79, 0x6f,
+    0x70, 0x62, 0x6c, 0x65, 0x73, 0x6d, 0x6a, 0x6b, 0x61, 0x69, 0x61, 0x79, 0x74, 0x66, 0x61, 0x69,
+    0x76, 0x74, 0x73, 0x67, 0x64, 0x68, 0x6e, 0x78, 0x6a, 0x74, 0x74, 0x66, 0x69, 0x62, 0x73, 0x6d,
+    0x78, 0x78, 0x76, 0x68, 0x73, 0x75, 0x64, 0x75, 0x74, 0x6c, 0x74, 0x69, 0x70, 0x63, 0x62, 0x6c,
+    0x67, 0x78, 0x73, 0x72, 0x6f, 0x7a, 0x65, 0x69, 0x79, 0x6b, 0x61, 0x7a, 0x74, 0x72, 0x75, 0x61,
+    0x71, 0x66, 0x74, 0x6c, 0x78, 0x71, 0x72, 0x66, 0x6d, 0x66, 0x78, 0x6e, 0x76, 0x74, 0x77, 0x62,
+    0x75, 0x66, 0x77, 0x6c, 0x75, 0x6f, 0x71, 0x61, 0x67, 0x73, 0x69, 0x6f, 0x7a, 0x6a, 0x72, 0x6c,
+    0x78, 0x62, 0x75, 0x71, 0x61, 0x75, 0x72, 0x6e, 0x76, 0x74, 0x61, 0x64, 0x69, 0x1a, 0x04, 0xff,
+    0x1a, 0x0f, 0x58, 0x02, 0xff, 0x1a, 0x3f, 0x78, 0x79, 0x7a, 0x03, 0x00, 0xff, 0x10, 0x50, 0x7a,
+    0x78, 0x79, 0x7a, 0x78,
+};
+
+static const uint8_t runs_ours[] = {
+    0x1f, 0x3d, 0x01, 0x00, 0xff, 0x7d, 0x3f, 0x61, 0x62, 0x63, 0x03, 0x00, 0xff, 0xad, 0xff, 0xff,
+    0x1e, 0x6f, 0x6a, 0x6b, 0x77, 0x74, 0x7a, 0x63, 0x62, 0x75, 0x78, 0x62, 0x6a, 0x71, 0x77, 0x6b,
+    0x73, 0x74, 0x6c, 0x61, 0x72, 0x69, 0x68, 0x74, 0x76, 0x66, 0x66, 0x79, 0x77, 0x68, 0x6b, 0x6b,
+    0x66, 0x77, 0x62, 0x68, 0x77, 0x6d, 0x68, 0x6f, 0x74, 0x70, 0x67, 0x64, 0x64, 0x74, 0x6b, 0x6e,
+    0x69, 0x64, 0x68, 0x6b, 0x79, 0x79, 0x71, 0x69, 0x6d, 0x75, 0x6c, 0x6b, 0x6a, 0x63, 0x7a, 0x69,
+    0x63, 0x6d, 0x67, 0x70, 0x63, 0x71, 0x67, 0x7a, 0x69, 0x75, 0x6d, 0x76, 0x67, 0x76, 0x71, 0x6a,
+    0x6d, 0x66, 0x76, 0x77, 0x78, 0x6e, 0x72, 0x62, 0x65, 0x76, 0x64, 0x77, 0x68, 0x64, 0x79, 0x73,
+    0x6a, 0x6d, 0x79, 0x70, 0x73, 0x79, 0x6f, 0x6e, 0x68, 0x67, 0x6e, 0x6f, 0x76, 0x63, 0x61, 0x72,
+    0x6e, 0x72, 0x69, 0x6b, 0x73, 0x6a, 0x70, 0x73, 0x70, 0x66, 0x6f, 0x6b, 0x78, 0x6b, 0x68, 0x78,
+    0x77, 0x79, 0x62, 0x77, 0x7a, 0x6e, 0x7a, 0x68, 0x7a, 0x61, 0x6c, 0x6e, 0x77, 0x7a, 0x6a, 0x61,
+    0x79, 0x67, 0x76, 0x77, 0x78, 0x68, 0x62, 0x66, 0x7a, 0x66, 0x69, 0x75, 0x7a, 0x71, 0x7a, 0x72,
+    0x76, 0x6b, 0x70, 0x75, 0x6e, 0x77, 0x75, 0x70, 0x6d, 0x72, 0x63, 0x6a, 0x6a, 0x72, 0x64, 0x6b,
+    0x77, 0x66, 0x74, 0x68, 0x6d, 0x74, 0x78, 0x6e, 0x78, 0x69, 0x75, 0x6e, 0x63, 0x74, 0x79, 0x6f,
+    0x70, 0x62, 0x6c, 0x65, 0x73, 0x6d, 0x6a, 0x6b, 0x61, 0x69, 0x61, 0x79, 0x74, 0x66, 0x61, 0x69,
+    0x76, 0x74, 0x73, 0x67, 0x64, 0x68, 0x6e, 0x78, 0x6a, 0x74, 0x74, 0x66, 0x69, 0x62, 0x73, 0x6d,
+    0x78, 0x78, 0x76, 0x68, 0x73, 0x75, 0x64, 0x75, 0x74, 0x6c, 0x74, 0x69, 0x70, 0x63, 0x62, 0x6c,
+    0x67, 0x78, 0x73, 0x72, 0x6f, 0x7a, 0x65, 0x69, 0x79, 0x6b, 0x61, 0x7a, 0x74, 0x72, 0x75, 0x61,
+    0x71, 0x66, 0x74, 0x6c, 0x78, 0x71, 0x72, 0x66, 0x6d, 0x66, 0x78, 0x6e, 0x76, 0x74, 0x77, 0x62,
+    0x75, 0x66, 0x77, 0x6c, 0x75, 0x6f, 0x71, 0x61, 0x67, 0x73, 0x69, 0x6f, 0x7a, 0x6a, 0x72, 0x6c,
+    0x78, 0x62, 0x75, 0x71, 0x61, 0x75, 0x72, 0x6e, 0x76, 0x74, 0x61, 0x64, 0x69, 0x7d, 0x04, 0xff,
+    0x1a, 0x0f, 0x58, 0x02, 0xff, 0x1a, 0x3f, 0x78, 0x79, 0x7a, 0x03, 0x00, 0xff, 0x10, 0x50, 0x7a,
+    0x78, 0x79, 0x7a, 0x78,
+};
@@ -0,0 +1,266 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "doc_store.h"
+#include "lz4_blocks.h"
+
+#define BLOCK DOC_STORE_BLOCK_SIZE
+#define CAP (BLOCK + BLOCK / 255 + 16) // Room for any block, even one that does not compress
+#define DOC_MAX (24 * BLOCK)
+#define MORE (4 * BLOCK + 10) // An append that seals 4 blocks or 5
+
+static uint8_t packed[CAP];
+static char text[BLOCK];
+static char unpacked[BLOCK + 1];
+static char doc_text[DOC_MAX]; // Prose, repeated a little differently each time
+static uint32_t rng_state;
+
+// xorshift32, so every run of the test sees the same bytes
+static uint32_t rng()
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Compresses and decompresses len bytes of src; returns the compressed size
+static uint32_t round_trip(const char *src, uint32_t len)
+{
+    uint32_t size = doc_store_compress(src, len, packed, CAP);
+    TEST_ASSERT_TRUE(size > 0);
+    int32_t out = doc_store_decompress(packed, size, unpacked, BLOCK);
+    TEST_ASSERT_EQUAL(len, out);
+    TEST_ASSERT_EQUAL_MEMORY(src, unpacked, len);
+    return size;
+}
+
+void setUp()
+{
+    for (uint32_t i = 0; i < DOC_MAX; i++)
+        doc_text[i] = prose_text[(i + i / sizeof(prose_text)) % sizeof(prose_text)];
+    rng_state = 1;
+    heap_caps_fail_after = -1;
+}
+
+void tearDown()
+{
+    heap_caps_fail_after = -1;
+    doc_store_clear();
+}
+
+static void test_round_trips()
+{
+    // Empty, and short enough to be all literals
+    TEST_ASSERT_EQUAL(1, round_trip("", 0));
+    for (uint32_t len = 1; len <= 40; len++)
+        round_trip("abcabcabcabcabcabcabcabcabcabcabcabcabcabc", len);
+
+    // One byte: overlapping matches of every length around the 15 and 255 length bytes
+    memset(text, 'a', BLOCK);
+    for (uint32_t len = 1; len <= 300; len++)
+        round_trip(text, len);
+    TEST_ASSERT_TRUE(round_trip(text, BLOCK) < 32);
+
+    // Random bytes do not compress and stay whole
+    for (uint32_t i = 0; i < BLOCK; i++)
+        text[i] = rng();
+    round_trip(text, BLOCK);
+
+    // Random words from a small alphabet: matches at every offset
+    for (uint32_t i = 0; i < BLOCK; i++)
+        text[i] = rng() % 7 ? 'a' + rng() % 4 : ' ';
+    round_trip(text, BLOCK);
+
+    round_trip((const char *)prose_text, sizeof(prose_text));
+    round_trip((const char *)runs_text, sizeof(runs_text));
+}
+
+static void test_capacity_bounds()
+{
+    const char *prose = (const char *)prose_text;
+    uint32_t size = doc_store_compress(prose, BLOCK, packed, CAP);
+    TEST_ASSERT_EQUAL(size, doc_store_compress(prose, BLOCK, packed, size));
+    TEST_ASSERT_EQUAL(0, doc_store_compress(prose, BLOCK, packed, size - 1));
+    TEST_ASSERT_EQUAL(0, doc_store_compress(prose, BLOCK + 1, packed, CAP));
+
+    // The text must fit in the output exactly
+    TEST_ASSERT_EQUAL(BLOCK, doc_store_decompress(packed, size, unpacked, BLOCK));
+    TEST_ASSERT_EQUAL(-1, doc_store_decompress(packed, size, unpacked, BLOCK - 1));
+    TEST_ASSERT_EQUAL(-1, doc_store_decompress(prose_lz4_fast, sizeof(prose_lz4_fast), unpacked, BLOCK - 1));
+}
+
+// What the reference compressor writes decompresses here, and the other way round
+static void test_reference_blocks()
+{
+    static const struct
+    {
+        const uint8_t *text, *block;
+        uint32_t text_len, block_len;
+    } refs[] = {
+        {prose_text, prose_lz4_fast, sizeof(prose_text), sizeof(prose_lz4_fast)},
+        {prose_text, prose_lz4_hc, sizeof(prose_text), sizeof(prose_lz4_hc)},
+        {runs_text, runs_lz4_fast, sizeof(runs_text), sizeof(runs_lz4_fast)},
+        {runs_text, runs_lz4_hc, sizeof(runs_text), sizeof(runs_lz4_hc)},
+    };
+    for (const auto &ref : refs)
+    {
+        int32_t len = doc_store_decompress(ref.block, ref.block_len, unpacked, BLOCK);
+        TEST_ASSERT_EQUAL(ref.text_len, len);
+        TEST_ASSERT_EQUAL_MEMORY(ref.text, unpacked, len);
+    }
+
+    // Byte for byte the blocks that 'lz4 -d' read when they were generated
+    uint32_t size = doc_store_compress((const char *)prose_text, sizeof(prose_text), packed, CAP);
+    TEST_ASSERT_EQUAL(sizeof(prose_ours), size);
+    TEST_ASSERT_EQUAL_MEMORY(prose_ours, packed, size);
+    size = doc_store_compress((const char *)runs_text, sizeof(runs_text), packed, CAP);
+    TEST_ASSERT_EQUAL(sizeof(runs_ours), size);
+    TEST_ASSERT_EQUAL_MEMORY(runs_ours, packed, size);
+
+    // About as small as the fast mode
+    TEST_ASSERT_TRUE(sizeof(prose_ours) <= sizeof(prose_lz4_fast) * 11 / 10);
+}
+
+static void test_malformed_blocks()
+{
+    // Every truncation of a valid block fails or gives a prefix of its text
+    for (uint32_t len = 0; len < sizeof(prose_lz4_hc); len++)
+    {
+        int32_t out = doc_store_decompress(prose_lz4_hc, len, unpacked, BLOCK);
+        TEST_ASSERT_TRUE(out < (int32_t)sizeof(prose_text));
+        if (out > 0)
+            TEST_ASSERT_EQUAL_MEMORY(prose_text, unpacked, out);
+    }
+
+    // Token 0x14: 1 literal, then a match of 8
+    const uint8_t offset_zero[] = {0x14, 'a', 0x00, 0x00};
+    TEST_ASSERT_EQUAL(-1, doc_store_decompress(offset_zero, sizeof(offset_zero), unpacked, BLOCK));
+    const uint8_t before_start[] = {0x14, 'a', 0x02, 0x00};
+    TEST_ASSERT_EQUAL(-1, doc_store_decompress(before_start, sizeof(before_start), unpacked, BLOCK));
+    const uint8_t no_offset[] = {0x14, 'a', 0x01};
+    TEST_ASSERT_EQUAL(-1, doc_store_decompress(no_offset, sizeof(no_offset), unpacked, BLOCK));
+    const uint8_t in_bounds[] = {0x14, 'a', 0x01, 0x00};
+    TEST_ASSERT_EQUAL(9, doc_store_decompress(in_bounds, sizeof(in_bounds), unpacked, BLOCK));
+    TEST_ASSERT_EQUAL(-1, doc_store_decompress(in_bounds, sizeof(in_bounds), unpacked, 8));
+
+    // Literals past the end of the block, and a literal length that does not end
+    const uint8_t short_literals[] = {0x50, 'a', 'b'};
+    TEST_ASSERT_EQUAL(-1, doc_store_decompress(short_literals, sizeof(short_literals), unpacked, BLOCK));
+    const uint8_t open_length[] = {0xf0, 0xff, 0xff};
+    TEST_ASSERT_EQUAL(-1, doc_store_decompress(open_length, sizeof(open_length), unpacked, BLOCK));
+
+    // A match longer than the output: 1 + 15 + 4 + 255 bytes
+    const uint8_t long_match[] = {0x1f, 'a', 0x01, 0x00, 0xff, 0x00};
+    TEST_ASSERT_EQUAL(-1, doc_store_decompress(long_match, sizeof(long_match), unpacked, 255));
+    TEST_ASSERT_EQUAL(275, doc_store_decompress(long_match, sizeof(long_match), unpacked, BLOCK));
+
+    // Valid blocks with a few bytes changed, and garbage, stay inside the output
+    for (int i = 0; i < 10000; i++)
+    {
+        memcpy(packed, prose_lz4_fast, sizeof(prose_lz4_fast));
+        for (int changes = 1 + rng() % 4; changes; changes--)
+            packed[rng() % sizeof(prose_lz4_fast)] = rng();
+        int32_t out = doc_store_decompress(packed, sizeof(prose_lz4_fast), unpacked, BLOCK);
+        TEST_ASSERT_TRUE(out >= -1 && out <= BLOCK);
+    }
+    for (int i = 0; i < 10000; i++)
+    {
+        uint32_t len = 1 + rng() % 64;
+        for (uint32_t b = 0; b < len; b++)
+            packed[b] = rng();
+        int32_t out = doc_store_decompress(packed, len, unpacked, BLOCK);
+        TEST_ASSERT_TRUE(out >= -1 && out <= BLOCK);
+    }
+}
+
+// The document as the store reads it back
+static void assert_document(const char *expected, uint32_t len)
+{
+    static char doc[DOC_MAX + 1];
+    TEST_ASSERT_EQUAL(len, doc_store_length());
+    TEST_ASSERT_TRUE(doc_store_read(0, doc, len));
+    TEST_ASSERT_EQUAL_MEMORY(expected, doc, len);
+    TEST_ASSERT_FALSE(doc_store_read(0, doc, len + 1));
+
+    // The view ends the document: the last block, full or not, after the whole one
+    // before it when there is one, less the continuation bytes of a split character
+    const char *view = doc_store_view();
+    uint32_t view_len = strlen(view);
+    uint32_t full_len = (len > BLOCK ? BLOCK : 0) + (len ? (len - 1) % BLOCK + 1 : 0);
+    TEST_ASSERT_TRUE(view_len <= full_len && view_len + 3 >= full_len);
+    TEST_ASSERT_EQUAL_MEMORY(expected + len - view_len, view, view_len);
+}
+
+static void test_document_appends()
+{
+    static char typed[6 * BLOCK];
+    uint32_t len = 0;
+    assert_document("", 0);
+    while (len + 41 < sizeof(typed))
+    {
+        // Words of 1..40 letters, some of them 2 byte characters, and a space
+        uint32_t n = 0;
+        char *word = typed + len;
+        for (uint32_t letters = 1 + rng() % 40; letters; letters--)
+        {
+            if (rng() % 5 == 0)
+                word[n++] = '\xc3', word[n++] = '\xa9';
+            else
+                word[n++] = 'a' + rng() % 26;
+        }
+        word[n++] = ' ';
+        TEST_ASSERT_TRUE(doc_store_append(word, n));
+        len += n;
+        if (len % 97 < 40)
+            assert_document(typed, len);
+    }
+    assert_document(typed, len);
+    TEST_ASSERT_NULL(doc_store_text());
+
+    doc_store_clear();
+    assert_document("", 0);
+    TEST_ASSERT_TRUE(doc_store_append("again", 5));
+    TEST_ASSERT_EQUAL_STRING("again", doc_store_text());
+}
+
+// Out of memory in any of the blocks an append seals: the document stays as it was,
+// and takes the same append once there is memory again
+static void test_append_is_all_or_nothing()
+{
+    // Starting with no block, one, and many (past the first growth of the block list)
+    static const uint32_t starts[] = {0, 100, BLOCK, BLOCK + 1, 2 * BLOCK - 1, 17 * BLOCK + 5};
+    for (uint32_t start : starts)
+    {
+        // The first allocation fails, then the first of a later block
+        for (int32_t fail = 0; fail < 4; fail++)
+        {
+            doc_store_clear();
+            TEST_ASSERT_TRUE(doc_store_append(doc_text, start));
+            static char view[2 * BLOCK + 1];
+            strcpy(view, doc_store_view());
+
+            heap_caps_fail_after = fail;
+            TEST_ASSERT_FALSE(doc_store_append(doc_text + start, MORE));
+            heap_caps_fail_after = -1;
+            assert_document(doc_text, start);
+            TEST_ASSERT_EQUAL_STRING(view, doc_store_view());
+
+            TEST_ASSERT_TRUE(doc_store_append(doc_text + start, MORE));
+            assert_document(doc_text, start + MORE);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    if (!doc_store_init())
+        return 1;
+    RUN_TEST(test_round_trips);
+    RUN_TEST(test_capacity_bounds);
+    RUN_TEST(test_reference_blocks);
+    RUN_TEST(test_malformed_blocks);
+    RUN_TEST(test_document_appends);
+    RUN_TEST(test_append_is_all_or_nothing);
+    return UNITY_END();
+}
@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <esp_timer.h>
+#include <unity.h>
+#include "draw_sw_asm_custom.h"
+
+// The src build has the vector path (SSE2 on x86); the 32 bit scalar path is built
+// here from the same source under other names
+#undef DRAW_ASM_SCALAR
+#define DRAW_ASM_SCALAR 1
+#define draw_asm_fill_rgb565 scalar_fill_rgb565
+#define draw_asm_copy_rgb565 scalar_copy_rgb565
+#define draw_asm_selftest scalar_selftest
+#include "../../src/draw_sw_asm_custom.c"
+#undef draw_asm_fill_rgb565
+#undef draw_asm_copy_rgb565
+#undef draw_asm_selftest
+
+#define TEST_W 320
+#define TEST_H 48
+#define TEST_RUNS 2000
+#define TEST_SIZE (TEST_W * TEST_H * 2 + 16)
+#define BENCH_RUNS 4000
+
+typedef int (*fill_fn)(void *, int32_t, int32_t, int32_t, uint16_t);
+typedef int (*copy_fn)(void *, int32_t, int32_t, int32_t, const void *, int32_t);
+
+static uint8_t a[TEST_SIZE], b[TEST_SIZE], src[TEST_SIZE];
+
+static void ref_fill_rgb565(void *dest_buf, int32_t w, int32_t h, int32_t dest_stride, uint16_t color)
+{
+    for (int32_t y = 0; y < h; y++)
+    {
+        uint16_t *d = (uint16_t *)((uint8_t *)dest_buf + y * dest_stride);
+        for (int32_t x = 0; x < w; x++)
+            d[x] = color;
+    }
+}
+
+static void ref_copy_rgb565(void *dest_buf, int32_t w, int32_t h, int32_t dest_stride, const void *src_buf, int32_t src_stride)
+{
+    for (int32_t y = 0; y < h; y++)
+    {
+        uint16_t *d = (uint16_t *)((uint8_t *)dest_buf + y * dest_stride);
+        const uint16_t *s = (const uint16_t *)((const uint8_t *)src_buf + y * src_stride);
+        for (int32_t x = 0; x < w; x++)
+            d[x] = s[x];
+    }
+}
+
+static uint32_t lcg_state;
+static uint32_t lcg(void)
+{
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state >> 8;
+}
+
+// Random sizes, strides and (2 byte aligned) offsets against the reference loops; the
+// bytes around the area must stay untouched
+static void check_kernels(fill_fn fill, copy_fn copy)
+{
+    lcg_state = 1;
+    for (size_t i = 0; i < TEST_SIZE; i++)
+        src[i] = (uint8_t)lcg();
+
+    for (int i = 0; i < TEST_RUNS; i++)
+    {
+        int32_t w = 1 + lcg() % (TEST_W - 8);
+        int32_t h = 1 + lcg() % TEST_H;
+        int32_t stride = (w + lcg() % (TEST_W - w + 1)) * 2;
+        if (stride * h > TEST_SIZE - 16)
+            h = (TEST_SIZE - 16) / stride;
+        size_t ofs = (lcg() % 8) * 2;
+        size_t src_ofs = (lcg() % 8) * 2;
+        uint16_t color = (uint16_t)lcg();
+
+        memset(a, 0x5a, TEST_SIZE);
+        memset(b, 0x5a, TEST_SIZE);
+        TEST_ASSERT_EQUAL_INT(LV_RESULT_OK, fill(a + ofs, w, h, stride, color));
+        ref_fill_rgb565(b + ofs, w, h, stride, color);
+        TEST_ASSERT_EQUAL_MEMORY(b, a, TEST_SIZE);
+
+        TEST_ASSERT_EQUAL_INT(LV_RESULT_OK, copy(a + ofs, w, h, stride, src + src_ofs, stride));
+        ref_copy_rgb565(b + ofs, w, h, stride, src + src_ofs, stride);
+        TEST_ASSERT_EQUAL_MEMORY(b, a, TEST_SIZE);
+    }
+}
+
+static void test_vector_kernels(void)
+{
+    check_kernels(draw_asm_fill_rgb565, draw_asm_copy_rgb565);
+}
+
+static void test_scalar_kernels(void)
+{
+    check_kernels(scalar_fill_rgb565, scalar_copy_rgb565);
+}
+
+// Widths around the 8 pixel vector blocks, at every alignment
+static void test_block_edges(void)
+{
+    static const fill_fn fills[] = {draw_asm_fill_rgb565, scalar_fill_rgb565};
+    for (int k = 0; k < 2; k++)
+        for (int32_t w = 1; w <= 34; w++)
+            for (size_t ofs = 0; ofs < 16; ofs += 2)
+            {
+                memset(a, 0x5a, TEST_SIZE);
+                memset(b, 0x5a, TEST_SIZE);
+                fills[k](a + ofs, w, 2, w * 2 + 2, 0xf4c5);
+                ref_fill_rgb565(b + ofs, w, 2, w * 2 + 2, 0xf4c5);
+                TEST_ASSERT_EQUAL_MEMORY(b, a, 256);
+            }
+}
+
+// MB/s written by one kernel over a full TEST_W x TEST_H buffer
+#define BENCH(call)                                                                         \
+    ({                                                                                      \
+        int64_t t0 = esp_timer_get_time();                                                  \
+        for (int r = 0; r < BENCH_RUNS; r++)                                                \
+            call;                                                                           \
+        int64_t us = esp_timer_get_time() - t0;                                             \
+        (double)TEST_W * TEST_H * sizeof(uint16_t) * BENCH_RUNS / (us ? us : 1);           \
+    })
+
+// Throughput of each kernel against the plain C loops, in the test log (not checked:
+// the host's speed is no measure of the boards')
+static void test_throughput(void)
+{
+    int32_t stride = TEST_W * 2;
+    double fill = BENCH(draw_asm_fill_rgb565(a, TEST_W, TEST_H, stride, 0xf4c5));
+    double fill_scalar = BENCH(scalar_fill_rgb565(a, TEST_W, TEST_H, stride, 0xf4c5));
+    double fill_ref = BENCH(ref_fill_rgb565(b, TEST_W, TEST_H, stride, 0xf4c5));
+    double copy = BENCH(draw_asm_copy_rgb565(a, TEST_W, TEST_H, stride, src, stride));
+    double copy_scalar = BENCH(scalar_copy_rgb565(a, TEST_W, TEST_H, stride, src, stride));
+    double copy_ref = BENCH(ref_copy_rgb565(b, TEST_W, TEST_H, stride, src, stride));
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "fill %.0f MB/s, 32 bit %.0f MB/s, reference %.0f MB/s", fill, fill_scalar, fill_ref);
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "copy %.0f MB/s, 32 bit %.0f MB/s, reference %.0f MB/s", copy, copy_scalar, copy_ref);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL_MEMORY(b, a, TEST_W * TEST_H * 2);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_vector_kernels);
+    RUN_TEST(test_scalar_kernels);
+    RUN_TEST(test_block_edges);
+    RUN_TEST(test_throughput);
+    return UNITY_END();
+}
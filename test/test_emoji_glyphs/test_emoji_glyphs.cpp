@@ -0,0 +1,301 @@
+#include <Arduino.h>
+#include <unity.h>
+
+// The pack reader is built here from its source, to start every test with an empty
+// cache; the file store reads a pack written to this path
+#undef EMOJI_LAYER
+#define EMOJI_LAYER 1
+#define EMOJI_PACK_PATH "/tmp/test_emoji_glyphs.pak"
+#include "../../src/emoji_glyphs.cpp"
+
+#define GLYPHS 300
+#define STRIDE 8
+#define FIRST_CODEPOINT 0x1F300
+#define PACK_MAX (sizeof(emoji_pack_header_t) + GLYPHS * (4 + sizeof(emoji_pack_entry_t) + EMOJI_MAX_CODED))
+
+// A pack as tools/emoji_pack.py writes it
+static uint8_t pack_buf[PACK_MAX];
+static uint32_t pack_len;
+static bool store_present;
+
+static bool ram_open()
+{
+    return store_present;
+}
+
+static int32_t ram_read(uint32_t offset, void *buf, uint32_t len)
+{
+    if (offset > pack_len)
+        return -1;
+    len = LV_MIN(len, pack_len - offset);
+    memcpy(buf, pack_buf + offset, len);
+    return len;
+}
+
+static const emoji_store_t ram_store = {ram_open, ram_read};
+
+// Every other code point, so the pack has gaps
+static uint32_t glyph_codepoint(uint32_t i)
+{
+    return FIRST_CODEPOINT + 2 * i;
+}
+
+// Flat rows (repeated runs) between rows of noise (literal runs)
+static uint8_t glyph_pixel(uint32_t glyph, uint32_t i)
+{
+    uint32_t row = i / EMOJI_SIZE;
+    return (row + glyph) % 3 ? (uint8_t)(glyph * 29) : (uint8_t)((i * 73 + glyph * 151) >> 1);
+}
+
+static uint32_t rle_encode(const uint8_t *pixels, uint8_t *out)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < EMOJI_PIXELS;)
+    {
+        uint32_t run = 1;
+        while (i + run < EMOJI_PIXELS && pixels[i + run] == pixels[i] && run < 0x7F + 2)
+            run++;
+        if (run >= 2)
+        {
+            out[n++] = 0x80 + run - 2;
+            out[n++] = pixels[i];
+            i += run;
+            continue;
+        }
+        // Literals up to the next repeat
+        uint32_t start = i, len = 0;
+        while (i < EMOJI_PIXELS && len < 0x80 && !(i + 1 < EMOJI_PIXELS && pixels[i + 1] == pixels[i]))
+        {
+            i++;
+            len++;
+        }
+        out[n++] = len - 1;
+        memcpy(out + n, pixels + start, len);
+        n += len;
+    }
+    return n;
+}
+
+static void build_pack(uint32_t count, uint16_t stride)
+{
+    uint32_t blocks = (count + stride - 1) / stride;
+    emoji_pack_header_t header = {EMOJI_PACK_MAGIC, count, EMOJI_SIZE, EMOJI_SIZE, stride, 0};
+    memcpy(pack_buf, &header, sizeof(header));
+    uint32_t index = sizeof(header) + blocks * 4;
+    uint32_t data = index + count * sizeof(emoji_pack_entry_t);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint8_t pixels[EMOJI_PIXELS];
+        for (uint32_t p = 0; p < EMOJI_PIXELS; p++)
+            pixels[p] = glyph_pixel(i, p);
+        emoji_pack_entry_t entry = {glyph_codepoint(i), data, (uint16_t)rle_encode(pixels, pack_buf + data), 0};
+        memcpy(pack_buf + index + i * sizeof(entry), &entry, sizeof(entry));
+        if (i % stride == 0)
+            memcpy(pack_buf + sizeof(header) + i / stride * 4, &entry.codepoint, 4);
+        data += entry.length;
+    }
+    pack_len = data;
+    store_present = true;
+}
+
+static emoji_pack_header_t *pack_header()
+{
+    return (emoji_pack_header_t *)pack_buf;
+}
+
+static emoji_pack_entry_t *pack_entry(uint32_t i)
+{
+    uint32_t blocks = (pack_header()->count + pack_header()->stride - 1) / pack_header()->stride;
+    return (emoji_pack_entry_t *)(pack_buf + sizeof(emoji_pack_header_t) + blocks * 4) + i;
+}
+
+static void check_glyph(const lv_image_dsc_t *dsc, uint32_t glyph)
+{
+    TEST_ASSERT_NOT_NULL(dsc);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_A8, dsc->header.cf);
+    TEST_ASSERT_EQUAL(EMOJI_SIZE, dsc->header.w);
+    TEST_ASSERT_EQUAL(EMOJI_SIZE, dsc->header.h);
+    TEST_ASSERT_EQUAL(EMOJI_PIXELS, dsc->data_size);
+    for (uint32_t p = 0; p < EMOJI_PIXELS; p++)
+        TEST_ASSERT_EQUAL(glyph_pixel(glyph, p), dsc->data[p]);
+}
+
+void setUp()
+{
+    memset(slots, 0, sizeof(slots));
+    memset(&stats, 0, sizeof(stats));
+    clock_now = 0;
+    build_pack(GLYPHS, STRIDE);
+}
+
+void tearDown()
+{
+}
+
+static void test_reads_every_glyph()
+{
+    TEST_ASSERT_TRUE(emoji_glyphs_init(&ram_store));
+    TEST_ASSERT_EQUAL(GLYPHS, emoji_glyphs_count());
+    for (uint32_t i = 0; i < GLYPHS; i++)
+        check_glyph(emoji_glyphs_get(glyph_codepoint(i)), i);
+    TEST_ASSERT_EQUAL(GLYPHS, emoji_glyphs_stats()->misses);
+    TEST_ASSERT_EQUAL(0, emoji_glyphs_stats()->failures);
+
+    // The image font asks for the same glyphs
+    int32_t offset_y = 0;
+    check_glyph((const lv_image_dsc_t *)font_path_cb(&emoji_font, glyph_codepoint(7), 0, &offset_y, NULL), 7);
+}
+
+static void test_lists_codepoints()
+{
+    TEST_ASSERT_TRUE(emoji_glyphs_init(&ram_store));
+    static uint32_t codepoints[GLYPHS];
+    // More than one read of the index
+    TEST_ASSERT_EQUAL(GLYPHS, emoji_glyphs_codepoints(0, codepoints, GLYPHS + 10));
+    for (uint32_t i = 0; i < GLYPHS; i++)
+        TEST_ASSERT_EQUAL(glyph_codepoint(i), codepoints[i]);
+    TEST_ASSERT_EQUAL(5, emoji_glyphs_codepoints(GLYPHS - 5, codepoints, 36));
+    TEST_ASSERT_EQUAL(glyph_codepoint(GLYPHS - 5), codepoints[0]);
+    TEST_ASSERT_EQUAL(0, emoji_glyphs_codepoints(GLYPHS, codepoints, 36));
+}
+
+static void test_missing_codepoints()
+{
+    TEST_ASSERT_TRUE(emoji_glyphs_init(&ram_store));
+    TEST_ASSERT_NULL(emoji_glyphs_get(0));
+    TEST_ASSERT_NULL(emoji_glyphs_get('A'));
+    TEST_ASSERT_NULL(emoji_glyphs_get(FIRST_CODEPOINT - 1));
+    TEST_ASSERT_NULL(emoji_glyphs_get(glyph_codepoint(STRIDE) + 1)); // In a gap, at a block start
+    TEST_ASSERT_NULL(emoji_glyphs_get(glyph_codepoint(GLYPHS - 1) + 1));
+    TEST_ASSERT_EQUAL(4, emoji_glyphs_stats()->not_found);
+    check_glyph(emoji_glyphs_get(glyph_codepoint(GLYPHS - 1)), GLYPHS - 1);
+}
+
+static void test_cache_keeps_pinned_glyphs()
+{
+    TEST_ASSERT_TRUE(emoji_glyphs_init(&ram_store));
+    const lv_image_dsc_t *pinned = emoji_glyphs_pin(glyph_codepoint(0));
+    check_glyph(pinned, 0);
+
+    // Twice the cache: every unpinned slot is replaced
+    for (uint32_t i = 1; i <= 2 * EMOJI_CACHE_SLOTS; i++)
+        check_glyph(emoji_glyphs_get(glyph_codepoint(i)), i);
+    TEST_ASSERT_EQUAL(EMOJI_CACHE_SLOTS + 1, emoji_glyphs_stats()->evictions);
+    TEST_ASSERT_TRUE(pinned == emoji_glyphs_get(glyph_codepoint(0)));
+    check_glyph(pinned, 0);
+    uint32_t misses = emoji_glyphs_stats()->misses;
+    check_glyph(emoji_glyphs_get(glyph_codepoint(2 * EMOJI_CACHE_SLOTS)), 2 * EMOJI_CACHE_SLOTS);
+    TEST_ASSERT_EQUAL(misses, emoji_glyphs_stats()->misses);
+
+    // Unpinned, it is the least recently used after a cache of other glyphs
+    emoji_glyphs_unpin(pinned);
+    for (uint32_t i = 1; i < EMOJI_CACHE_SLOTS; i++)
+        emoji_glyphs_get(glyph_codepoint(100 + i));
+    emoji_glyphs_get(glyph_codepoint(200));
+    misses = emoji_glyphs_stats()->misses;
+    check_glyph(emoji_glyphs_get(glyph_codepoint(0)), 0);
+    TEST_ASSERT_EQUAL(misses + 1, emoji_glyphs_stats()->misses);
+}
+
+static void expect_refused()
+{
+    TEST_ASSERT_FALSE(emoji_glyphs_init(&ram_store));
+    TEST_ASSERT_EQUAL(0, emoji_glyphs_count());
+    TEST_ASSERT_NULL(emoji_glyphs_get(glyph_codepoint(0)));
+}
+
+static void test_refuses_bad_packs()
+{
+    store_present = false;
+    expect_refused();
+
+    build_pack(GLYPHS, STRIDE);
+    pack_header()->magic ^= 1;
+    expect_refused();
+
+    build_pack(GLYPHS, STRIDE);
+    pack_header()->width = EMOJI_SIZE * 2;
+    expect_refused();
+
+    build_pack(GLYPHS, STRIDE);
+    pack_header()->stride = 0;
+    expect_refused();
+
+    build_pack(GLYPHS, EMOJI_MAX_STRIDE + 1);
+    expect_refused();
+
+    build_pack(EMOJI_PACK_MAX_BLOCKS + 1, 1);
+    expect_refused();
+
+    build_pack(0, STRIDE);
+    expect_refused();
+
+    // Cut in the index
+    build_pack(GLYPHS, STRIDE);
+    pack_len = (uint8_t *)pack_entry(GLYPHS - 1) - pack_buf + 4;
+    expect_refused();
+
+    build_pack(GLYPHS, STRIDE);
+    TEST_ASSERT_TRUE(emoji_glyphs_init(&ram_store));
+}
+
+static void test_refuses_damaged_glyphs()
+{
+    // Too short, too long, a run past the glyph, a cut file
+    pack_entry(1)->length -= 1;
+    pack_entry(2)->length += 1;
+    pack_entry(3)->length = EMOJI_MAX_CODED + 1;
+    pack_buf[pack_entry(4)->offset] = 0xFF;
+    pack_len = pack_entry(GLYPHS - 1)->offset + 1;
+    TEST_ASSERT_TRUE(emoji_glyphs_init(&ram_store));
+
+    for (uint32_t i = 1; i <= 4; i++)
+        TEST_ASSERT_NULL(emoji_glyphs_get(glyph_codepoint(i)));
+    TEST_ASSERT_NULL(emoji_glyphs_get(glyph_codepoint(GLYPHS - 1)));
+    TEST_ASSERT_EQUAL(5, emoji_glyphs_stats()->failures);
+
+    // The others still decode, also into the slots a damaged glyph left empty
+    for (uint32_t i = 5; i < 5 + EMOJI_CACHE_SLOTS; i++)
+        check_glyph(emoji_glyphs_get(glyph_codepoint(i)), i);
+    check_glyph(emoji_glyphs_get(glyph_codepoint(0)), 0);
+}
+
+static void test_file_store()
+{
+    FILE *f = fopen(EMOJI_PACK_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    TEST_ASSERT_EQUAL(pack_len, fwrite(pack_buf, 1, pack_len, f));
+    fclose(f);
+
+    TEST_ASSERT_TRUE(emoji_glyphs_init(emoji_glyphs_file_store()));
+    TEST_ASSERT_EQUAL(GLYPHS, emoji_glyphs_count());
+    check_glyph(emoji_glyphs_get(glyph_codepoint(GLYPHS / 2)), GLYPHS / 2);
+    remove(EMOJI_PACK_PATH);
+}
+
+static void test_utf8()
+{
+    char out[5];
+    TEST_ASSERT_EQUAL(1, emoji_glyphs_utf8('A', out));
+    TEST_ASSERT_EQUAL_STRING("A", out);
+    TEST_ASSERT_EQUAL(2, emoji_glyphs_utf8(0xE9, out));
+    TEST_ASSERT_EQUAL_STRING("\xC3\xA9", out);
+    TEST_ASSERT_EQUAL(3, emoji_glyphs_utf8(0x2600, out));
+    TEST_ASSERT_EQUAL_STRING("\xE2\x98\x80", out);
+    TEST_ASSERT_EQUAL(4, emoji_glyphs_utf8(0x1F600, out));
+    TEST_ASSERT_EQUAL_STRING("\xF0\x9F\x98\x80", out);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_reads_every_glyph);
+    RUN_TEST(test_lists_codepoints);
+    RUN_TEST(test_missing_codepoints);
+    RUN_TEST(test_cache_keeps_pinned_glyphs);
+    RUN_TEST(test_refuses_bad_packs);
+    RUN_TEST(test_refuses_damaged_glyphs);
+    RUN_TEST(test_file_store);
+    RUN_TEST(test_utf8);
+    return UNITY_END();
+}
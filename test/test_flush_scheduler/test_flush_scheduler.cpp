@@ -0,0 +1,162 @@
+#include <unity.h>
+
+// The scheduler is built here from its source, to run its merge on fixed area sets
+#include "../../src/flush_scheduler.cpp"
+
+#define PANEL_W 480
+#define PANEL_H 320
+#define OVERHEAD_PX (FLUSH_SCHEDULER_TX_OVERHEAD_BYTES / 2) // A transaction costs as much as these pixels
+
+static flush_hooks_stats_t stats;
+
+const flush_hooks_stats_t *flush_hooks_get_stats()
+{
+    return &stats;
+}
+
+static lv_display_t disp;
+
+// The invalidated areas of a frame, coalesced into disp.inv_areas; returns their count
+static uint32_t schedule(const lv_area_t *areas, uint32_t n)
+{
+    memset(&disp, 0, sizeof(disp));
+    memcpy(disp.inv_areas, areas, n * sizeof(lv_area_t));
+    memset(disp.inv_area_joined, 1, n); // As LVGL's own joining would leave them
+    disp.inv_p = n;
+    coalesce(&disp);
+    for (uint32_t i = 0; i < disp.inv_p; i++)
+        TEST_ASSERT_EQUAL(0, disp.inv_area_joined[i]);
+    return disp.inv_p;
+}
+
+// Modelled bus time of sending each area in a transaction of its own
+static uint32_t bus_us(const lv_area_t *areas, uint32_t n)
+{
+    uint32_t bytes = 0;
+    for (uint32_t i = 0; i < n; i++)
+        bytes += lv_area_get_size(&areas[i]) * sizeof(uint16_t);
+    return flush_scheduler_model_us(bytes, n);
+}
+
+static void assert_area(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const lv_area_t *area)
+{
+    TEST_ASSERT_EQUAL(x1, area->x1);
+    TEST_ASSERT_EQUAL(y1, area->y1);
+    TEST_ASSERT_EQUAL(x2, area->x2);
+    TEST_ASSERT_EQUAL(y2, area->y2);
+}
+
+static bool covers(const lv_area_t *outer, const lv_area_t *inner)
+{
+    return outer->x1 <= inner->x1 && outer->y1 <= inner->y1 && outer->x2 >= inner->x2 && outer->y2 >= inner->y2;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void test_model_us(void)
+{
+    // A full RGB565 frame in one transaction, at 40 MHz
+    TEST_ASSERT_EQUAL(PANEL_W * PANEL_H * 2 * 8 / 40 + FLUSH_SCHEDULER_TX_OVERHEAD_US,
+                      flush_scheduler_model_us(PANEL_W * PANEL_H * 2, 1));
+    TEST_ASSERT_EQUAL(10 * FLUSH_SCHEDULER_TX_OVERHEAD_US, flush_scheduler_model_us(0, 10));
+}
+
+static void test_adjacent_areas_merge(void)
+{
+    const lv_area_t areas[] = {{20, 10, 29, 19}, {10, 10, 19, 19}};
+    TEST_ASSERT_EQUAL(1, schedule(areas, 2));
+    assert_area(10, 10, 29, 19, &disp.inv_areas[0]);
+    TEST_ASSERT_TRUE(bus_us(disp.inv_areas, 1) < bus_us(areas, 2));
+}
+
+static void test_distant_areas_stay_apart(void)
+{
+    const lv_area_t areas[] = {{400, 300, 409, 309}, {0, 0, 9, 9}};
+    TEST_ASSERT_EQUAL(2, schedule(areas, 2));
+    assert_area(0, 0, 9, 9, &disp.inv_areas[0]);
+    assert_area(400, 300, 409, 309, &disp.inv_areas[1]);
+}
+
+// Two areas of a row with a gap: merged while the gap costs less than a transaction
+static void test_merge_threshold(void)
+{
+    for (int32_t gap = OVERHEAD_PX - 2; gap <= OVERHEAD_PX + 2; gap++)
+    {
+        const lv_area_t areas[] = {{0, 0, 9, 0}, {10 + gap, 0, 19 + gap, 0}};
+        TEST_ASSERT_EQUAL(gap < OVERHEAD_PX ? 1 : 2, schedule(areas, 2));
+    }
+}
+
+// A row and a column crossing: their box costs more than both, yet apart their
+// crossing would be rendered and sent twice
+static void test_overlapping_areas_merge(void)
+{
+    const lv_area_t areas[] = {{0, 0, 99, 0}, {50, 0, 50, 199}};
+    TEST_ASSERT_EQUAL(1, schedule(areas, 2));
+    assert_area(0, 0, 99, 199, &disp.inv_areas[0]);
+    TEST_ASSERT_TRUE(bus_us(disp.inv_areas, 1) > bus_us(areas, 2));
+}
+
+static void test_sent_top_to_bottom(void)
+{
+    const lv_area_t areas[] = {{300, 200, 309, 209}, {0, 200, 9, 209}, {100, 0, 109, 9}};
+    TEST_ASSERT_EQUAL(3, schedule(areas, 3));
+    assert_area(100, 0, 109, 9, &disp.inv_areas[0]);
+    assert_area(0, 200, 9, 209, &disp.inv_areas[1]);
+    assert_area(300, 200, 309, 209, &disp.inv_areas[2]);
+}
+
+// A keystroke: the pressed key and its neighbour's shadow, the input field, its
+// cursor, the status bar clock and the HUD
+static void test_keystroke_frame(void)
+{
+    const lv_area_t areas[] = {
+        {170, 180, 249, 239}, // Pressed key
+        {245, 180, 254, 239}, // Its outline on the next key
+        {10, 40, 300, 63},    // Input text
+        {302, 42, 305, 61},   // Input cursor
+        {420, 2, 477, 17},    // Clock
+        {0, 2, 120, 17},      // HUD
+        {172, 182, 247, 237}, // The key's label, inside the key
+    };
+    const uint32_t n = sizeof(areas) / sizeof(areas[0]);
+    uint32_t out = schedule(areas, n);
+
+    TEST_ASSERT_EQUAL(4, out);
+    assert_area(0, 2, 120, 17, &disp.inv_areas[0]);
+    assert_area(420, 2, 477, 17, &disp.inv_areas[1]);
+    assert_area(10, 40, 305, 63, &disp.inv_areas[2]);
+    assert_area(170, 180, 254, 239, &disp.inv_areas[3]);
+    TEST_ASSERT_TRUE(bus_us(disp.inv_areas, out) < bus_us(areas, n));
+
+    // Every invalidated pixel is sent, once
+    for (uint32_t i = 0; i < n; i++)
+    {
+        bool covered = false;
+        for (uint32_t j = 0; j < out; j++)
+            covered = covered || covers(&disp.inv_areas[j], &areas[i]);
+        TEST_ASSERT_TRUE(covered);
+    }
+    for (uint32_t i = 0; i < out; i++)
+        for (uint32_t j = i + 1; j < out; j++)
+            TEST_ASSERT_FALSE(overlap(&disp.inv_areas[i], &disp.inv_areas[j]));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_model_us);
+    RUN_TEST(test_adjacent_areas_merge);
+    RUN_TEST(test_distant_areas_stay_apart);
+    RUN_TEST(test_merge_threshold);
+    RUN_TEST(test_overlapping_areas_merge);
+    RUN_TEST(test_sent_top_to_bottom);
+    RUN_TEST(test_keystroke_frame);
+    return UNITY_END();
+}
@@ -0,0 +1,154 @@
+#include <unity.h>
+
+// The arenas are built here from their source, to look at the counters of each
+#undef LVGL_ARENAS
+#define LVGL_ARENAS 1
+#include "../../src/lvgl_arenas.cpp"
+
+#define FRAMES 200
+#define FRAME_BLOCKS 6
+#define FRAME_BLOCK_SIZE 2000 // Together most of the scratch arena
+
+static arena_t *ui = &lvgl_set.arenas[LVGL_ARENA_UI];
+static arena_t *scratch = &lvgl_set.arenas[LVGL_ARENA_SCRATCH];
+static arena_t *text = &lvgl_set.arenas[LVGL_ARENA_TEXT];
+
+static void send_render_event(lv_event_code_t code)
+{
+    lv_event_t e = {code, NULL, NULL};
+    render_event_cb(&e);
+}
+
+static void *render_frame()
+{
+    send_render_event(LV_EVENT_RENDER_START);
+    void *blocks[FRAME_BLOCKS];
+    for (int i = 0; i < FRAME_BLOCKS; i++)
+    {
+        blocks[i] = lv_malloc_core(FRAME_BLOCK_SIZE);
+        if (!arena_owns(scratch, blocks[i]))
+            return blocks[i];
+        memset(blocks[i], i, FRAME_BLOCK_SIZE);
+    }
+    for (int i = 0; i < FRAME_BLOCKS; i++)
+        lv_free_core(blocks[i]);
+    send_render_event(LV_EVENT_RENDER_READY);
+    return NULL;
+}
+
+void setUp()
+{
+    lv_mem_init();
+}
+
+void tearDown()
+{
+    lv_mem_deinit();
+}
+
+static void test_frames_render_in_scratch()
+{
+    void *ui_block = lv_malloc_core(100);
+    TEST_ASSERT_TRUE(arena_owns(ui, ui_block));
+
+    for (int frame = 0; frame < FRAMES; frame++)
+        TEST_ASSERT_NULL(render_frame());
+    TEST_ASSERT_EQUAL(0, scratch->fallbacks);
+    TEST_ASSERT_EQUAL(0, scratch->pinned_frames);
+
+    // Between frames the UI arena is selected again
+    void *after = lv_malloc_core(100);
+    TEST_ASSERT_TRUE(arena_owns(ui, after));
+    lv_free_core(after);
+    lv_free_core(ui_block);
+}
+
+// An image or glyph cached while drawing outlives the frame: it must not keep the
+// frames after it out of the scratch arena
+static void test_cached_block_does_not_pin_scratch()
+{
+    send_render_event(LV_EVENT_RENDER_START);
+    void *cached = lv_malloc_core(1024);
+    TEST_ASSERT_TRUE(arena_owns(scratch, cached));
+    memset(cached, 0xA5, 1024);
+    send_render_event(LV_EVENT_RENDER_READY);
+
+    for (int frame = 0; frame < FRAMES; frame++)
+        TEST_ASSERT_NULL(render_frame());
+    TEST_ASSERT_EQUAL(0, scratch->fallbacks);
+    TEST_ASSERT_EQUAL(FRAMES + 1, scratch->pinned_frames);
+    for (int i = 0; i < 1024; i++)
+        TEST_ASSERT_EQUAL(0xA5, ((uint8_t *)cached)[i]);
+
+    lv_free_core(cached);
+    arena_stats_t stats;
+    arena_get_stats(scratch, &stats);
+    TEST_ASSERT_EQUAL(0, stats.used);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test_core());
+}
+
+static void test_resize_during_render_stays_in_place()
+{
+    char *label = (char *)lv_malloc_core(32);
+    TEST_ASSERT_TRUE(arena_owns(ui, label));
+    strcpy(label, "label");
+
+    send_render_event(LV_EVENT_RENDER_START);
+    label = (char *)lv_realloc_core(label, 64);
+    send_render_event(LV_EVENT_RENDER_READY);
+    TEST_ASSERT_TRUE(arena_owns(ui, label));
+    TEST_ASSERT_EQUAL_STRING("label", label);
+    lv_free_core(label);
+}
+
+static void test_text_moves_to_its_arena()
+{
+    char *doc = (char *)lv_malloc_core(16);
+    TEST_ASSERT_TRUE(arena_owns(ui, doc));
+    strcpy(doc, "hello");
+
+    lvgl_arena_id_t previous = lvgl_arena_select(LVGL_ARENA_TEXT);
+    TEST_ASSERT_EQUAL(LVGL_ARENA_UI, previous);
+    for (size_t len = 64; len <= 64 * 1024; len *= 2)
+    {
+        doc = (char *)lv_realloc_core(doc, len);
+        TEST_ASSERT_TRUE(arena_owns(text, doc));
+        TEST_ASSERT_EQUAL_STRING("hello", doc);
+    }
+    lvgl_arena_select(previous);
+    lv_free_core(doc);
+    TEST_ASSERT_EQUAL(0, text->fallbacks);
+}
+
+static void test_exhausted_arena_falls_back()
+{
+    send_render_event(LV_EVENT_RENDER_START);
+    void *big = lv_malloc_core(LVGL_ARENA_SCRATCH_SIZE);
+    send_render_event(LV_EVENT_RENDER_READY);
+    TEST_ASSERT_TRUE(arena_owns(ui, big));
+    TEST_ASSERT_EQUAL(1, scratch->fallbacks);
+    TEST_ASSERT_EQUAL(0, scratch->failures);
+
+    // Past every arena: the system heap
+    void *huge = lv_malloc_core(LVGL_ARENA_UI_SIZE + LVGL_ARENA_TEXT_SIZE);
+    TEST_ASSERT_NOT_NULL(huge);
+    TEST_ASSERT_NULL(set_owner(&lvgl_set, huge));
+    lv_free_core(huge);
+    lv_free_core(big);
+
+    lv_mem_monitor_t mon = {};
+    lv_mem_monitor_core(&mon);
+    TEST_ASSERT_EQUAL(0, mon.used_cnt);
+    TEST_ASSERT_EQUAL(ui->capacity + scratch->capacity + text->capacity, mon.total_size);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_frames_render_in_scratch);
+    RUN_TEST(test_cached_block_does_not_pin_scratch);
+    RUN_TEST(test_resize_during_render_stays_in_place);
+    RUN_TEST(test_text_moves_to_its_arena);
+    RUN_TEST(test_exhausted_arena_falls_back);
+    return UNITY_END();
+}
@@ -0,0 +1,248 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include <unity.h>
+
+// The soak runs here from its source, its full million keystrokes, on a virtual
+// clock, heap and frame loop, which the tests degrade the way a leak or a slowdown on
+// the board would. The keystrokes edit the real document store as the handlers of
+// main.cpp do; the handlers themselves need the LVGL widgets, which the host lacks
+#undef SOAK_TEST
+#define SOAK_TEST 1
+#define micros model_micros
+#define lv_timer_handler model_timer_handler
+#include "soak_test.h"
+#include "doc_store.h"
+
+#define PANEL_W 480
+#define PANEL_H 320
+#define BASE_HEAP 30000
+#define BASE_SYSTEM_FREE 120000
+#define FRAME_US 1000 // Rendering time of a frame, the clock of the rate
+
+// What the board would report, changed per keystroke by the scenario
+typedef struct
+{
+    uint64_t us;
+    uint32_t frame_us;
+    uint32_t heap_used;
+    uint8_t frag_pct;
+    uint32_t system_free;
+    // Per 1000 keystrokes
+    uint32_t heap_leak;
+    uint32_t system_leak;
+    uint32_t slowdown_us;
+    bool fragmenting;
+    // What the virtual pointer did
+    uint32_t taps;
+    uint32_t presses;
+    uint32_t long_presses;
+    uint32_t pressed_frames;
+    bool pressed;
+    lv_point_t tapped;
+    bool moved_while_pressed;
+} model_t;
+
+static model_t model;
+
+// The input field and what the document store should hold
+static char input[128];
+static uint32_t input_len;
+static char document[SOAK_TEST_DOCUMENT_MAX + sizeof(input)];
+static uint32_t document_len;
+static uint32_t accepted; // Inputs moved to the document
+
+static uint32_t model_micros()
+{
+    return (uint32_t)model.us;
+}
+
+static void soak_read_cb(lv_indev_t *indev, lv_indev_data_t *data);
+
+static uint32_t model_timer_handler()
+{
+    model.us += model.frame_us;
+    lv_indev_data_t data = {};
+    soak_read_cb(NULL, &data);
+    bool pressed = data.state == LV_INDEV_STATE_PRESSED;
+    if (pressed)
+    {
+        if (!model.pressed)
+        {
+            model.presses++;
+            model.pressed_frames = 0;
+        }
+        if (++model.pressed_frames == SOAK_TEST_LONG_PRESS_FRAMES)
+            model.long_presses++;
+        if (data.point.x != model.tapped.x || data.point.y != model.tapped.y)
+            model.moved_while_pressed = true;
+    }
+    model.pressed = pressed;
+    return 0;
+}
+
+void lv_mem_monitor(lv_mem_monitor_t *mon)
+{
+    memset(mon, 0, sizeof(*mon));
+    mon->total_size = 96 * 1024;
+    mon->free_size = mon->total_size - model.heap_used;
+    mon->frag_pct = model.frag_pct;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    return model.system_free;
+}
+
+#include "../../src/soak_test.cpp"
+
+static void assert_document()
+{
+    static char stored[sizeof(document)];
+    TEST_ASSERT_EQUAL(document_len, doc_store_length());
+    TEST_ASSERT_TRUE(doc_store_read(0, stored, document_len));
+    TEST_ASSERT_EQUAL_STRING_LEN(document, stored, document_len);
+}
+
+// What the keystroke does, picked as soak_tap of main.cpp picks it: letters and
+// spaces fill the input, clear empties it and accept appends it to the document,
+// which is started over past SOAK_TEST_DOCUMENT_MAX (shift and 123 only change keys)
+static void type(uint32_t random)
+{
+    if (document_len > SOAK_TEST_DOCUMENT_MAX)
+    {
+        doc_store_clear();
+        document_len = 0;
+    }
+
+    uint32_t pick = random % 100;
+    random /= 100;
+    if (pick < 90)
+    {
+        if (input_len + 1 < sizeof(input))
+            input[input_len++] = pick < 80 ? 'a' + random % 26 : ' ';
+    }
+    else if (pick >= 96 && pick < 98)
+        input_len = 0;
+    else if (pick >= 98 && input_len)
+    {
+        TEST_ASSERT_TRUE(doc_store_append(input, input_len));
+        memcpy(document + document_len, input, input_len);
+        document_len += input_len;
+        input_len = 0;
+        accepted++;
+    }
+
+    if (model.taps % SOAK_TEST_SAMPLE_KEYS == 0)
+        assert_document();
+}
+
+static void model_tap(uint32_t random, lv_point_t *point)
+{
+    point->x = random % PANEL_W;
+    point->y = (random >> 10) % PANEL_H;
+    model.tapped = *point;
+    model.taps++;
+    type(random);
+
+    // The document grows and is cleared, the input comes and goes
+    model.heap_used = BASE_HEAP + model.taps % 50 * 40 + (uint64_t)model.taps * model.heap_leak / 1000;
+    model.system_free = BASE_SYSTEM_FREE - model.taps % 7 * 100 - (uint64_t)model.taps * model.system_leak / 1000;
+    model.frag_pct = 5 + model.taps % 3 + (model.fragmenting ? (uint64_t)model.taps * 30 / SOAK_TEST_KEYSTROKES : 0);
+    model.frame_us = FRAME_US + (uint64_t)model.taps * model.slowdown_us / 1000;
+}
+
+// Runs a whole soak; returns the failed checks of its verdict
+static int run_soak()
+{
+    soak_test_start(NULL, model_tap);
+    while (soak_test_poll())
+        ;
+    TEST_ASSERT_EQUAL(SOAK_TEST_KEYSTROKES, keystrokes);
+    TEST_ASSERT_EQUAL(SOAK_TEST_SAMPLES, sample_count);
+    return report();
+}
+
+void setUp()
+{
+    memset(&model, 0, sizeof(model));
+    model.frame_us = FRAME_US;
+    doc_store_clear();
+    input_len = 0;
+    document_len = 0;
+    accepted = 0;
+}
+
+void tearDown()
+{
+}
+
+static void test_steady_run_passes()
+{
+    TEST_ASSERT_EQUAL(0, run_soak());
+    TEST_ASSERT_FALSE(soak_test_poll());
+
+    // Every keystroke is one press and release on its point, some held for a long press
+    TEST_ASSERT_EQUAL(SOAK_TEST_KEYSTROKES, model.taps);
+    TEST_ASSERT_EQUAL(SOAK_TEST_KEYSTROKES, model.presses);
+    TEST_ASSERT_FALSE(model.pressed);
+    TEST_ASSERT_FALSE(model.moved_while_pressed);
+    TEST_ASSERT_INT_WITHIN(SOAK_TEST_KEYSTROKES / SOAK_TEST_LONG_PRESS_EVERY / 2,
+                           SOAK_TEST_KEYSTROKES / SOAK_TEST_LONG_PRESS_EVERY, model.long_presses);
+
+    // A steady frame time gives a steady rate
+    uint32_t frames_per_key = SOAK_TEST_HOLD_FRAMES + SOAK_TEST_IDLE_FRAMES;
+    TEST_ASSERT_INT_WITHIN(1000000 / FRAME_US / frames_per_key / 2, 1000000 / FRAME_US / frames_per_key,
+                           samples[SOAK_TEST_SAMPLES - 1].keys_per_s);
+
+    // The document went through every accept (about one keystroke in fifty), and
+    // was started over many times
+    TEST_ASSERT_INT_WITHIN(SOAK_TEST_KEYSTROKES / 100, SOAK_TEST_KEYSTROKES / 50, accepted);
+    assert_document();
+}
+
+static void test_same_session_every_run()
+{
+    run_soak();
+    lv_point_t last = model.tapped;
+    setUp();
+    run_soak();
+    TEST_ASSERT_EQUAL(last.x, model.tapped.x);
+    TEST_ASSERT_EQUAL(last.y, model.tapped.y);
+}
+
+static void test_lvgl_heap_leak_fails()
+{
+    model.heap_leak = 4; // 4 kB over the run
+    TEST_ASSERT_EQUAL(1, run_soak());
+}
+
+static void test_system_heap_leak_fails()
+{
+    model.system_leak = 4;
+    TEST_ASSERT_EQUAL(1, run_soak());
+}
+
+static void test_rising_fragmentation_fails()
+{
+    model.fragmenting = true;
+    TEST_ASSERT_EQUAL(1, run_soak());
+}
+
+static void test_slowdown_fails()
+{
+    model.slowdown_us = 2; // The frame time triples over the run
+    TEST_ASSERT_EQUAL(1, run_soak());
+}
+
+int main(int argc, char **argv)
+{
+    doc_store_init();
+    UNITY_BEGIN();
+    RUN_TEST(test_steady_run_passes);
+    RUN_TEST(test_same_session_every_run);
+    RUN_TEST(test_lvgl_heap_leak_fails);
+    RUN_TEST(test_system_heap_leak_fails);
+    RUN_TEST(test_rising_fragmentation_fails);
+    RUN_TEST(test_slowdown_fails);
+    return UNITY_END();
+}
@@ -0,0 +1,141 @@
+#include <stdlib.h>
+#include <unity.h>
+#include "touch_filter.h"
+#include "traces.h"
+
+#define PANEL_W 480
+#define PANEL_H 320
+#define TRACE_LEN(trace) (sizeof(trace) / sizeof(trace[0]))
+
+// What LVGL would have read after each sample
+typedef struct
+{
+    bool pressed;
+    int32_t x, y;
+} filtered_t;
+
+static touch_filter_t filter;
+static filtered_t out[256];
+static int presses, releases;
+
+static void run(const trace_sample_t *trace, size_t len)
+{
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(out) / sizeof(out[0]), len);
+    touch_filter_reset(&filter, PANEL_W, PANEL_H);
+    presses = releases = 0;
+    bool pressed = false;
+    for (size_t i = 0; i < len; i++)
+    {
+        out[i].pressed = touch_filter_process(&filter, trace[i].pressed, trace[i].x, trace[i].y, &out[i].x, &out[i].y);
+        presses += out[i].pressed && !pressed;
+        releases += !out[i].pressed && pressed;
+        pressed = out[i].pressed;
+    }
+}
+
+// Every pressed output from sample first on within radius of (x, y)
+static void assert_settled(size_t first, size_t len, int32_t x, int32_t y, int32_t radius)
+{
+    for (size_t i = first; i < len; i++)
+    {
+        if (!out[i].pressed)
+            continue;
+        TEST_ASSERT_INT_WITHIN(radius, x, out[i].x);
+        TEST_ASSERT_INT_WITHIN(radius, y, out[i].y);
+    }
+}
+
+static size_t first_pressed(size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+        if (out[i].pressed)
+            return i;
+    return len;
+}
+
+static void test_tap(void)
+{
+    size_t len = TRACE_LEN(trace_tap);
+    run(trace_tap, len);
+    // One press despite the dropout, released by the trailing samples
+    TEST_ASSERT_EQUAL(1, presses);
+    TEST_ASSERT_EQUAL(1, releases);
+    TEST_ASSERT_FALSE(out[len - 1].pressed);
+    // The skewed landing, the spike and the skewed lift are dropped
+    TEST_ASSERT_GREATER_OR_EQUAL(3, filter.rejected);
+    size_t first = first_pressed(len);
+    TEST_ASSERT_LESS_THAN(10, first);
+    assert_settled(first + 4, len, 200, 150, 4);
+}
+
+static void test_swipe(void)
+{
+    size_t len = TRACE_LEN(trace_swipe);
+    run(trace_swipe, len);
+    TEST_ASSERT_EQUAL(1, presses);
+    TEST_ASSERT_EQUAL(1, releases);
+    TEST_ASSERT_EQUAL(0, filter.rejected); // Fast, but no jump
+    // Follows the finger: never back by more than the jitter, ends near it, stays on its line
+    size_t first = first_pressed(len);
+    int32_t last_x = out[first].x;
+    for (size_t i = first; i < len && out[i].pressed; i++)
+    {
+        TEST_ASSERT_GREATER_OR_EQUAL(last_x - 3, out[i].x);
+        TEST_ASSERT_INT_WITHIN(3, 240, out[i].y);
+        last_x = out[i].x;
+    }
+    TEST_ASSERT_INT_WITHIN(30, 400, last_x);
+}
+
+static void test_hold(void)
+{
+    size_t len = TRACE_LEN(trace_hold);
+    run(trace_hold, len);
+    TEST_ASSERT_EQUAL(1, presses);
+    TEST_ASSERT_EQUAL(1, releases);
+    TEST_ASSERT_EQUAL(3, filter.rejected); // The misreads, neither a press nor a release
+    // Less than the raw jitter of up to 8 px
+    assert_settled(first_pressed(len) + 4, len, 300, 80, 6);
+}
+
+static void test_slide(void)
+{
+    size_t len = TRACE_LEN(trace_slide);
+    run(trace_slide, len);
+    // Two released samples don't release: LVGL sees one press, dragged to the second place
+    TEST_ASSERT_EQUAL(1, presses);
+    TEST_ASSERT_EQUAL(1, releases);
+    // The far samples are dropped until TOUCH_FILTER_JUMP_SAMPLES in a row, then followed
+    TEST_ASSERT_EQUAL(TOUCH_FILTER_JUMP_SAMPLES - 1, filter.rejected);
+    size_t second = 3 + 15 + 2;
+    TEST_ASSERT_INT_WITHIN(4, 100, out[second - 3].x);
+    assert_settled(second + TOUCH_FILTER_JUMP_SAMPLES + 2, len, 380, 60, 4);
+}
+
+// Off-panel samples are rejected without pressing, so a stream of them never does
+static void test_misreads_only(void)
+{
+    static const trace_sample_t misreads[] = {{1, -1, 10}, {1, 10, -1}, {1, PANEL_W, 10}, {1, 10, PANEL_H}, {1, -200, 4095}};
+    run(misreads, TRACE_LEN(misreads));
+    TEST_ASSERT_EQUAL(0, presses);
+    TEST_ASSERT_EQUAL(TRACE_LEN(misreads), filter.rejected);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_tap);
+    RUN_TEST(test_swipe);
+    RUN_TEST(test_hold);
+    RUN_TEST(test_slide);
+    RUN_TEST(test_misreads_only);
+    return UNITY_END();
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+// Touch panel traces at TOUCH_FILTER_SAMPLE_MS on a 480 x 320 resistive panel, in
+// the shape of XPT2046 readings: a few pixels of jitter, skewed samples as the
+// finger lands and lifts, single spikes, dropouts and off-panel misreads.
+// { pressed, x, y } per sample, released samples read (0, 0)
+
+typedef struct
+{
+    uint8_t pressed;
+    int16_t x, y;
+} trace_sample_t;
+
+// A tap at (200, 150): skewed first and last sample, a spike and a dropout in between
+static const trace_sample_t trace_tap[] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1, 231, 168}, {1, 201, 148}, {1, 202, 146}, {1, 197, 154},
+    {1, 197, 151}, {1, 196, 154}, {1, 199, 146}, {1, 197, 152}, {1, 202, 147}, {1, 199, 147}, {1, 204, 152},
+    {1, 196, 147}, {1, 199, 146}, {1, 264, 146}, {1, 199, 146}, {1, 204, 148}, {1, 200, 152}, {1, 198, 154},
+    {1, 197, 150}, {1, 204, 148}, {1, 197, 149}, {0, 0, 0}, {1, 204, 147}, {1, 196, 149}, {1, 203, 154},
+    {1, 202, 151}, {1, 203, 153}, {1, 201, 150}, {1, 199, 148}, {1, 199, 147}, {1, 200, 154}, {1, 162, 177},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+};
+
+// A swipe from (60, 240) to (400, 240) at 8.5 px per sample
+static const trace_sample_t trace_swipe[] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1, 60, 239}, {1, 70, 240}, {1, 76, 241}, {1, 82, 237}, {1, 95, 240},
+    {1, 100, 243}, {1, 110, 238}, {1, 119, 240}, {1, 125, 242}, {1, 133, 243}, {1, 146, 241}, {1, 156, 243},
+    {1, 161, 239}, {1, 172, 239}, {1, 180, 240}, {1, 188, 243}, {1, 196, 237}, {1, 207, 237}, {1, 212, 240},
+    {1, 223, 242}, {1, 227, 237}, {1, 240, 242}, {1, 246, 242}, {1, 256, 242}, {1, 267, 240}, {1, 271, 242},
+    {1, 281, 242}, {1, 288, 237}, {1, 298, 239}, {1, 304, 241}, {1, 312, 240}, {1, 320, 238}, {1, 335, 239},
+    {1, 338, 242}, {1, 347, 240}, {1, 357, 243}, {1, 366, 237}, {1, 372, 240}, {1, 383, 241}, {1, 390, 238},
+    {1, 403, 240}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+};
+
+// A held press at (300, 80) with more jitter and three off-panel misreads
+static const trace_sample_t trace_hold[] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1, 300, 85}, {1, 303, 84}, {1, 299, 76}, {1, 294, 77}, {1, 296, 79},
+    {1, 299, 72}, {1, 307, 77}, {1, 300, 81}, {1, 292, 76}, {1, 305, 83}, {1, 302, 76}, {1, 308, 73},
+    {1, 306, 84}, {1, 304, 84}, {1, 304, 75}, {1, 307, 84}, {1, 293, 78}, {1, -14, 80}, {1, 306, 77},
+    {1, 295, 82}, {1, 293, 75}, {1, 292, 76}, {1, 295, 83}, {1, 292, 74}, {1, 298, 84}, {1, 296, 80},
+    {1, 303, 83}, {1, 307, 75}, {1, 295, 87}, {1, 306, 87}, {1, 307, 81}, {1, 294, 76}, {1, 295, 82},
+    {1, 300, 87}, {1, 297, 88}, {1, 292, 78}, {1, 308, 83}, {1, 296, 72}, {1, 308, 81}, {1, 294, 80},
+    {1, 308, 83}, {1, 297, 83}, {1, 299, 88}, {1, 302, 79}, {1, 298, 79}, {1, 304, 79}, {1, 298, 88},
+    {1, 307, 83}, {1, 292, 72}, {1, 300, 87}, {1, 300, 78}, {1, 303, 86}, {1, 303, 83}, {1, 294, 79},
+    {1, 295, 79}, {1, 4095, 80}, {1, 302, 78}, {1, 307, 72}, {1, 307, 83}, {1, 294, 75}, {1, 304, 78},
+    {1, 307, 77}, {1, 305, 82}, {1, 294, 84}, {1, 306, 84}, {1, 294, 77}, {1, 297, 76}, {1, 292, 76},
+    {1, 306, 76}, {1, 307, 83}, {1, 296, 76}, {1, 292, 72}, {1, 295, 88}, {1, 296, 85}, {1, 298, 78},
+    {1, 292, 80}, {1, 298, 81}, {1, 308, 79}, {1, 302, 80}, {1, 305, 76}, {1, 293, 83}, {1, 4095, -3},
+    {1, 308, 76}, {1, 296, 88}, {1, 308, 72}, {1, 306, 77}, {1, 292, 76}, {1, 297, 76}, {1, 307, 75},
+    {1, 293, 82}, {1, 308, 88}, {1, 307, 75}, {1, 293, 79}, {1, 298, 80}, {1, 293, 75}, {1, 308, 86},
+    {1, 292, 74}, {1, 306, 82}, {1, 308, 88}, {1, 298, 80}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0},
+};
+
+// A press at (100, 200), two released samples, then a press at (380, 60)
+static const trace_sample_t trace_slide[] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {1, 100, 201}, {1, 101, 203}, {1, 100, 201}, {1, 98, 202}, {1, 101, 199},
+    {1, 101, 198}, {1, 103, 200}, {1, 98, 200}, {1, 97, 200}, {1, 100, 199}, {1, 97, 202}, {1, 98, 200},
+    {1, 97, 198}, {1, 102, 199}, {1, 103, 197}, {0, 0, 0}, {0, 0, 0}, {1, 383, 58}, {1, 382, 62},
+    {1, 382, 59}, {1, 378, 59}, {1, 378, 60}, {1, 378, 62}, {1, 377, 60}, {1, 380, 58}, {1, 382, 63},
+    {1, 378, 58}, {1, 382, 60}, {1, 381, 60}, {1, 379, 60}, {1, 378, 59}, {1, 379, 57}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+};
@@ -0,0 +1,250 @@
+#include <unity.h>
+
+// Rollover is built here from its source (the native env filters touch samples,
+// which rollover is exclusive with), reading a touch controller of five points
+#undef TOUCH_FILTER
+#define TOUCH_FILTER 0
+#undef TOUCH_ROLLOVER
+#define TOUCH_ROLLOVER 1
+#define CONFIG_ESP_LCD_TOUCH_MAX_POINTS 5 // As platformio.ini sets it
+#include "../../src/touch_rollover.cpp"
+
+// Three rows of four keys of three letters, as the blob keys of the keyboard
+#define KEY_W 96
+#define KEY_H 56
+static const char letters[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+
+static lv_obj_t keys_obj[12];
+static esp_lcd_touch_t controller;
+static lv_indev_t *indev;
+static lv_indev_data_t data;
+static bool pointer_pressed;
+static bool initialized;
+
+static char typed[16];
+static int typed_len;
+static int moved; // Callbacks of moving contacts
+
+static lv_point_t tap_point(char c)
+{
+    int i = strchr(letters, c) - letters;
+    const lv_area_t *a = &keys_obj[i / 3].coords;
+    return {a->x1 + KEY_W * (2 * (i % 3) + 1) / 6, a->y1 + KEY_H / 2};
+}
+
+// The letter under point, as blob_key_event_cb picks it
+static void type_at(lv_obj_t *key, const lv_point_t *point)
+{
+    int third = LV_MIN((point->x - key->coords.x1) * 3 / KEY_W, 2);
+    typed[typed_len++] = letters[(key - keys_obj) * 3 + third];
+}
+
+static void typing_cb(lv_obj_t *key, const lv_point_t *point, touch_rollover_phase_t phase)
+{
+    if (phase == TOUCH_ROLLOVER_MOVED)
+        moved++;
+    else if (phase == TOUCH_ROLLOVER_RELEASED)
+        type_at(key, point);
+}
+
+// One read with these points on the panel, in the controller's order; LVGL's
+// pointer types on its release
+static void read_points(const lv_point_t *points, int count)
+{
+    controller.count = count;
+    for (int i = 0; i < count; i++)
+    {
+        controller.x[i] = points[i].x;
+        controller.y[i] = points[i].y;
+    }
+    lv_indev_get_read_cb(indev)(indev, &data);
+
+    bool pressed = data.state == LV_INDEV_STATE_PRESSED;
+    if (pointer_pressed && !pressed)
+        for (int i = 0; i < 12; i++)
+            if (lv_area_is_point_on(&keys_obj[i].coords, &data.point, 0))
+                type_at(&keys_obj[i], &data.point);
+    pointer_pressed = pressed;
+}
+
+// A trace of steps, each holding the fingers on these letters for a few reads
+static void play(const char *const *steps, int step_count)
+{
+    for (int s = 0; s < step_count; s++)
+    {
+        lv_point_t points[TOUCH_ROLLOVER_MAX_CONTACTS];
+        int count = strlen(steps[s]);
+        for (int f = 0; f < count; f++)
+            points[f] = tap_point(steps[s][f]);
+        for (int i = 0; i < 3; i++)
+            read_points(points, count);
+    }
+}
+
+void setUp(void)
+{
+    memset(typed, 0, sizeof(typed));
+    typed_len = 0;
+    moved = 0;
+}
+
+void tearDown(void)
+{
+}
+
+// Every trace ends with the fingers lifted
+static void assert_lifted(void)
+{
+    TEST_ASSERT_FALSE(pointer_pressed);
+    for (int i = 0; i < TOUCH_ROLLOVER_MAX_CONTACTS; i++)
+        TEST_ASSERT_FALSE(contacts[i].down);
+}
+
+// Only the touch input device of esp32-smartdisplay, with the controller in its user data
+static void test_init(void)
+{
+    TEST_ASSERT_TRUE(initialized);
+    lv_indev_t *other = lv_indev_create();
+    TEST_ASSERT_FALSE(touch_rollover_init(other, typing_cb));
+    TEST_ASSERT_NULL(lv_indev_get_read_cb(other));
+    lv_indev_delete(other);
+    TEST_ASSERT_FALSE(touch_rollover_init(NULL, typing_cb));
+}
+
+// Two thumbs rolling: every letter goes down before the previous one lifts
+static void test_rolling(void)
+{
+    static const char *const steps[] = {"t", "ty", "yp", "pe", "e", ""};
+    play(steps, sizeof(steps) / sizeof(steps[0]));
+    TEST_ASSERT_EQUAL_STRING("type", typed);
+    assert_lifted();
+}
+
+// Nested: the second finger lifts first and is typed first
+static void test_nested(void)
+{
+    static const char *const steps[] = {"a", "at", "a", ""};
+    play(steps, sizeof(steps) / sizeof(steps[0]));
+    TEST_ASSERT_EQUAL_STRING("ta", typed);
+    assert_lifted();
+}
+
+// The controller lists the points in another order than they came down
+static void test_swapped(void)
+{
+    static const char *const steps[] = {"u", "pu", "p", ""};
+    play(steps, sizeof(steps) / sizeof(steps[0]));
+    TEST_ASSERT_EQUAL_STRING("up", typed);
+    assert_lifted();
+}
+
+// Every contact at once, lifting from the last down
+static void test_all_contacts(void)
+{
+    static const char *const steps[] = {"a", "ad", "adg", "adgj", "adgjm", "adgj", "adg", "ad", "a", ""};
+    play(steps, sizeof(steps) / sizeof(steps[0]));
+    TEST_ASSERT_EQUAL_STRING("mjgda", typed);
+    assert_lifted();
+}
+
+// A second finger sliding within the match radius stays one contact, and types
+// where it lifts: from the first third of its key to the second
+static void test_slide(void)
+{
+    lv_point_t points[2] = {tap_point('a'), tap_point('d')};
+    read_points(points, 1);
+    read_points(points, 2);
+    for (int i = 0; i < 4; i++)
+    {
+        points[1].x += 8;
+        read_points(points, 2);
+    }
+    read_points(points, 1);
+    read_points(points, 0);
+    TEST_ASSERT_EQUAL(4, moved);
+    TEST_ASSERT_EQUAL_STRING("ea", typed);
+    assert_lifted();
+}
+
+// A point past the match radius of every contact is another finger: the one it
+// replaces lifted
+static void test_jump(void)
+{
+    lv_point_t points[2] = {tap_point('a'), tap_point('d')};
+    read_points(points, 1);
+    read_points(points, 2);
+    points[1] = tap_point('p');
+    read_points(points, 2);
+    TEST_ASSERT_EQUAL_STRING("d", typed);
+    read_points(points, 1);
+    read_points(points, 0);
+    TEST_ASSERT_EQUAL(0, moved);
+    TEST_ASSERT_EQUAL_STRING("dpa", typed);
+    assert_lifted();
+}
+
+// A second finger beside the keys is ignored; the pointer stays with the first
+static void test_off_key(void)
+{
+    lv_point_t points[2] = {tap_point('g'), {470, 10}};
+    read_points(points, 2);
+    read_points(points, 2);
+    TEST_ASSERT_TRUE(pointer_pressed);
+    TEST_ASSERT_EQUAL(points[0].x, data.point.x);
+    TEST_ASSERT_EQUAL(points[0].y, data.point.y);
+    read_points(points + 1, 1);
+    TEST_ASSERT_EQUAL_STRING("g", typed);
+    read_points(points, 0);
+    TEST_ASSERT_EQUAL(0, moved);
+    TEST_ASSERT_EQUAL_STRING("g", typed);
+    assert_lifted();
+}
+
+// Once the pointer released, a finger still down does not take it over; the next
+// one down does
+static void test_pointer_after_release(void)
+{
+    lv_point_t points[2] = {tap_point('a'), tap_point('s')};
+    read_points(points, 2);
+    read_points(points + 1, 1);
+    TEST_ASSERT_FALSE(pointer_pressed);
+    points[0] = tap_point('x');
+    read_points(points, 2);
+    TEST_ASSERT_TRUE(pointer_pressed);
+    TEST_ASSERT_EQUAL(points[0].x, data.point.x);
+    read_points(points, 0);
+    TEST_ASSERT_EQUAL_STRING("asx", typed);
+    assert_lifted();
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 0; i < 12; i++)
+    {
+        lv_area_t *a = &keys_obj[i].coords;
+        a->x1 = i % 4 * 100;
+        a->y1 = 100 + i / 4 * 60;
+        a->x2 = a->x1 + KEY_W - 1;
+        a->y2 = a->y1 + KEY_H - 1;
+    }
+
+    indev = lv_indev_create();
+    lv_indev_set_user_data(indev, &controller);
+    initialized = touch_rollover_init(indev, typing_cb);
+    for (int i = 0; i < 12; i++)
+        touch_rollover_add_key(&keys_obj[i]);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_init);
+    RUN_TEST(test_rolling);
+    RUN_TEST(test_nested);
+    RUN_TEST(test_swapped);
+    RUN_TEST(test_all_contacts);
+    RUN_TEST(test_slide);
+    RUN_TEST(test_jump);
+    RUN_TEST(test_off_key);
+    RUN_TEST(test_pointer_after_release);
+    int failures = UNITY_END();
+    lv_indev_delete(indev);
+    return failures;
+}
@@ -0,0 +1,235 @@
+#include <LittleFS.h>
+#include <esp_timer.h>
+#include <unity.h>
+#include "touch_filter.h"
+#include "touch_trace.h"
+#include "trace_keys.h"
+
+#define PANEL_W 480
+#define PANEL_H 320
+#define TRACE_PATH "/keys.trc"
+#define TRACE_SAMPLES 96
+
+static const lv_point_t key_centers[] = {{60, 200}, {180, 250}, {300, 200}, {420, 150}};
+#define KEY_COUNT (sizeof(key_centers) / sizeof(key_centers[0]))
+
+// What LVGL sees of the replay
+typedef struct
+{
+    uint32_t samples;
+    uint32_t presses;
+    bool pressed;
+    uint32_t last_ms;
+    bool time_ordered;
+    lv_point_t press_points[8]; // Where each press was when released
+    int32_t worst_distance;     // Of a pressed point from its key, once settled
+    uint32_t pressed_samples;   // Of the current press
+    bool off_panel;             // A point off the panel reached LVGL
+} replay_t;
+
+static replay_t replay;
+
+// The panel behind the filter, sampled by its timer
+static lv_indev_t *indev;
+static lv_indev_data_t panel;
+
+static void panel_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    *data = panel;
+}
+
+// One raw sample of the panel, read by LVGL: the trace records it on the way
+static void touch(bool pressed, lv_point_t point)
+{
+    panel.point = point;
+    panel.state = pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    esp_timer_host_fire();
+    lv_indev_read(indev);
+}
+
+static void write_trace(const uint8_t *data, size_t len)
+{
+    TEST_ASSERT_TRUE(LittleFS.begin(true));
+    File file = LittleFS.open(TRACE_PATH, "w");
+    TEST_ASSERT_TRUE((bool)file);
+    TEST_ASSERT_EQUAL(len, file.write(data, len));
+    file.close();
+}
+
+static void sample_cb(uint32_t t_ms, const lv_indev_data_t *data, void *user_data)
+{
+    replay_t *r = (replay_t *)user_data;
+    if (r->samples && t_ms < r->last_ms)
+        r->time_ordered = false;
+    r->samples++;
+    r->last_ms = t_ms;
+
+    bool pressed = data->state == LV_INDEV_STATE_PRESSED;
+    if (data->point.x < 0 || data->point.y < 0 || data->point.x >= PANEL_W || data->point.y >= PANEL_H)
+        r->off_panel = true;
+    if (pressed)
+    {
+        if (!r->pressed)
+        {
+            r->presses++;
+            r->pressed_samples = 0;
+        }
+        r->pressed_samples++;
+        if (r->presses <= KEY_COUNT && r->pressed_samples > 4)
+        {
+            const lv_point_t *key = &key_centers[r->presses - 1];
+            int32_t d = LV_MAX(abs(data->point.x - key->x), abs(data->point.y - key->y));
+            r->worst_distance = LV_MAX(r->worst_distance, d);
+        }
+        if (r->presses <= 8)
+            r->press_points[r->presses - 1] = data->point;
+    }
+    r->pressed = pressed;
+}
+
+// Every sample of a decode, as it is delivered
+static lv_indev_data_t decoded[256];
+static uint32_t decoded_count;
+
+static void collect_cb(uint32_t t_ms, const lv_indev_data_t *data, void *user_data)
+{
+    if (decoded_count < sizeof(decoded) / sizeof(decoded[0]))
+        decoded[decoded_count] = *data;
+    decoded_count++;
+}
+
+static bool decode()
+{
+    memset(&replay, 0, sizeof(replay));
+    replay.time_ordered = true;
+    return touch_trace_decode(PANEL_W, PANEL_H, sample_cb, &replay);
+}
+
+// The raw samples go through the filter: one press per key, on the key
+static void test_replay_filtered(void)
+{
+    write_trace(trace_keys, sizeof(trace_keys));
+    TEST_ASSERT_TRUE(touch_trace_load(TRACE_PATH));
+    TEST_ASSERT_TRUE(decode());
+    TEST_ASSERT_EQUAL(TRACE_SAMPLES, replay.samples);
+    TEST_ASSERT_TRUE(replay.time_ordered);
+    TEST_ASSERT_EQUAL(KEY_COUNT, replay.presses);
+    TEST_ASSERT_FALSE(replay.pressed); // Each release is debounced in full
+    TEST_ASSERT_FALSE(replay.off_panel);
+    TEST_ASSERT_LESS_OR_EQUAL(4, replay.worst_distance);
+}
+
+// Saved again, the same file
+static void test_save_round_trip(void)
+{
+    write_trace(trace_keys, sizeof(trace_keys));
+    TEST_ASSERT_TRUE(touch_trace_load(TRACE_PATH));
+    TEST_ASSERT_TRUE(touch_trace_save("/again.trc"));
+    File file = LittleFS.open("/again.trc", "r");
+    TEST_ASSERT_TRUE((bool)file);
+    static uint8_t saved[sizeof(trace_keys) + 1];
+    TEST_ASSERT_EQUAL(sizeof(trace_keys), file.read(saved, sizeof(saved)));
+    file.close();
+    TEST_ASSERT_EQUAL_MEMORY(trace_keys, saved, sizeof(trace_keys));
+}
+
+// A trace of the first format holds what LVGL read: replayed as it is
+static void test_replay_unfiltered_version(void)
+{
+    static uint8_t old[sizeof(trace_keys)];
+    memcpy(old, trace_keys, sizeof(old));
+    old[4] = 1;
+    write_trace(old, sizeof(old));
+    TEST_ASSERT_TRUE(touch_trace_load(TRACE_PATH));
+    TEST_ASSERT_TRUE(decode());
+    TEST_ASSERT_EQUAL(TRACE_SAMPLES, replay.samples);
+    TEST_ASSERT_TRUE(replay.off_panel); // The misread, unfiltered
+    TEST_ASSERT_GREATER_THAN(KEY_COUNT, replay.presses); // The dropout splits a press
+}
+
+// Recording goes on after a load, from the last loaded sample
+static void test_record_after_load(void)
+{
+    // Of the first format, so the replay delivers the recorded samples as they are
+    static uint8_t old[sizeof(trace_keys)];
+    memcpy(old, trace_keys, sizeof(old));
+    old[4] = 1;
+    write_trace(old, sizeof(old));
+    TEST_ASSERT_TRUE(touch_trace_load(TRACE_PATH));
+
+    static const lv_point_t points[] = {{100, 120}, {103, 121}, {103, 121}, {240, 60}};
+    const uint32_t pressed = sizeof(points) / sizeof(points[0]);
+    for (uint32_t i = 0; i < pressed; i++)
+        touch(true, points[i]);
+    for (int i = 0; i < TOUCH_FILTER_RELEASE_SAMPLES + 2; i++)
+        touch(false, {0, 0}); // Past the release debounce: not recorded
+
+    decoded_count = 0;
+    TEST_ASSERT_TRUE(touch_trace_decode(PANEL_W, PANEL_H, collect_cb, NULL));
+    TEST_ASSERT_EQUAL(TRACE_SAMPLES + pressed + TOUCH_FILTER_RELEASE_SAMPLES, decoded_count);
+    for (uint32_t i = 0; i < pressed; i++)
+    {
+        const lv_indev_data_t *data = &decoded[TRACE_SAMPLES + i];
+        TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, data->state);
+        TEST_ASSERT_EQUAL(points[i].x, data->point.x);
+        TEST_ASSERT_EQUAL(points[i].y, data->point.y);
+    }
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, decoded[decoded_count - 1].state);
+}
+
+static void test_refuse_damaged(void)
+{
+    // Not a trace, a slot size of another build, truncated
+    static uint8_t bad[sizeof(trace_keys)];
+    memcpy(bad, trace_keys, sizeof(bad));
+    bad[0] = 'X';
+    write_trace(bad, sizeof(bad));
+    TEST_ASSERT_FALSE(touch_trace_load(TRACE_PATH));
+    memcpy(bad, trace_keys, sizeof(bad));
+    bad[5] = 64;
+    write_trace(bad, sizeof(bad));
+    TEST_ASSERT_FALSE(touch_trace_load(TRACE_PATH));
+    write_trace(trace_keys, sizeof(trace_keys) - 1);
+    TEST_ASSERT_FALSE(touch_trace_load(TRACE_PATH));
+
+    // A used length past the slot, in the last one
+    memcpy(bad, trace_keys, sizeof(bad));
+    bad[sizeof(bad) - TOUCH_TRACE_SLOT_SIZE] = TOUCH_TRACE_SLOT_SIZE + 1;
+    write_trace(bad, sizeof(bad));
+    TEST_ASSERT_FALSE(touch_trace_load(TRACE_PATH));
+    bad[sizeof(bad) - TOUCH_TRACE_SLOT_SIZE] = 255;
+    write_trace(bad, sizeof(bad));
+    TEST_ASSERT_FALSE(touch_trace_load(TRACE_PATH));
+
+    // A slot ending inside a keyframe: nothing of the trace is kept
+    memcpy(bad, trace_keys, sizeof(bad));
+    bad[8 + TOUCH_TRACE_SLOT_SIZE] = 4;
+    write_trace(bad, sizeof(bad));
+    TEST_ASSERT_FALSE(touch_trace_load(TRACE_PATH));
+    TEST_ASSERT_TRUE(decode());
+    TEST_ASSERT_EQUAL(0, replay.samples);
+}
+
+void setUp(void)
+{
+    touch_trace_clear();
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    indev = lv_indev_create();
+    lv_indev_set_read_cb(indev, panel_read_cb);
+    touch_filter_init(indev);
+    touch_trace_init(indev);
+    RUN_TEST(test_replay_filtered);
+    RUN_TEST(test_save_round_trip);
+    RUN_TEST(test_replay_unfiltered_version);
+    RUN_TEST(test_record_after_load);
+    RUN_TEST(test_refuse_damaged);
+    return UNITY_END();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// A trace file as touch_trace_save writes it (version 2, raw samples): taps on four
+// keys of a 480 x 320 resistive panel at (60, 200), (180, 250), (300, 200) and
+// (420, 150), 5 ms apart, with a few pixels of jitter, skewed landings, an off-panel
+// misread, a dropout and a spike, and the three released samples of each release
+// 96 samples in 4 slots, 390 bytes of records
+static const uint8_t trace_keys[] = {
+    0x54, 0x54, 0x52, 0x43, 0x02, 0x80, 0x04, 0x00, 0x7d, 0x81, 0xc0, 0xd4, 0x01, 0x00, 0x3f, 0x00,
+    0xcc, 0x00, 0x03, 0x05, 0x00, 0x01, 0x03, 0x05, 0x02, 0x07, 0x03, 0x05, 0x0b, 0x0a, 0x03, 0x05,
+    0x0a, 0x0b, 0x03, 0x05, 0x0b, 0x0a, 0x03, 0x05, 0x06, 0x09, 0x03, 0x05, 0x89, 0x01, 0xf2, 0x3c,
+    0x03, 0x05, 0x82, 0x01, 0xe9, 0x3c, 0x03, 0x05, 0x0e, 0x07, 0x03, 0x05, 0x0d, 0x0c, 0x03, 0x05,
+    0x02, 0x0f, 0x03, 0x05, 0x01, 0x06, 0x03, 0x05, 0x06, 0x05, 0x03, 0x05, 0x08, 0x0a, 0x03, 0x05,
+    0x00, 0x03, 0x03, 0x05, 0x02, 0x00, 0x03, 0x05, 0x07, 0x08, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05,
+    0x03, 0x2d, 0xa2, 0x02, 0x36, 0x03, 0x05, 0x2b, 0x28, 0x03, 0x05, 0x01, 0x08, 0x03, 0x05, 0x09,
+    0x07, 0x03, 0x05, 0x08, 0x01, 0x03, 0x05, 0x06, 0x02, 0x03, 0x05, 0x0f, 0x05, 0x03, 0x05, 0x02,
+    0x0a, 0x03, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7f, 0x81, 0x7e, 0xd5, 0x01, 0x00, 0xb6, 0x00,
+    0xf7, 0x00, 0x03, 0x05, 0x0b, 0x01, 0x03, 0x05, 0x06, 0x06, 0x03, 0x05, 0x05, 0x08, 0x03, 0x05,
+    0x0c, 0x01, 0x03, 0x05, 0x00, 0x09, 0x03, 0x05, 0x05, 0x06, 0x03, 0x05, 0x04, 0x05, 0x03, 0x05,
+    0x01, 0x08, 0x03, 0x05, 0x07, 0x02, 0x03, 0x05, 0x02, 0x07, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05,
+    0x03, 0x3c, 0xf4, 0x01, 0x65, 0x03, 0x05, 0x05, 0x01, 0x03, 0x05, 0x0e, 0x0e, 0x03, 0x05, 0x09,
+    0x02, 0x03, 0x05, 0x02, 0x01, 0x03, 0x05, 0x0a, 0x07, 0x03, 0x05, 0x0b, 0x06, 0x03, 0x05, 0x08,
+    0x09, 0x03, 0x05, 0x00, 0x0a, 0x00, 0x05, 0x03, 0x05, 0x03, 0x03, 0x03, 0x05, 0x07, 0x01, 0x03,
+    0x05, 0x04, 0x06, 0x03, 0x05, 0x01, 0x0b, 0x03, 0x05, 0x02, 0x06, 0x03, 0x05, 0x0a, 0x02, 0x03,
+    0x05, 0x0d, 0x02, 0x03, 0x05, 0x08, 0x02, 0x00, 0x80, 0x81, 0x55, 0xd6, 0x01, 0x00, 0x29, 0x01,
+    0xc5, 0x00, 0x03, 0x05, 0x00, 0x04, 0x03, 0x05, 0x04, 0x05, 0x03, 0x05, 0x04, 0x0a, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x05, 0x03, 0x4b, 0xae, 0x02, 0x8b, 0x01, 0x03, 0x05, 0x39, 0x22, 0x03, 0x05,
+    0x01, 0x00, 0x03, 0x05, 0x07, 0x04, 0x03, 0x05, 0x02, 0x01, 0x03, 0x05, 0x00, 0x01, 0x03, 0x05,
+    0x0a, 0x02, 0x03, 0x05, 0x03, 0x08, 0x03, 0x05, 0x09, 0x01, 0x03, 0x05, 0x01, 0x09, 0x03, 0x05,
+    0x02, 0x01, 0x03, 0x05, 0x9a, 0x01, 0x08, 0x03, 0x05, 0x95, 0x01, 0x04, 0x03, 0x05, 0x02, 0x00,
+    0x03, 0x05, 0x06, 0x03, 0x03, 0x05, 0x02, 0x03, 0x03, 0x05, 0x0d, 0x00, 0x03, 0x05, 0x04, 0x0a,
+    0x03, 0x05, 0x0a, 0x0b, 0x03, 0x05, 0x07, 0x04, 0x03, 0x05, 0x01, 0x05, 0x03, 0x05, 0x03, 0x08,
+    0x03, 0x05, 0x0a, 0x06, 0x03, 0x05, 0x05, 0x0d, 0x0e, 0x80, 0x36, 0xd7, 0x01, 0x00, 0xa3, 0x01,
+    0x92, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
@@ -0,0 +1,145 @@
+#include <esp_sleep.h>
+#include <esp_system.h>
+#include <unity.h>
+#include "warm_resume.h"
+
+#define HEADER_SIZE 14 // snapshot_header_t
+// The longest document stored with an input of 3 bytes
+#define DOCUMENT_FIT (WARM_RESUME_SNAPSHOT_SIZE - HEADER_SIZE - 4 - 1)
+
+static uint8_t buf[WARM_RESUME_SNAPSHOT_SIZE];
+static char document[WARM_RESUME_SNAPSHOT_SIZE + 1];
+
+// Empty, typical, and a document at the capacity / one byte past it
+static const struct
+{
+    uint8_t layer;
+    const char *input;
+    uint32_t document_len; // Of document, UINT32_MAX: none
+    bool stored;           // The document is expected in the snapshot
+} cases[] = {
+    {0, "", 0, true},
+    {3, "abc", 20, true},
+    {1, "abc", DOCUMENT_FIT, true},
+    {2, "abc", DOCUMENT_FIT + 1, false},
+    {0, "", UINT32_MAX, false},
+};
+#define CASE_COUNT (sizeof(cases) / sizeof(cases[0]))
+
+// The state of case i; its document is cut to length in the buffer
+static ui_state_t case_state(size_t i)
+{
+    for (size_t c = 0; c < sizeof(document) - 1; c++)
+        document[c] = 'a' + c % 26;
+    document[sizeof(document) - 1] = '\0';
+    if (cases[i].document_len != UINT32_MAX)
+        document[cases[i].document_len] = '\0';
+    return {cases[i].layer, cases[i].input, cases[i].document_len != UINT32_MAX ? document : NULL};
+}
+
+static void assert_state(const ui_state_t *expected, const ui_state_t *state)
+{
+    TEST_ASSERT_EQUAL(expected->layer, state->layer);
+    TEST_ASSERT_EQUAL_STRING(expected->input, state->input);
+    if (expected->document)
+        TEST_ASSERT_EQUAL_STRING(expected->document, state->document);
+    else
+        TEST_ASSERT_NULL(state->document);
+}
+
+void setUp(void)
+{
+    esp_reset_reason_host = ESP_RST_POWERON;
+}
+
+void tearDown(void)
+{
+}
+
+static void test_round_trip(void)
+{
+    for (size_t i = 0; i < CASE_COUNT; i++)
+    {
+        ui_state_t state = case_state(i);
+        ui_state_t expected = state;
+        if (!cases[i].stored)
+            expected.document = NULL;
+
+        uint32_t size = ui_snapshot_encode(&state, buf, sizeof(buf));
+        TEST_ASSERT_TRUE(size > 0);
+        TEST_ASSERT_TRUE(size <= sizeof(buf));
+        ui_state_t decoded;
+        TEST_ASSERT_TRUE(ui_snapshot_decode(buf, size, &decoded));
+        assert_state(&expected, &decoded);
+    }
+}
+
+// Any flipped byte and any truncation is refused
+static void test_refuse_damaged(void)
+{
+    for (size_t i = 0; i < CASE_COUNT; i++)
+    {
+        ui_state_t state = case_state(i);
+        uint32_t size = ui_snapshot_encode(&state, buf, sizeof(buf));
+        ui_state_t decoded;
+        for (uint32_t b = 0; b < size; b++)
+        {
+            buf[b] ^= 0x40;
+            TEST_ASSERT_FALSE(ui_snapshot_decode(buf, sizeof(buf), &decoded));
+            buf[b] ^= 0x40;
+        }
+        for (uint32_t len = 0; len < size; len++)
+            TEST_ASSERT_FALSE(ui_snapshot_decode(buf, len, &decoded));
+        TEST_ASSERT_TRUE(ui_snapshot_decode(buf, size, &decoded));
+    }
+}
+
+// An input longer than the field's length byte doesn't fit at all, nor does a
+// snapshot in a buffer without room for the header and the input
+static void test_refuse_oversized(void)
+{
+    static char long_input[UINT8_MAX + 2];
+    memset(long_input, 'i', sizeof(long_input) - 1);
+    ui_state_t too_long = {0, long_input, NULL};
+    TEST_ASSERT_EQUAL(0, ui_snapshot_encode(&too_long, buf, sizeof(buf)));
+
+    ui_state_t state = {0, "abc", "document"};
+    TEST_ASSERT_EQUAL(0, ui_snapshot_encode(&state, buf, HEADER_SIZE + 4));
+    uint32_t size = ui_snapshot_encode(&state, buf, HEADER_SIZE + 5);
+    TEST_ASSERT_EQUAL(HEADER_SIZE + 5, size);
+    ui_state_t decoded;
+    TEST_ASSERT_TRUE(ui_snapshot_decode(buf, size, &decoded));
+    TEST_ASSERT_NULL(decoded.document); // From the journal
+}
+
+// Through RTC memory: the state comes back on the wake from the deep sleep only
+static void test_resume_after_deep_sleep(void)
+{
+    ui_state_t state = case_state(1);
+    uint32_t sleeps = esp_deep_sleep_host_count;
+    warm_resume_sleep(&state);
+    TEST_ASSERT_EQUAL(sleeps + 1, esp_deep_sleep_host_count);
+
+    ui_state_t resumed;
+    TEST_ASSERT_FALSE(warm_resume_get(&resumed));
+    esp_reset_reason_host = ESP_RST_DEEPSLEEP;
+    TEST_ASSERT_TRUE(warm_resume_get(&resumed));
+    assert_state(&state, &resumed);
+
+    // A state that does not fit leaves no snapshot of an earlier sleep behind
+    static char long_input[UINT8_MAX + 2];
+    memset(long_input, 'i', sizeof(long_input) - 1);
+    ui_state_t too_long = {0, long_input, NULL};
+    warm_resume_sleep(&too_long);
+    TEST_ASSERT_FALSE(warm_resume_get(&resumed));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_refuse_damaged);
+    RUN_TEST(test_refuse_oversized);
+    RUN_TEST(test_resume_after_deep_sleep);
+    return UNITY_END();
+}
@@ -0,0 +1,189 @@
+"""Pack emoji and symbol glyphs for the keyboard's emoji layer.
+
+Renders every code point of RANGES that the font has into an A8 bitmap of
+EMOJI_SIZE x EMOJI_SIZE pixels (drawn 4x larger, cropped to the ink, scaled
+down to fit and centred), run-length codes it and writes data/emoji.pak in
+the format of include/emoji_glyphs.h; 'pio run -t uploadfs' puts it on
+LittleFS. The keys and the text tint the glyphs, so a monochrome emoji font
+(e.g. Noto Emoji) fits. The pack is read back and every glyph compared
+before it is written.
+
+Needs Pillow and fontTools, on the host:
+python3 tools/emoji_pack.py <font.ttf> [output] [ranges, e.g. 2600-27BF,1F300-1F64F]
+"""
+
+import os
+import re
+import struct
+import sys
+
+# Arrows, technical, symbols, dingbats, symbols and arrows, then the emoji blocks
+RANGES = "2190-21FF,2300-23FF,2600-27BF,2B00-2BFF,1F300-1F64F,1F680-1F6FF,1F900-1F9FF"
+HEADER = "include/emoji_glyphs.h"
+RENDER_SCALE = 4
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def header_define(text, name):
+    match = re.search(r"#define %s (\w+)" % name, text)
+    if not match:
+        raise ValueError("%s not found in %s" % (name, HEADER))
+    return int(match.group(1), 0)
+
+
+def parse_ranges(text):
+    codepoints = []
+    for part in text.split(","):
+        first, _, last = part.strip().partition("-")
+        codepoints.extend(range(int(first, 16), int(last or first, 16) + 1))
+    return codepoints
+
+
+# --- Glyphs ---
+
+def render_glyphs(font_path, codepoints, size):
+    from fontTools.ttLib import TTFont
+    from PIL import Image, ImageDraw, ImageFont
+
+    cmap = TTFont(font_path).getBestCmap()
+    big = size * RENDER_SCALE
+    font = ImageFont.truetype(font_path, big)
+    glyphs = []
+    for cp in codepoints:
+        if cp not in cmap:
+            continue
+        canvas = Image.new("L", (big * 2, big * 2), 0)
+        ImageDraw.Draw(canvas).text((big // 2, big // 2), chr(cp), font=font, fill=255)
+        box = canvas.getbbox()
+        if not box:
+            continue  # Joiners, selectors and other marks without ink
+        ink = canvas.crop(box)
+        # As large as an em renders, smaller when the ink doesn't fit
+        scale = min(size / big, size / ink.width, size / ink.height)
+        w, h = max(1, round(ink.width * scale)), max(1, round(ink.height * scale))
+        glyph = Image.new("L", (size, size), 0)
+        glyph.paste(ink.resize((w, h), Image.LANCZOS), ((size - w) // 2, (size - h) // 2))
+        glyphs.append((cp, glyph.tobytes()))
+    return glyphs
+
+
+# --- Pack ---
+
+def rle_encode(pixels):
+    # c < 0x80: c + 1 literal pixels follow; c >= 0x80: one pixel, repeated c - 0x80 + 2 times
+    out = bytearray()
+    literal = bytearray()
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:128]
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 129 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            flush()
+            out.extend((0x80 + run - 2, pixels[i]))
+            i += run
+        else:
+            literal.append(pixels[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def rle_decode(coded, pixel_count):
+    # As decode() in src/emoji_glyphs.cpp
+    out = bytearray()
+    i = 0
+    while i < len(coded):
+        c = coded[i]
+        if c < 0x80:
+            out.extend(coded[i + 1:i + 2 + c])
+            i += 2 + c
+        else:
+            out.extend(coded[i + 1:i + 2] * (c - 0x80 + 2))
+            i += 2
+    if len(out) != pixel_count:
+        raise ValueError("glyph decodes to %d pixels" % len(out))
+    return bytes(out)
+
+
+def build_pack(glyphs, size, magic, max_blocks):
+    glyphs = sorted(glyphs)
+    count = len(glyphs)
+    # The smallest stride that keeps the sparse index within max_blocks: a lookup reads one stride of entries
+    stride = 8
+    while (count + stride - 1) // stride > max_blocks:
+        stride *= 2
+    if stride > 64:
+        raise ValueError("%d glyphs, at most %d fit" % (count, max_blocks * 64))
+    blocks = (count + stride - 1) // stride
+
+    data_offset = 16 + 4 * blocks + 12 * count
+    sparse = b"".join(struct.pack("<I", glyphs[b * stride][0]) for b in range(blocks))
+    index = bytearray()
+    data = bytearray()
+    for cp, pixels in glyphs:
+        coded = rle_encode(pixels)
+        index += struct.pack("<IIHH", cp, data_offset + len(data), len(coded), 0)
+        data += coded
+    header = struct.pack("<IIHHHH", magic, count, size, size, stride, 0)
+    return header + sparse + bytes(index) + bytes(data)
+
+
+def check_pack(pack, glyphs, size, magic):
+    magic_read, count, width, height, stride, _ = struct.unpack_from("<IIHHHH", pack)
+    if magic_read != magic or (width, height) != (size, size) or count != len(glyphs):
+        raise ValueError("pack header does not match")
+    blocks = (count + stride - 1) // stride
+    index = 16 + 4 * blocks
+    for i, (cp, pixels) in enumerate(sorted(glyphs)):
+        entry_cp, offset, length, _ = struct.unpack_from("<IIHH", pack, index + 12 * i)
+        if i % stride == 0 and struct.unpack_from("<I", pack, 16 + 4 * (i // stride))[0] != cp:
+            raise ValueError("sparse index wrong at U+%04X" % cp)
+        if entry_cp != cp or rle_decode(pack[offset:offset + length], size * size) != pixels:
+            raise ValueError("glyph U+%04X does not read back" % cp)
+
+
+def write_pack(glyphs, output):
+    with open(os.path.join(ROOT, HEADER), encoding="utf-8") as f:
+        text = f.read()
+    size = header_define(text, "EMOJI_SIZE")
+    magic = header_define(text, "EMOJI_PACK_MAGIC")
+    max_blocks = header_define(text, "EMOJI_PACK_MAX_BLOCKS")
+    if not glyphs:
+        raise ValueError("no glyphs")
+    if any(len(pixels) != size * size for _, pixels in glyphs):
+        raise ValueError("glyphs must be %d x %d" % (size, size))
+
+    pack = build_pack(glyphs, size, magic, max_blocks)
+    check_pack(pack, glyphs, size, magic)
+    os.makedirs(os.path.dirname(os.path.abspath(output)), exist_ok=True)
+    with open(output, "wb") as f:
+        f.write(pack)
+    print("Emoji pack: %d glyphs of %d x %d, %d bytes (%d bytes as A8) in %s"
+          % (len(glyphs), size, size, len(pack), len(glyphs) * size * size, output))
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.exit("usage: emoji_pack.py <font.ttf> [output] [ranges]")
+    output = argv[2] if len(argv) > 2 else os.path.join(ROOT, "data", "emoji.pak")
+    with open(os.path.join(ROOT, HEADER), encoding="utf-8") as f:
+        size = header_define(f.read(), "EMOJI_SIZE")
+    glyphs = render_glyphs(argv[1], parse_ranges(argv[3] if len(argv) > 3 else RANGES), size)
+    try:
+        write_pack(glyphs, output)
+    except ValueError as e:
+        sys.exit("Emoji pack: %s" % e)
+
+
+if __name__ == "__main__":
+    main(sys.argv)
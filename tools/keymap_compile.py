@@ -0,0 +1,348 @@
+"""Compile a keymap text definition into the binary keymap of include/keymap.h.
+
+A definition (keymaps/*.txt) is a list of directives, one per line; lines
+starting with '#' are comments:
+
+  name <text>              Logged when the keymap is selected
+  action <key> <what>      What an action key does in every layer. key: clear,
+                           accept, space, shift or 123; what: none, clear,
+                           accept, space or layer
+  label <key> <text>       Label of an action key: before the first layer for
+                           every layer, after it for that layer
+  layer <name>             Starts a layer; the first one is shown first
+  keys <12 keys>           The blob keys of the layer in rows of four, three
+                           characters each (left, center, right)
+  target <key> <layer>     Layer reached with a 'layer' action key
+  alt <character> <cells>  Alternates of a long press, a cell per character.
+                           Letters get their other case first, and an upper
+                           case letter the alternates of its lower case one
+
+The keymap is decoded again and compared with the definition before it is
+written. Runs before every PlatformIO build (extra_scripts): keymaps/en.txt
+becomes the built-in keymap (src/generated/keymap_builtin.c), the others
+data/keymaps/<name>.kmp for 'pio run -t uploadfs'; files are only rewritten
+when they change. Standalone, on the host:
+python3 tools/keymap_compile.py <keymap.txt> [output.kmp | output.c]
+"""
+
+import os
+import re
+import struct
+import sys
+import zlib
+
+# PlatformIO runs this in the project tree, and ui_fonts.py imports it: no tools/__pycache__
+sys.dont_write_bytecode = True
+
+HEADER = "include/keymap.h"
+BUILTIN = "en"  # keymaps/en.txt
+ACTION_KEYS = ("clear", "accept", "space", "shift", "123")  # Order of action_keys in src/main.cpp
+ACTIONS = ("none", "clear", "accept", "space", "layer")      # keymap_action_t
+ATLAS_RESERVED = 2  # Picker labels of src/main.cpp, also in the glyph atlas
+
+HEADER_FORMAT = "<IIHHHHBB5sB"
+LAYER_FORMAT = "<%dH%dH%dBB"
+ALTERNATE_FORMAT = "<HH"
+
+
+def header_define(project_dir, path, name):
+    with open(os.path.join(project_dir, path), encoding="utf-8") as f:
+        match = re.search(r"#define %s (\w+)" % name, f.read())
+    if not match:
+        raise ValueError("%s not found in %s" % (name, path))
+    return int(match.group(1), 0)
+
+
+def limits(project_dir):
+    names = ("KEYMAP_MAGIC", "KEYMAP_KEYS", "KEYMAP_SLOTS", "KEYMAP_ACTION_KEYS", "KEYMAP_MAX_LAYERS", "KEYMAP_MAX_SIZE")
+    found = {name: header_define(project_dir, HEADER, name) for name in names}
+    found["ALT_POPUP_MAX_CELLS"] = header_define(project_dir, "include/alt_popup.h", "ALT_POPUP_MAX_CELLS")
+    found["GLYPH_ATLAS_MAX_ENTRIES"] = header_define(project_dir, "include/glyph_atlas.h", "GLYPH_ATLAS_MAX_ENTRIES")
+    found["GLYPH_ATLAS_MAX_TEXT"] = header_define(project_dir, "include/glyph_atlas.h", "GLYPH_ATLAS_MAX_TEXT")
+    if found["KEYMAP_ACTION_KEYS"] != len(ACTION_KEYS):
+        raise ValueError("KEYMAP_ACTION_KEYS is not %d" % len(ACTION_KEYS))
+    return found
+
+
+# --- Definition ---
+
+def other_case(c):
+    swapped = c.swapcase()
+    return swapped if len(swapped) == 1 and swapped != c else None
+
+
+def parse(path, lim):
+    keymap = {"name": os.path.splitext(os.path.basename(path))[0], "actions": ["none"] * len(ACTION_KEYS),
+              "layers": [], "alternates": {}}
+    labels = {}  # Defaults
+    with open(path, encoding="utf-8") as f:
+        lines = f.read().splitlines()
+
+    for number, line in enumerate(lines, 1):
+        line = line.strip()
+        if not line or line.startswith("#"):
+            continue
+        directive, _, rest = line.partition(" ")
+        rest = rest.strip()
+        where = "%s:%d" % (path, number)
+        layer = keymap["layers"][-1] if keymap["layers"] else None
+
+        if directive == "name":
+            keymap["name"] = rest
+        elif directive in ("action", "label", "target"):
+            key, _, value = rest.partition(" ")
+            value = value.strip()
+            if key not in ACTION_KEYS or not value:
+                raise ValueError("%s: %s <%s> <value>" % (where, directive, "|".join(ACTION_KEYS)))
+            index = ACTION_KEYS.index(key)
+            if directive == "action":
+                if value not in ACTIONS:
+                    raise ValueError("%s: action is one of %s" % (where, ", ".join(ACTIONS)))
+                keymap["actions"][index] = value
+            elif directive == "label":
+                if len(value.encode()) >= lim["GLYPH_ATLAS_MAX_TEXT"]:
+                    raise ValueError("%s: label longer than %d bytes" % (where, lim["GLYPH_ATLAS_MAX_TEXT"] - 1))
+                (layer["labels"] if layer else labels)[index] = value
+            else:
+                if not layer:
+                    raise ValueError("%s: target outside a layer" % where)
+                layer["targets"][index] = value
+        elif directive == "layer":
+            if not rest or any(rest == other["name"] for other in keymap["layers"]):
+                raise ValueError("%s: layers need distinct names" % where)
+            keymap["layers"].append({"name": rest, "keys": None, "labels": {}, "targets": {}, "line": where})
+        elif directive == "keys":
+            keys = rest.split()
+            if not layer or len(keys) != lim["KEYMAP_KEYS"] or any(len(k) != lim["KEYMAP_SLOTS"] for k in keys):
+                raise ValueError("%s: keys in a layer, %d of %d characters each"
+                                 % (where, lim["KEYMAP_KEYS"], lim["KEYMAP_SLOTS"]))
+            layer["keys"] = keys
+        elif directive == "alt":
+            character, _, cells = rest.partition(" ")
+            cells = cells.strip()
+            if len(character) != 1 or not cells or " " in cells:
+                raise ValueError("%s: alt <character> <cells>" % where)
+            keymap["alternates"][character] = cells
+        else:
+            raise ValueError("%s: unknown directive %s" % (where, directive))
+
+    if not keymap["layers"]:
+        raise ValueError("%s: no layer" % path)
+    if len(keymap["layers"]) > lim["KEYMAP_MAX_LAYERS"]:
+        raise ValueError("%s: more than %d layers" % (path, lim["KEYMAP_MAX_LAYERS"]))
+    names = [layer["name"] for layer in keymap["layers"]]
+    for layer in keymap["layers"]:
+        if not layer["keys"]:
+            raise ValueError("%s: layer %s has no keys" % (layer["line"], layer["name"]))
+        for index, key in enumerate(ACTION_KEYS):
+            layer["labels"].setdefault(index, labels.get(index))
+            if not layer["labels"][index]:
+                raise ValueError("%s: layer %s has no label for %s" % (layer["line"], layer["name"], key))
+            target = layer["targets"].get(index)
+            if keymap["actions"][index] == "layer":
+                if target not in names:
+                    raise ValueError("%s: layer %s: %s needs the target of a layer" % (layer["line"], layer["name"], key))
+                layer["targets"][index] = names.index(target)
+            elif target is not None:
+                raise ValueError("%s: layer %s: %s is not a layer key" % (layer["line"], layer["name"], key))
+            else:
+                layer["targets"][index] = 0
+    return keymap
+
+
+def alternates(keymap, lim):
+    # Character -> popup cells after it, for every character that has any
+    explicit = keymap["alternates"]
+    characters = set(explicit)
+    for layer in keymap["layers"]:
+        characters.update("".join(layer["keys"]))
+    characters.update(filter(None, map(other_case, list(characters))))
+
+    table = {}
+    for c in characters:
+        swapped = other_case(c)
+        cells = (swapped or "") + explicit.get(c, explicit.get(c.lower(), "") if swapped else "")
+        if not cells:
+            continue
+        if 1 + len(cells) > lim["ALT_POPUP_MAX_CELLS"]:
+            raise ValueError("%s has %d alternates, at most %d fit" % (c, len(cells), lim["ALT_POPUP_MAX_CELLS"] - 1))
+        table[c] = cells
+    return table
+
+
+def characters(path, project_dir):
+    # Every character a keymap can show: keys, labels and alternates (for tools/ui_fonts.py)
+    keymap = parse(path, limits(project_dir))
+    chars = set()
+    for layer in keymap["layers"]:
+        chars.update("".join(layer["keys"]))
+        chars.update("".join(layer["labels"].values()))
+    for c, cells in alternates(keymap, limits(project_dir)).items():
+        chars.update(c + cells)
+    return chars
+
+
+# --- Binary ---
+
+def build(keymap, lim):
+    layer_format = LAYER_FORMAT % (lim["KEYMAP_KEYS"] * lim["KEYMAP_SLOTS"], len(ACTION_KEYS), len(ACTION_KEYS))
+    table = alternates(keymap, lim)
+    layers_offset = struct.calcsize(HEADER_FORMAT)
+    alternates_offset = layers_offset + len(keymap["layers"]) * struct.calcsize(layer_format)
+    pool_offset = alternates_offset + len(table) * struct.calcsize(ALTERNATE_FORMAT)
+
+    pool = bytearray()
+    offsets = {}
+
+    def string(text):
+        if text not in offsets:
+            offsets[text] = pool_offset + len(pool)
+            pool.extend(text.encode() + b"\0")
+        return offsets[text]
+
+    name = string(keymap["name"])
+    layers = bytearray()
+    for layer in keymap["layers"]:
+        slots = [string(c) for key in layer["keys"] for c in key]
+        labels = [string(layer["labels"][i]) for i in range(len(ACTION_KEYS))]
+        targets = [layer["targets"][i] for i in range(len(ACTION_KEYS))]
+        layers += struct.pack(layer_format, *(slots + labels + targets + [0]))
+    # Sorted by the UTF-8 bytes, as strcmp orders them: keymap_alternates() searches by halves
+    entries = bytearray()
+    for c in sorted(table, key=lambda c: c.encode()):
+        entries += struct.pack(ALTERNATE_FORMAT, string(c), string(table[c]))
+
+    texts = {c for layer in keymap["layers"] for key in layer["keys"] for c in key}
+    texts.update(label for layer in keymap["layers"] for label in layer["labels"].values())
+    if len(texts) + ATLAS_RESERVED > lim["GLYPH_ATLAS_MAX_ENTRIES"]:
+        raise ValueError("%d distinct key glyphs, the glyph atlas holds %d"
+                         % (len(texts), lim["GLYPH_ATLAS_MAX_ENTRIES"] - ATLAS_RESERVED))
+
+    size = pool_offset + len(pool)
+    size += -size % 4
+    if size > lim["KEYMAP_MAX_SIZE"]:
+        raise ValueError("%d bytes, at most %d" % (size, lim["KEYMAP_MAX_SIZE"]))
+    actions = bytes(ACTIONS.index(a) for a in keymap["actions"])
+    body = struct.pack(HEADER_FORMAT, lim["KEYMAP_MAGIC"], 0, size, name, layers_offset, alternates_offset,
+                       len(keymap["layers"]), len(table), actions, 0)[8:]
+    body += bytes(layers) + bytes(entries) + bytes(pool)
+    body += bytes(size - 8 - len(body))
+    return struct.pack("<II", lim["KEYMAP_MAGIC"], zlib.crc32(body)) + body
+
+
+def decode(blob, lim):
+    # As src/keymap.cpp reads it
+    def string(offset):
+        end = blob.index(b"\0", offset)
+        return blob[offset:end].decode()
+
+    magic, crc, size, name, layers_offset, alternates_offset, layer_count, alternate_count, actions, _ = \
+        struct.unpack_from(HEADER_FORMAT, blob)
+    if magic != lim["KEYMAP_MAGIC"] or size != len(blob) or crc != zlib.crc32(blob[8:]):
+        raise ValueError("keymap header does not read back")
+    layer_format = LAYER_FORMAT % (lim["KEYMAP_KEYS"] * lim["KEYMAP_SLOTS"], len(ACTION_KEYS), len(ACTION_KEYS))
+    slot_count = lim["KEYMAP_KEYS"] * lim["KEYMAP_SLOTS"]
+    layers = []
+    for i in range(layer_count):
+        values = struct.unpack_from(layer_format, blob, layers_offset + i * struct.calcsize(layer_format))
+        slots = [string(o) for o in values[:slot_count]]
+        layers.append({
+            "keys": ["".join(slots[k:k + lim["KEYMAP_SLOTS"]]) for k in range(0, slot_count, lim["KEYMAP_SLOTS"])],
+            "labels": [string(o) for o in values[slot_count:slot_count + len(ACTION_KEYS)]],
+            "targets": list(values[slot_count + len(ACTION_KEYS):-1])})
+    table = {}
+    for i in range(alternate_count):
+        c, cells = struct.unpack_from(ALTERNATE_FORMAT, blob, alternates_offset + i * struct.calcsize(ALTERNATE_FORMAT))
+        table[string(c)] = string(cells)
+    return {"name": string(name), "actions": [ACTIONS[a] for a in actions], "layers": layers, "alternates": table}
+
+
+def check(blob, keymap, lim):
+    decoded = decode(blob, lim)
+    expected = {"name": keymap["name"], "actions": keymap["actions"],
+                "layers": [{"keys": layer["keys"],
+                            "labels": [layer["labels"][i] for i in range(len(ACTION_KEYS))],
+                            "targets": [layer["targets"][i] for i in range(len(ACTION_KEYS))]}
+                           for layer in keymap["layers"]],
+                "alternates": alternates(keymap, lim)}
+    if decoded != expected:
+        raise ValueError("keymap does not read back")
+    keys = [c.encode() for c in decoded["alternates"]]
+    if keys != sorted(keys):
+        raise ValueError("alternates are not sorted")
+
+
+def compile_keymap(project_dir, path):
+    lim = limits(project_dir)
+    keymap = parse(path, lim)
+    blob = build(keymap, lim)
+    check(blob, keymap, lim)
+    return keymap, blob
+
+
+# --- Output ---
+
+def c_source(blob, path):
+    lines = ",\n".join("    " + ", ".join("0x%02x" % b for b in blob[i:i + 16]) for i in range(0, len(blob), 16))
+    return ("/* Generated by tools/keymap_compile.py from %s, do not edit. */\n\n"
+            "#include <stdint.h>\n\n"
+            "/* Read in place: the 16 bit fields are aligned */\n"
+            "const uint8_t keymap_builtin[] __attribute__((aligned(4))) = {\n%s\n};\n"
+            "const uint32_t keymap_builtin_size = sizeof(keymap_builtin);\n" % (path, lines))
+
+
+def write_if_changed(output, data):
+    if os.path.exists(output):
+        with open(output, "rb") as f:
+            if f.read() == data:
+                return False
+    os.makedirs(os.path.dirname(os.path.abspath(output)), exist_ok=True)
+    with open(output, "wb") as f:
+        f.write(data)
+    return True
+
+
+def write(project_dir, path, output):
+    keymap, blob = compile_keymap(project_dir, path)
+    relative = os.path.relpath(path, project_dir).replace(os.sep, "/")
+    data = c_source(blob, relative).encode() if output.endswith(".c") else blob
+    if write_if_changed(output, data):
+        print("Keymap %s: %d layers, %d alternates, %d bytes in %s"
+              % (keymap["name"], len(keymap["layers"]), len(alternates(keymap, limits(project_dir))), len(blob), output))
+
+
+def generate(project_dir):
+    keymap_dir = os.path.join(project_dir, "keymaps")
+    for name in sorted(os.listdir(keymap_dir)):
+        stem, ext = os.path.splitext(name)
+        if ext != ".txt":
+            continue
+        if stem == BUILTIN:
+            output = os.path.join(project_dir, "src", "generated", "keymap_builtin.c")
+        else:
+            output = os.path.join(project_dir, "data", "keymaps", stem + ".kmp")
+        write(project_dir, os.path.join(keymap_dir, name), output)
+
+
+# --- PlatformIO ---
+
+try:
+    Import("env")  # noqa: F821, only defined when run by PlatformIO
+except NameError:
+    env = None
+
+if env is not None:
+    try:
+        generate(env.subst("$PROJECT_DIR"))
+    except (OSError, ValueError) as e:
+        sys.stderr.write("Keymaps: %s\n" % e)
+        env.Exit(1)
+elif __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit("usage: keymap_compile.py <keymap.txt> [output.kmp | output.c]")
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    stem = os.path.splitext(os.path.basename(sys.argv[1]))[0]
+    try:
+        write(root, sys.argv[1], sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, "data", "keymaps", stem + ".kmp"))
+    except (OSError, ValueError) as e:
+        sys.exit("Keymap: %s" % e)
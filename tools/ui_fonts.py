@@ -0,0 +1,383 @@
+"""Subset fonts with exactly the characters the UI draws.
+
+Collects the characters of the keymaps (keymaps/*.txt, with their labels and
+alternates), the other labels and the LV_SYMBOL_* the sources use, cuts them
+out of LVGL's built-in Montserrat fonts (the C files in lvgl/src/font) and
+writes src/generated/ui_fonts.c: one font per size in UI_FONT_SIZES, with an
+ASCII cmap indexed directly by the code point and the kerning classes of the
+original. Fails when a character is not in the font.
+
+Runs before every PlatformIO build (extra_scripts = pre:tools/ui_fonts.py)
+unless '-D UI_FONTS=0'; the file is only rewritten when it changes.
+Standalone, on the host: python3 tools/ui_fonts.py <path to lvgl> [output]
+"""
+
+import os
+import re
+import sys
+
+# PlatformIO runs this in the project tree: no tools/__pycache__ for the import of keymap_compile
+sys.dont_write_bytecode = True
+
+UI_FONT_SIZES = (14, 18, 20)  # As declared in include/ui_fonts.h
+
+# Initializers whose string and character literals are drawn: (source, array)
+UI_TABLES = (
+    ("src/main.cpp", "picker_labels"),
+)
+# Calls whose literal argument is drawn (printf formats: the conversions are numbers)
+UI_TEXT_CALLS = ("lv_label_set_text", "lv_label_set_text_static", "lv_snprintf")
+ALWAYS = " 0123456789"
+
+# --- Characters ---
+
+LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)+)\'')
+
+
+def unescape(text):
+    # C escapes; the UTF-8 bytes of \x sequences are decoded together
+    raw = bytearray()
+    i = 0
+    while i < len(text):
+        c = text[i]
+        if c != "\\":
+            raw += c.encode()
+            i += 1
+            continue
+        e = text[i + 1]
+        if e == "x":
+            m = re.match(r"[0-9a-fA-F]{1,2}", text[i + 2:])
+            raw.append(int(m.group(0), 16))
+            i += 2 + len(m.group(0))
+            continue
+        raw += {"n": b"\n", "t": b"\t", "0": b"\0"}.get(e, e.encode())
+        i += 2
+    return raw.decode()
+
+
+def strip_comments(code):
+    # Literals are kept as they are, "*/%" is a key
+    return re.sub(r"""("(?:[^"\\\n]|\\.)*"|'(?:[^'\\\n]|\\.)+')|//[^\n]*|/\*.*?\*/""", lambda m: m.group(1) or "",
+                  code, flags=re.S)
+
+
+def initializer(code, name):
+    # The braces after "name[...] =", matched to their end
+    m = re.search(r"\b%s\s*(\[[^\]]*\]\s*)*=\s*\{" % re.escape(name), code)
+    if not m:
+        raise ValueError("no initializer of %s" % name)
+    depth, i = 1, m.end()
+    while depth:
+        if code[i] in "\"'":
+            i = LITERAL.match(code, i).end()
+            continue
+        depth += {"{": 1, "}": -1}.get(code[i], 0)
+        i += 1
+    return code[m.end():i - 1]
+
+
+def literals(code):
+    return [unescape(m.group(1) if m.group(1) is not None else m.group(2)) for m in LITERAL.finditer(code)]
+
+
+def symbol_table(lvgl_dir):
+    # LV_SYMBOL_NAME -> its text
+    with open(os.path.join(lvgl_dir, "src", "font", "lv_symbol_def.h"), encoding="utf-8") as f:
+        defs = f.read()
+    return {m.group(1): unescape(m.group(2)) for m in re.finditer(r'#define\s+(LV_SYMBOL_\w+)\s+"([^"]*)"', defs)}
+
+
+def ui_characters(project_dir, lvgl_dir):
+    chars = set(ALWAYS)
+    sources = {}
+
+    def source(path):
+        if path not in sources:
+            with open(os.path.join(project_dir, path), encoding="utf-8") as f:
+                sources[path] = strip_comments(f.read())
+        return sources[path]
+
+    for path, name in UI_TABLES:
+        for text in literals(initializer(source(path), name)):
+            chars.update(text)
+    # As tools/keymap_compile.py reads them (imported from the project: PlatformIO runs this without __file__)
+    sys.path.insert(0, os.path.join(project_dir, "tools"))
+    import keymap_compile
+    keymap_dir = os.path.join(project_dir, "keymaps")
+    for name in sorted(os.listdir(keymap_dir)):
+        if name.endswith(".txt"):
+            chars.update(keymap_compile.characters(os.path.join(keymap_dir, name), project_dir))
+
+    symbols = symbol_table(lvgl_dir)
+    src_dir = os.path.join(project_dir, "src")
+    for name in sorted(os.listdir(src_dir)):
+        if not name.endswith((".c", ".cpp")):
+            continue
+        code = source(os.path.join("src", name))
+        for call in re.finditer(r"\b(%s)\s*\(([^;]*)\)\s*;" % "|".join(UI_TEXT_CALLS), code):
+            for text in literals(call.group(2)):
+                chars.update(re.sub(r"%[-+ #0]*\d*(?:\.\d+)?[hlzjt]*([a-zA-Z%])",
+                                    lambda m: "%" if m.group(1) == "%" else "", text))
+        for symbol in re.findall(r"\bLV_SYMBOL_\w+", code):
+            if symbol not in symbols:
+                raise ValueError("%s: unknown %s" % (name, symbol))
+            chars.update(symbols[symbol])
+    chars.discard("\n")
+    return sorted(chars)
+
+# --- Fonts ---
+
+
+def array(code, name):
+    m = re.search(r"\b%s\[\]\s*=\s*\{(.*?)\};" % re.escape(name), code, flags=re.S)
+    if not m:
+        raise ValueError("no array %s" % name)
+    return [int(v, 0) for v in re.findall(r"-?0x[0-9a-fA-F]+|-?\d+", strip_comments(m.group(1)))]
+
+
+def field(code, name):
+    m = re.search(r"\.%s\s*=\s*(-?\w+)" % re.escape(name), code)
+    if not m:
+        raise ValueError("no field %s" % name)
+    return m.group(1)
+
+
+def parse_font(path):
+    with open(path, encoding="utf-8") as f:
+        code = strip_comments(f.read())
+    font = {"bitmap": array(code, "glyph_bitmap"), "glyphs": []}
+    for m in re.finditer(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+                         r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}", code):
+        font["glyphs"].append([int(v) for v in m.groups()])
+
+    # Code point -> glyph id
+    font["map"] = {}
+    for m in re.finditer(r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+                         r"\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), "
+                         r"\.type = (\w+)", code):
+        start, length, gid, unicode_list, ofs_list, list_length, kind = m.groups()
+        start, length, gid = int(start), int(length), int(gid)
+        if kind == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY":
+            for i in range(length):
+                font["map"][start + i] = gid + i
+        elif kind == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+            for i, ofs in enumerate(array(code, unicode_list)):
+                font["map"][start + ofs] = gid + i
+        else:
+            raise ValueError("%s: unsupported cmap %s" % (path, kind))
+
+    for name in ("bpp", "kern_scale", "bitmap_format", "kern_classes"):
+        font[name] = int(field(code, name))
+    if font["bitmap_format"] != 0:
+        raise ValueError("%s: compressed bitmaps are not supported" % path)
+    if font["kern_classes"]:
+        font["kern_left"] = array(code, "kern_left_class_mapping")
+        font["kern_right"] = array(code, "kern_right_class_mapping")
+        font["kern_values"] = array(code, "kern_class_values")
+        font["left_class_cnt"] = int(field(code, "left_class_cnt"))
+        font["right_class_cnt"] = int(field(code, "right_class_cnt"))
+    # Of the public lv_font_t
+    public = code[code.index("get_glyph_dsc"):]
+    for name in ("line_height", "base_line", "underline_position", "underline_thickness"):
+        font[name] = int(field(public, name))
+    return font
+
+
+def hex_lines(values, per_line=16):
+    return ",\n".join("    " + ", ".join(values[i:i + per_line]) for i in range(0, len(values), per_line))
+
+
+def subset_font(font, size, chars):
+    missing = [c for c in chars if ord(c) not in font["map"]]
+    if missing:
+        raise ValueError("Montserrat %d has no glyph for %s" % (size, ", ".join("U+%04X" % ord(c) for c in missing)))
+    points = sorted(ord(c) for c in chars)
+    if len(points) > 255:
+        raise ValueError("more than 255 glyphs")
+
+    # Glyph 0 means none, then in code point order
+    sub = {"bitmap": [], "glyphs": [[0, 0, 0, 0, 0, 0]], "old_ids": [0], "cmaps": []}
+    for p in points:
+        gid = font["map"][p]
+        index, adv_w, box_w, box_h, ofs_x, ofs_y = font["glyphs"][gid]
+        length = (box_w * box_h * font["bpp"] + 7) // 8
+        sub["glyphs"].append([len(sub["bitmap"]), adv_w, box_w, box_h, ofs_x, ofs_y])
+        sub["bitmap"] += font["bitmap"][index:index + length]
+        sub["old_ids"].append(gid)
+
+    # ASCII indexed by the code point: without gaps the id follows from it, else from a byte per code point
+    ascii_points = [p for p in points if p < 0x80]
+    if ascii_points:
+        first, last = ascii_points[0], ascii_points[-1]
+        if len(ascii_points) == last - first + 1:
+            sub["cmaps"].append({"type": "FORMAT0_TINY", "start": first, "length": len(ascii_points), "gid": 1})
+        else:
+            ids = [0] * (last - first + 1)
+            for i, p in enumerate(ascii_points):
+                ids[p - first] = i + 1
+            sub["cmaps"].append({"type": "FORMAT0_FULL", "start": first, "length": len(ids), "gid": 0, "ids": ids})
+    # The few symbols: a sorted list
+    other_points = points[len(ascii_points):]
+    if other_points:
+        first = other_points[0]
+        sub["cmaps"].append({"type": "SPARSE_TINY", "start": first, "length": other_points[-1] - first + 1,
+                             "gid": len(ascii_points) + 1, "list": [p - first for p in other_points]})
+    return sub
+
+
+def lookup(cmaps, point):
+    # As lv_font_fmt_txt.c resolves a glyph id
+    for cmap in cmaps:
+        rcp = point - cmap["start"]
+        if rcp < 0 or rcp >= cmap["length"]:
+            continue
+        if cmap["type"] == "FORMAT0_TINY":
+            return cmap["gid"] + rcp
+        if cmap["type"] == "FORMAT0_FULL":
+            return cmap["gid"] + cmap["ids"][rcp]
+        if rcp in cmap["list"]:
+            return cmap["gid"] + cmap["list"].index(rcp)
+    return 0
+
+
+def check_subset(font, sub, size, chars):
+    # Every character resolves to the original glyph: metrics, pixels and kerning classes
+    for c in chars:
+        gid = lookup(sub["cmaps"], ord(c))
+        old = font["glyphs"][font["map"][ord(c)]]
+        new = sub["glyphs"][gid] if gid else None
+        length = (old[2] * old[3] * font["bpp"] + 7) // 8
+        if (not gid or new[1:] != old[1:] or
+                sub["bitmap"][new[0]:new[0] + length] != font["bitmap"][old[0]:old[0] + length] or
+                font["kern_classes"] and (font["kern_left"][sub["old_ids"][gid]] != font["kern_left"][font["map"][ord(c)]])):
+            raise ValueError("Montserrat %d subset: U+%04X does not resolve to its glyph" % (size, ord(c)))
+    # Nothing else does
+    for p in range(0x80):
+        if chr(p) not in chars and lookup(sub["cmaps"], p):
+            raise ValueError("Montserrat %d subset: U+%04X resolves to a glyph" % (size, p))
+
+
+def font_code(font, sub, size):
+    name = "ui_font_%d" % size
+    out = ["/* Montserrat %d px, %d bpp, %d glyphs */\n" % (size, font["bpp"], len(sub["glyphs"]) - 1)]
+    out.append("static LV_ATTRIBUTE_LARGE_CONST const uint8_t %s_bitmap[] = {\n%s\n};\n"
+               % (name, hex_lines(["0x%02x" % b for b in sub["bitmap"]]) if sub["bitmap"] else "    0"))
+    out.append("static const lv_font_fmt_txt_glyph_dsc_t %s_glyph_dsc[] = {\n%s\n};\n" % (name, ",\n".join(
+        "    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}" % tuple(g)
+        for g in sub["glyphs"])))
+
+    cmaps = []
+    for cmap in sub["cmaps"]:
+        unicode_list = ofs_list = "NULL"
+        list_length = 0
+        if "ids" in cmap:
+            ofs_list = "%s_ascii_ids" % name
+            list_length = len(cmap["ids"])
+            out.append("static const uint8_t %s[] = {\n%s\n};\n" % (ofs_list, hex_lines([str(v) for v in cmap["ids"]])))
+        if "list" in cmap:
+            unicode_list = "%s_symbols" % name
+            list_length = len(cmap["list"])
+            out.append("static const uint16_t %s[] = {\n%s\n};\n"
+                       % (unicode_list, hex_lines(["0x%x" % v for v in cmap["list"]])))
+        cmaps.append("    {.range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                     "     .unicode_list = %s, .glyph_id_ofs_list = %s, .list_length = %d, .type = LV_FONT_FMT_TXT_CMAP_%s}"
+                     % (cmap["start"], cmap["length"], cmap["gid"], unicode_list, ofs_list, list_length, cmap["type"]))
+    out.append("static const lv_font_fmt_txt_cmap_t %s_cmaps[] = {\n%s\n};\n" % (name, ",\n".join(cmaps)))
+
+    kern = "NULL"
+    if font["kern_classes"]:
+        left = [font["kern_left"][gid] for gid in sub["old_ids"]]
+        right = [font["kern_right"][gid] for gid in sub["old_ids"]]
+        out.append("static const uint8_t %s_kern_left[] = {\n%s\n};\n" % (name, hex_lines([str(v) for v in left])))
+        out.append("static const uint8_t %s_kern_right[] = {\n%s\n};\n" % (name, hex_lines([str(v) for v in right])))
+        out.append("static const int8_t %s_kern_values[] = {\n%s\n};\n"
+                   % (name, hex_lines([str(v) for v in font["kern_values"]])))
+        out.append("static const lv_font_fmt_txt_kern_classes_t %s_kern = {\n"
+                   "    .class_pair_values = %s_kern_values,\n"
+                   "    .left_class_mapping = %s_kern_left,\n"
+                   "    .right_class_mapping = %s_kern_right,\n"
+                   "    .left_class_cnt = %d,\n"
+                   "    .right_class_cnt = %d,\n};\n"
+                   % (name, name, name, name, font["left_class_cnt"], font["right_class_cnt"]))
+        kern = "&%s_kern" % name
+
+    out.append("static const lv_font_fmt_txt_dsc_t %s_dsc = {\n"
+               "    .glyph_bitmap = %s_bitmap,\n"
+               "    .glyph_dsc = %s_glyph_dsc,\n"
+               "    .cmaps = %s_cmaps,\n"
+               "    .kern_dsc = %s,\n"
+               "    .kern_scale = %d,\n"
+               "    .cmap_num = %d,\n"
+               "    .bpp = %d,\n"
+               "    .kern_classes = %d,\n"
+               "    .bitmap_format = 0,\n};\n"
+               % (name, name, name, name, kern, font["kern_scale"], len(cmaps), font["bpp"], font["kern_classes"]))
+    out.append("const lv_font_t %s = {\n"
+               "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,\n"
+               "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,\n"
+               "    .line_height = %d,\n"
+               "    .base_line = %d,\n"
+               "    .subpx = LV_FONT_SUBPX_NONE,\n"
+               "    .underline_position = %d,\n"
+               "    .underline_thickness = %d,\n"
+               "    .dsc = &%s_dsc,\n"
+               "    .fallback = UI_FONT_FALLBACK,\n"
+               "    .user_data = NULL,\n};\n"
+               % (name, font["line_height"], font["base_line"], font["underline_position"],
+                  font["underline_thickness"], name))
+    return "\n".join(out)
+
+
+def generate(project_dir, lvgl_dir, output):
+    chars = ui_characters(project_dir, lvgl_dir)
+    parts = ["/* Generated by tools/ui_fonts.py, do not edit.\n"
+             " * Characters: %s */\n\n#include <lvgl.h>\n\n#if UI_FONTS\n\n"
+             "/* Characters the subsets lack come from the emoji pack (emoji_glyphs.cpp) */\n"
+             "#if EMOJI_LAYER\nextern lv_font_t emoji_font;\n#define UI_FONT_FALLBACK (&emoji_font)\n"
+             "#else\n#define UI_FONT_FALLBACK NULL\n#endif\n"
+             % "".join(c if 0x20 < ord(c) < 0x7f and c not in "*/" else "U+%04X " % ord(c) for c in chars)]
+    sizes = []
+    for size in UI_FONT_SIZES:
+        font = parse_font(os.path.join(lvgl_dir, "src", "font", "lv_font_montserrat_%d.c" % size))
+        sub = subset_font(font, size, chars)
+        check_subset(font, sub, size, chars)
+        parts.append(font_code(font, sub, size))
+        sizes.append("%d px %d bytes (of %d)" % (size, len(sub["bitmap"]), len(font["bitmap"])))
+    parts.append("#endif /* UI_FONTS */\n")
+    text = "\n".join(parts)
+
+    if os.path.exists(output):
+        with open(output, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    os.makedirs(os.path.dirname(output), exist_ok=True)
+    with open(output, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("UI fonts: %d characters, bitmaps %s" % (len(chars), ", ".join(sizes)))
+
+
+# --- PlatformIO ---
+
+try:
+    Import("env")  # noqa: F821, only defined when run by PlatformIO
+except NameError:
+    env = None
+
+if env is not None:
+    flags = [f for f in env.GetProjectOption("build_flags", []) if not f.strip().startswith(("#", ";"))]
+    if not any(re.search(r"-D\s*UI_FONTS=0\b", f) for f in flags):
+        project_dir = env.subst("$PROJECT_DIR")
+        lvgl_dir = os.path.join(env.subst("$PROJECT_LIBDEPS_DIR"), env.subst("$PIOENV"), "lvgl")
+        if not os.path.isdir(lvgl_dir):
+            sys.stderr.write("UI fonts: LVGL not found in %s (build with '-D UI_FONTS=0')\n" % lvgl_dir)
+            env.Exit(1)
+        try:
+            generate(project_dir, lvgl_dir, os.path.join(project_dir, "src", "generated", "ui_fonts.c"))
+        except (OSError, ValueError) as e:
+            sys.stderr.write("UI fonts: %s\n" % e)
+            env.Exit(1)
+elif __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit("usage: ui_fonts.py <lvgl dir> [output]")
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    generate(root, sys.argv[1], sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, "src", "generated", "ui_fonts.c"))